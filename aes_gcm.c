@@ -0,0 +1,525 @@
+/*****************************************************************************
+Filename    : aes_gcm.c
+Date        : 2026-10-19
+Description : AES-256-GCM. Bulk data goes through AES-NI four counter blocks
+              at a time, with the four GHASH products summed before a single
+              PCLMULQDQ reduction. Hosts without AES-NI use byte-oriented
+              AES and bitwise GHASH, which are slow and not constant time.
+*****************************************************************************/
+#include <string.h>
+
+#include "aes_gcm.h"
+
+#define AES_ROUNDS      14
+
+static const uint8_t sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+/*
+ * Portable AES-256
+ */
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x >> 7) * 0x1b));
+}
+
+static void aes_expand_key(uint8_t rk[15][16], const uint8_t key[AES_GCM_KEY_LEN])
+{
+    uint8_t *w = rk[0], t[4], rcon = 1, u;
+    uint32_t i;
+
+    memcpy(w, key, AES_GCM_KEY_LEN);
+    for (i = 8; i < 4 * (AES_ROUNDS + 1); i++) {
+        memcpy(t, w + 4 * (i - 1), 4);
+        if (i % 8 == 0) {
+            u = t[0];
+            t[0] = sbox[t[1]] ^ rcon;
+            t[1] = sbox[t[2]];
+            t[2] = sbox[t[3]];
+            t[3] = sbox[u];
+            rcon = xtime(rcon);
+        }
+        else if (i % 8 == 4) {
+            t[0] = sbox[t[0]];
+            t[1] = sbox[t[1]];
+            t[2] = sbox[t[2]];
+            t[3] = sbox[t[3]];
+        }
+        w[4 * i] = w[4 * (i - 8)] ^ t[0];
+        w[4 * i + 1] = w[4 * (i - 8) + 1] ^ t[1];
+        w[4 * i + 2] = w[4 * (i - 8) + 2] ^ t[2];
+        w[4 * i + 3] = w[4 * (i - 8) + 3] ^ t[3];
+    }
+}
+
+static void aes_encrypt_c(uint8_t rk[15][16], uint8_t out[16], const uint8_t in[16])
+{
+    uint8_t s[16], t[16], a, b, c, d;
+    uint32_t r, i;
+
+    for (i = 0; i < 16; i++) {
+        s[i] = in[i] ^ rk[0][i];
+    }
+    for (r = 1; r <= AES_ROUNDS; r++) {
+        // SubBytes and ShiftRows; the state is column major
+        for (i = 0; i < 16; i++) {
+            t[i] = sbox[s[(i + 4 * (i % 4)) % 16]];
+        }
+        if (r < AES_ROUNDS) {
+            for (i = 0; i < 16; i += 4) {
+                a = t[i];
+                b = t[i + 1];
+                c = t[i + 2];
+                d = t[i + 3];
+                t[i] = xtime(a ^ b) ^ b ^ c ^ d;
+                t[i + 1] = xtime(b ^ c) ^ a ^ c ^ d;
+                t[i + 2] = xtime(c ^ d) ^ a ^ b ^ d;
+                t[i + 3] = xtime(d ^ a) ^ a ^ b ^ c;
+            }
+        }
+        for (i = 0; i < 16; i++) {
+            s[i] = t[i] ^ rk[r][i];
+        }
+    }
+    memcpy(out, s, 16);
+
+    // Clear potentially sensitive information
+    memset(s, 0, sizeof(s));
+    memset(t, 0, sizeof(t));
+}
+
+// x = x * h in GF(2^128), bit-reflected as in SP 800-38D
+static void gf_mul_c(uint8_t x[16], const uint8_t h[16])
+{
+    uint8_t z[16] = {0}, v[16], mask;
+    uint32_t i, j;
+
+    memcpy(v, h, 16);
+    for (i = 0; i < 128; i++) {
+        mask = (uint8_t)(0 - ((x[i / 8] >> (7 - i % 8)) & 1));
+        for (j = 0; j < 16; j++) {
+            z[j] ^= v[j] & mask;
+        }
+        mask = (uint8_t)(0 - (v[15] & 1));
+        for (j = 15; j > 0; j--) {
+            v[j] = (uint8_t)((v[j] >> 1) | (v[j - 1] << 7));
+        }
+        v[0] = (uint8_t)((v[0] >> 1) ^ (0xe1 & mask));
+    }
+    memcpy(x, z, 16);
+
+    // Clear potentially sensitive information
+    memset(z, 0, sizeof(z));
+    memset(v, 0, sizeof(v));
+}
+
+static void counter_block(const aes_gcm_t *ctx, uint8_t cb[16], uint32_t ctr)
+{
+    memcpy(cb, ctx->j0, 12);
+    cb[12] = (uint8_t)(ctr >> 24);
+    cb[13] = (uint8_t)(ctr >> 16);
+    cb[14] = (uint8_t)(ctr >> 8);
+    cb[15] = (uint8_t)ctr;
+}
+
+static void blocks_c(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t nblocks, int enc)
+{
+    uint8_t ks[16], c[16];
+    uint32_t i;
+
+    for (; nblocks; nblocks--, in += 16, out += 16) {
+        counter_block(ctx, ks, ctx->ctr++);
+        aes_encrypt_c(ctx->rk, ks, ks);
+        for (i = 0; i < 16; i++) {
+            c[i] = enc ? in[i] ^ ks[i] : in[i];
+            out[i] = in[i] ^ ks[i];
+            ctx->x[i] ^= c[i];
+        }
+        gf_mul_c(ctx->x, ctx->h);
+    }
+
+    // Clear potentially sensitive information
+    memset(ks, 0, sizeof(ks));
+}
+
+/*
+ * AES-NI / PCLMULQDQ. GHASH runs on byte-reflected values: with operands and
+ * H byte-swapped, the carry-less product shifted left by one bit is the
+ * reflected product (Intel, "Carry-Less Multiplication and Its Usage for
+ * Computing the GCM Mode").
+ */
+#if defined(__x86_64__) && defined(__GNUC__)
+
+#include <immintrin.h>
+
+#define GCM_NI      __attribute__((target("aes,pclmul,ssse3,sse4.1")))
+
+int aes_gcm_ni_supported(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("aes") && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}
+
+// lo/mid/hi += the three Karatsuba-free partial products of a * b
+static inline GCM_NI void clmul_acc(__m128i a, __m128i b, __m128i *lo, __m128i *mid, __m128i *hi)
+{
+    *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(a, b, 0x00));
+    *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(a, b, 0x11));
+    *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(a, b, 0x10));
+    *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(a, b, 0x01));
+}
+
+// Shift the 256-bit sum left by one and reduce modulo x^128 + x^7 + x^2 + x + 1
+static inline GCM_NI __m128i gf_reduce(__m128i lo, __m128i mid, __m128i hi)
+{
+    __m128i t2, t3, t4, t5, t6, t7, t8, t9;
+
+    t3 = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    t6 = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+    t7 = _mm_srli_epi32(t3, 31);
+    t8 = _mm_srli_epi32(t6, 31);
+    t3 = _mm_slli_epi32(t3, 1);
+    t6 = _mm_slli_epi32(t6, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    t3 = _mm_or_si128(t3, t7);
+    t6 = _mm_or_si128(t6, t8);
+    t6 = _mm_or_si128(t6, t9);
+
+    t7 = _mm_slli_epi32(t3, 31);
+    t8 = _mm_slli_epi32(t3, 30);
+    t9 = _mm_slli_epi32(t3, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    t3 = _mm_xor_si128(t3, t7);
+
+    t2 = _mm_srli_epi32(t3, 1);
+    t4 = _mm_srli_epi32(t3, 2);
+    t5 = _mm_srli_epi32(t3, 7);
+    t2 = _mm_xor_si128(t2, t4);
+    t2 = _mm_xor_si128(t2, t5);
+    t2 = _mm_xor_si128(t2, t8);
+    t3 = _mm_xor_si128(t3, t2);
+    return _mm_xor_si128(t6, t3);
+}
+
+static inline GCM_NI __m128i gf_mul_ni(__m128i a, __m128i b)
+{
+    __m128i lo = _mm_setzero_si128(), mid = lo, hi = lo;
+
+    clmul_acc(a, b, &lo, &mid, &hi);
+    return gf_reduce(lo, mid, hi);
+}
+
+static inline GCM_NI __m128i aes_encrypt_ni(const __m128i *rk, __m128i b)
+{
+    int r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < AES_ROUNDS; r++) {
+        b = _mm_aesenc_si128(b, rk[r]);
+    }
+    return _mm_aesenclast_si128(b, rk[AES_ROUNDS]);
+}
+
+static GCM_NI void block_ni(aes_gcm_t *ctx, uint8_t out[16], const uint8_t in[16])
+{
+    __m128i rk[AES_ROUNDS + 1];
+    int r;
+
+    for (r = 0; r <= AES_ROUNDS; r++) {
+        rk[r] = _mm_load_si128((const __m128i*)ctx->rk[r]);
+    }
+    _mm_storeu_si128((__m128i*)out, aes_encrypt_ni(rk, _mm_loadu_si128((const __m128i*)in)));
+
+    // Clear potentially sensitive information
+    memset(rk, 0, sizeof(rk));
+}
+
+static GCM_NI void hash_setup_ni(aes_gcm_t *ctx)
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i h, p;
+    int i;
+
+    h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)ctx->h), bswap);
+    p = h;
+    _mm_storeu_si128((__m128i*)ctx->hp[0], p);
+    for (i = 1; i < 4; i++) {
+        p = gf_mul_ni(p, h);
+        _mm_storeu_si128((__m128i*)ctx->hp[i], p);
+    }
+}
+
+static GCM_NI void ghash_ni(aes_gcm_t *ctx, const uint8_t block[16])
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i x;
+
+    x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)ctx->x), _mm_loadu_si128((const __m128i*)block));
+    x = gf_mul_ni(_mm_shuffle_epi8(x, bswap), _mm_loadu_si128((const __m128i*)ctx->hp[0]));
+    _mm_storeu_si128((__m128i*)ctx->x, _mm_shuffle_epi8(x, bswap));
+}
+
+static GCM_NI void blocks_ni(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t nblocks, int enc)
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i rk[AES_ROUNDS + 1], h[4], x, iv, b[4], d[4], lo, mid, hi;
+    uint32_t ctr = ctx->ctr;
+    int r, k;
+
+    for (r = 0; r <= AES_ROUNDS; r++) {
+        rk[r] = _mm_load_si128((const __m128i*)ctx->rk[r]);
+    }
+    for (k = 0; k < 4; k++) {
+        h[k] = _mm_loadu_si128((const __m128i*)ctx->hp[k]);
+    }
+    x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)ctx->x), bswap);
+    iv = _mm_loadu_si128((const __m128i*)ctx->j0);
+
+    for (; nblocks >= 4; nblocks -= 4, in += 64, out += 64) {
+        for (k = 0; k < 4; k++) {
+            b[k] = _mm_xor_si128(_mm_insert_epi32(iv, (int)__builtin_bswap32(ctr + k), 3), rk[0]);
+        }
+        ctr += 4;
+        for (r = 1; r < AES_ROUNDS; r++) {
+            for (k = 0; k < 4; k++) {
+                b[k] = _mm_aesenc_si128(b[k], rk[r]);
+            }
+        }
+        for (k = 0; k < 4; k++) {
+            d[k] = _mm_loadu_si128((const __m128i*)(in + 16 * k));
+            b[k] = _mm_xor_si128(_mm_aesenclast_si128(b[k], rk[AES_ROUNDS]), d[k]);
+            _mm_storeu_si128((__m128i*)(out + 16 * k), b[k]);
+            d[k] = _mm_shuffle_epi8(enc ? b[k] : d[k], bswap);
+        }
+
+        // X = (X + C1) H^4 + C2 H^3 + C3 H^2 + C4 H, one reduction
+        lo = mid = hi = _mm_setzero_si128();
+        clmul_acc(_mm_xor_si128(x, d[0]), h[3], &lo, &mid, &hi);
+        clmul_acc(d[1], h[2], &lo, &mid, &hi);
+        clmul_acc(d[2], h[1], &lo, &mid, &hi);
+        clmul_acc(d[3], h[0], &lo, &mid, &hi);
+        x = gf_reduce(lo, mid, hi);
+    }
+    for (; nblocks; nblocks--, in += 16, out += 16) {
+        b[0] = aes_encrypt_ni(rk, _mm_insert_epi32(iv, (int)__builtin_bswap32(ctr++), 3));
+        d[0] = _mm_loadu_si128((const __m128i*)in);
+        b[0] = _mm_xor_si128(b[0], d[0]);
+        _mm_storeu_si128((__m128i*)out, b[0]);
+        x = gf_mul_ni(_mm_xor_si128(x, _mm_shuffle_epi8(enc ? b[0] : d[0], bswap)), h[0]);
+    }
+
+    _mm_storeu_si128((__m128i*)ctx->x, _mm_shuffle_epi8(x, bswap));
+    ctx->ctr = ctr;
+
+    // Clear potentially sensitive information
+    memset(rk, 0, sizeof(rk));
+    memset(b, 0, sizeof(b));
+}
+
+#else
+
+int aes_gcm_ni_supported(void)
+{
+    return 0;
+}
+
+static void block_ni(aes_gcm_t *ctx, uint8_t out[16], const uint8_t in[16])
+{
+    aes_encrypt_c(ctx->rk, out, in);
+}
+
+static void hash_setup_ni(aes_gcm_t *ctx)
+{
+    (void)ctx;
+}
+
+static void ghash_ni(aes_gcm_t *ctx, const uint8_t block[16])
+{
+    (void)ctx;
+    (void)block;
+}
+
+static void blocks_ni(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t nblocks, int enc)
+{
+    blocks_c(ctx, out, in, nblocks, enc);
+}
+
+#endif
+
+/*
+ * Dispatch
+ */
+static void encrypt_block(aes_gcm_t *ctx, uint8_t out[16], const uint8_t in[16])
+{
+    if (ctx->ni) {
+        block_ni(ctx, out, in);
+    }
+    else {
+        aes_encrypt_c(ctx->rk, out, in);
+    }
+}
+
+static void ghash_block(aes_gcm_t *ctx, const uint8_t block[16])
+{
+    uint32_t i;
+
+    if (ctx->ni) {
+        ghash_ni(ctx, block);
+        return;
+    }
+    for (i = 0; i < 16; i++) {
+        ctx->x[i] ^= block[i];
+    }
+    gf_mul_c(ctx->x, ctx->h);
+}
+
+void aes_gcm_init(aes_gcm_t *ctx, const uint8_t key[AES_GCM_KEY_LEN], const uint8_t iv[AES_GCM_IV_LEN],
+                  const uint8_t *aad, uint32_t aad_len)
+{
+    uint8_t block[16];
+
+    memset((uint8_t*)ctx, 0, sizeof(*ctx));
+    ctx->ni = aes_gcm_ni_supported();
+    aes_expand_key(ctx->rk, key);
+
+    encrypt_block(ctx, ctx->h, ctx->h);
+    hash_setup_ni(ctx);
+
+    memcpy(ctx->j0, iv, AES_GCM_IV_LEN);
+    ctx->j0[15] = 1;
+    ctx->ctr = 2;
+
+    ctx->aad_len = aad_len;
+    for (; aad_len >= 16; aad += 16, aad_len -= 16) {
+        ghash_block(ctx, aad);
+    }
+    if (aad_len) {
+        memset(block, 0, sizeof(block));
+        memcpy(block, aad, aad_len);
+        ghash_block(ctx, block);
+    }
+}
+
+static void gcm_crypt(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t len, int enc)
+{
+    uint32_t n, i;
+    uint8_t c;
+
+    ctx->len += len;
+
+    // Finish the partial block left by the previous call
+    if (ctx->partial) {
+        n = 16 - ctx->partial < len ? 16 - ctx->partial : len;
+        for (i = 0; i < n; i++) {
+            c = in[i];
+            out[i] = c ^ ctx->ks[ctx->partial + i];
+            ctx->cb[ctx->partial + i] = enc ? out[i] : c;
+        }
+        in += n;
+        out += n;
+        len -= n;
+        ctx->partial += n;
+        if (ctx->partial < 16) {
+            return;
+        }
+        ghash_block(ctx, ctx->cb);
+        ctx->partial = 0;
+    }
+
+    n = len / 16;
+    if (n) {
+        if (ctx->ni) {
+            blocks_ni(ctx, out, in, n, enc);
+        }
+        else {
+            blocks_c(ctx, out, in, n, enc);
+        }
+        in += 16 * n;
+        out += 16 * n;
+        len -= 16 * n;
+    }
+
+    // Start a new partial block with the tail
+    if (len) {
+        counter_block(ctx, ctx->ks, ctx->ctr++);
+        encrypt_block(ctx, ctx->ks, ctx->ks);
+        memset(ctx->cb, 0, sizeof(ctx->cb));
+        for (i = 0; i < len; i++) {
+            c = in[i];
+            out[i] = c ^ ctx->ks[i];
+            ctx->cb[i] = enc ? out[i] : c;
+        }
+        ctx->partial = len;
+    }
+}
+
+void aes_gcm_encrypt(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t len)
+{
+    gcm_crypt(ctx, out, in, len, 1);
+}
+
+void aes_gcm_decrypt(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t len)
+{
+    gcm_crypt(ctx, out, in, len, 0);
+}
+
+void aes_gcm_tag(aes_gcm_t *ctx, uint8_t tag[AES_GCM_TAG_LEN])
+{
+    uint8_t block[16];
+    uint64_t bits[2];
+    uint32_t i;
+
+    if (ctx->partial) {
+        ghash_block(ctx, ctx->cb);
+    }
+    bits[0] = ctx->aad_len * 8;
+    bits[1] = ctx->len * 8;
+    for (i = 0; i < 8; i++) {
+        block[7 - i] = (uint8_t)(bits[0] >> (8 * i));
+        block[15 - i] = (uint8_t)(bits[1] >> (8 * i));
+    }
+    ghash_block(ctx, block);
+
+    encrypt_block(ctx, block, ctx->j0);
+    for (i = 0; i < AES_GCM_TAG_LEN; i++) {
+        tag[i] = block[i] ^ ctx->x[i];
+    }
+
+    // Clear potentially sensitive information
+    memset(block, 0, sizeof(block));
+    memset((uint8_t*)ctx, 0, sizeof(*ctx));
+}
+
+int aes_gcm_check(aes_gcm_t *ctx, const uint8_t tag[AES_GCM_TAG_LEN])
+{
+    uint8_t t[AES_GCM_TAG_LEN], diff = 0;
+    uint32_t i;
+
+    aes_gcm_tag(ctx, t);
+    for (i = 0; i < AES_GCM_TAG_LEN; i++) {
+        diff |= t[i] ^ tag[i];
+    }
+    return diff ? -1 : 0;
+}
@@ -0,0 +1,43 @@
+/*****************************************************************************
+Filename    : aes_gcm.h
+Date        : 2026-10-19
+Description : Streaming AES-256-GCM (SP 800-38D), AES-NI/PCLMULQDQ with a
+              portable fallback
+*****************************************************************************/
+#ifndef __AES_GCM_H__
+#define __AES_GCM_H__
+
+#include <stdint.h>
+
+#define AES_GCM_KEY_LEN                     32      // AES-256
+#define AES_GCM_IV_LEN                      12
+#define AES_GCM_TAG_LEN                     16
+
+typedef struct {
+    uint8_t  rk[15][16] __attribute__((aligned(16)));  // round keys
+    uint8_t  h[16];                             // hash subkey E(K, 0)
+    uint8_t  hp[4][16];                         // H^1 .. H^4 byte-reflected, AES-NI path only
+    uint8_t  j0[16];                            // pre-counter block IV || 1
+    uint8_t  x[16];                             // GHASH accumulator
+    uint8_t  ks[16], cb[16];                    // keystream and ciphertext of a partial block
+    uint32_t ctr;                               // next counter value
+    uint32_t partial;                           // bytes of ks already used, 0 .. 15
+    uint64_t aad_len, len;
+    int      ni;                                // 1: AES-NI/PCLMULQDQ, 0: portable (set by init)
+} aes_gcm_t;
+
+int aes_gcm_ni_supported(void);
+
+/*
+ * aad is authenticated once up front; encrypt/decrypt may then be called any
+ * number of times with any lengths, in place or not. Decrypted bytes are not
+ * authentic until aes_gcm_check() returns 0. tag/check wipe the context.
+ */
+void aes_gcm_init(aes_gcm_t *ctx, const uint8_t key[AES_GCM_KEY_LEN], const uint8_t iv[AES_GCM_IV_LEN],
+                  const uint8_t *aad, uint32_t aad_len);
+void aes_gcm_encrypt(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t len);
+void aes_gcm_decrypt(aes_gcm_t *ctx, uint8_t *out, const uint8_t *in, uint32_t len);
+void aes_gcm_tag(aes_gcm_t *ctx, uint8_t tag[AES_GCM_TAG_LEN]);
+int aes_gcm_check(aes_gcm_t *ctx, const uint8_t tag[AES_GCM_TAG_LEN]);     // 0, or -1 on mismatch
+
+#endif  // __AES_GCM_H__
@@ -124,7 +124,564 @@ void bn_mul(bn_t* a, bn_t* b, bn_t* c, uint32_t digits)
     bn_assign(a, t, 2 * digits);
 
     // Clear potentially sensitive information
-    memset((uint8_t*)t, 0, sizeof(t));
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+/*
+ * Product-scanning (Comba) kernels. Each output column is summed in a three
+ * word register accumulator (hi:lo, lo being two digits wide) and every
+ * result digit is written exactly once.
+ */
+#define COMBA_MULADD(lo, hi, x, y)  do { dbn_t _p = (dbn_t)(x) * (y); (lo) += _p; (hi) += ((lo) < _p); } while (0)
+#define COMBA_SHIFT(lo, hi)         do { (lo) = ((lo) >> BN_DIGIT_BITS) | ((dbn_t)(hi) << BN_DIGIT_BITS); (hi) = 0; } while (0)
+
+// a[0 .. bdigits+cdigits) = b * c; a must not overlap b or c
+static inline __attribute__((always_inline))
+void comba_mul(bn_t* a, const bn_t* b, uint32_t bdigits, const bn_t* c, uint32_t cdigits)
+{
+    dbn_t lo = 0;
+    bn_t hi = 0;
+    uint32_t i, k, lo_i, hi_i;
+
+    for (k = 0; k < bdigits + cdigits - 1; k++) {
+        lo_i = k < cdigits ? 0 : k - cdigits + 1;
+        hi_i = k < bdigits ? k : bdigits - 1;
+        for (i = lo_i; i <= hi_i; i++) {
+            COMBA_MULADD(lo, hi, b[i], c[k - i]);
+        }
+        a[k] = (bn_t)lo;
+        COMBA_SHIFT(lo, hi);
+    }
+    a[k] = (bn_t)lo;
+}
+
+// a[0 .. 2*digits) = b^2; a must not overlap b
+static inline __attribute__((always_inline))
+void comba_sqr(bn_t* a, const bn_t* b, uint32_t digits)
+{
+    dbn_t lo = 0, slo;
+    bn_t hi = 0, shi;
+    uint32_t i, j, k;
+
+    for (k = 0; k < 2 * digits - 1; k++) {
+        // Off-diagonal products b[i] * b[j], i < j, counted twice
+        slo = 0;
+        shi = 0;
+        i = k < digits ? 0 : k - digits + 1;
+        for (j = k - i; i < j; i++, j--) {
+            COMBA_MULADD(slo, shi, b[i], b[j]);
+        }
+        shi = (shi << 1) | (bn_t)(slo >> (2 * BN_DIGIT_BITS - 1));
+        slo <<= 1;
+        lo += slo;
+        hi += shi + (lo < slo);
+        if (i == j) {
+            COMBA_MULADD(lo, hi, b[i], b[i]);
+        }
+        a[k] = (bn_t)lo;
+        COMBA_SHIFT(lo, hi);
+    }
+    a[k] = (bn_t)lo;
+}
+
+/*
+ * Montgomery c = a * b / R mod n, finely integrated product scanning (FIPS):
+ * column i accumulates a*b and q*n together, q[i] is chosen to clear the
+ * low digit. The result is fully reduced with a masked final subtraction,
+ * unless lazy is set: then c = (a * b + q * n) / R as is, which is below 2n
+ * whenever a, b < 2n and 4n <= R (almost Montgomery multiplication).
+ */
+static inline __attribute__((always_inline))
+void comba_mont_mul(bn_t* c, const bn_t* a, const bn_t* b, const bn_t* n, uint32_t digits, bn_t n0inv, int lazy)
+{
+    bn_t q[BN_MAX_DIGITS], t[BN_MAX_DIGITS], u[BN_MAX_DIGITS], hi = 0, borrow, mask;
+    dbn_t lo = 0;
+    uint32_t i, j;
+
+    for (i = 0; i < digits; i++) {
+        for (j = 0; j < i; j++) {
+            COMBA_MULADD(lo, hi, a[j], b[i - j]);
+            COMBA_MULADD(lo, hi, q[j], n[i - j]);
+        }
+        COMBA_MULADD(lo, hi, a[i], b[0]);
+        q[i] = (bn_t)lo * n0inv;
+        COMBA_MULADD(lo, hi, q[i], n[0]);
+        COMBA_SHIFT(lo, hi);
+    }
+    for (i = digits; i < 2 * digits - 1; i++) {
+        for (j = i - digits + 1; j < digits; j++) {
+            COMBA_MULADD(lo, hi, a[j], b[i - j]);
+            COMBA_MULADD(lo, hi, q[j], n[i - j]);
+        }
+        t[i - digits] = (bn_t)lo;
+        COMBA_SHIFT(lo, hi);
+    }
+    t[digits - 1] = (bn_t)lo;
+
+    if (lazy) {
+        bn_assign(c, t, digits);
+    }
+    else {
+        // t + carry * R < 2n: keep t - n unless it borrowed without a carry
+        borrow = bn_sub(u, t, (bn_t*)n, digits);
+        mask = (bn_t)0 - (borrow & ((bn_t)(lo >> BN_DIGIT_BITS) ^ 1));
+        for (i = 0; i < digits; i++) {
+            c[i] = (t[i] & mask) | (u[i] & ~mask);
+        }
+        memset((uint8_t*)u, 0, digits * sizeof(bn_t));
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)q, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)t, 0, digits * sizeof(bn_t));
+}
+
+/*
+ * Standalone Montgomery reduction c = t / R mod n of a 2*digits product t
+ * (separated operand scanning): the same columns as comba_mont_mul with the
+ * a*b terms replaced by the digits of t. t < n * R keeps the result below
+ * 2n before the masked final subtraction.
+ */
+static inline __attribute__((always_inline))
+void comba_redc(bn_t* c, const bn_t* t, const bn_t* n, uint32_t digits, bn_t n0inv)
+{
+    bn_t q[BN_MAX_DIGITS], u[BN_MAX_DIGITS], v[BN_MAX_DIGITS], hi = 0, borrow, mask;
+    dbn_t lo = 0;
+    uint32_t i, j;
+
+    for (i = 0; i < digits; i++) {
+        lo += t[i];
+        hi += lo < t[i];
+        for (j = 0; j < i; j++) {
+            COMBA_MULADD(lo, hi, q[j], n[i - j]);
+        }
+        q[i] = (bn_t)lo * n0inv;
+        COMBA_MULADD(lo, hi, q[i], n[0]);
+        COMBA_SHIFT(lo, hi);
+    }
+    for (i = digits; i < 2 * digits; i++) {
+        lo += t[i];
+        hi += lo < t[i];
+        for (j = i - digits + 1; j < digits; j++) {
+            COMBA_MULADD(lo, hi, q[j], n[i - j]);
+        }
+        u[i - digits] = (bn_t)lo;
+        COMBA_SHIFT(lo, hi);
+    }
+
+    // u + carry * R < 2n: keep u - n unless it borrowed without a carry
+    borrow = bn_sub(v, u, (bn_t*)n, digits);
+    mask = (bn_t)0 - (borrow & ((bn_t)lo ^ 1));
+    for (i = 0; i < digits; i++) {
+        c[i] = (u[i] & mask) | (v[i] & ~mask);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)q, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)u, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)v, 0, digits * sizeof(bn_t));
+}
+
+/*
+ * Two independent Montgomery products (e.g. the p and q halves of a CRT
+ * exponentiation) computed column by column in lockstep. The two
+ * accumulators never depend on each other, so their multiply/add chains
+ * overlap in the pipeline.
+ */
+static inline __attribute__((always_inline))
+void comba_mont_mul2(bn_t* c0, const bn_t* a0, const bn_t* b0, const bn_t* n0, bn_t k0,
+                     bn_t* c1, const bn_t* a1, const bn_t* b1, const bn_t* n1, bn_t k1, uint32_t digits)
+{
+    bn_t q0[BN_MAX_DIGITS], t0[BN_MAX_DIGITS], q1[BN_MAX_DIGITS], t1[BN_MAX_DIGITS], u[BN_MAX_DIGITS];
+    bn_t hi0 = 0, hi1 = 0, borrow, mask;
+    dbn_t lo0 = 0, lo1 = 0;
+    uint32_t i, j;
+
+    for (i = 0; i < digits; i++) {
+        for (j = 0; j < i; j++) {
+            COMBA_MULADD(lo0, hi0, a0[j], b0[i - j]);
+            COMBA_MULADD(lo1, hi1, a1[j], b1[i - j]);
+            COMBA_MULADD(lo0, hi0, q0[j], n0[i - j]);
+            COMBA_MULADD(lo1, hi1, q1[j], n1[i - j]);
+        }
+        COMBA_MULADD(lo0, hi0, a0[i], b0[0]);
+        COMBA_MULADD(lo1, hi1, a1[i], b1[0]);
+        q0[i] = (bn_t)lo0 * k0;
+        q1[i] = (bn_t)lo1 * k1;
+        COMBA_MULADD(lo0, hi0, q0[i], n0[0]);
+        COMBA_MULADD(lo1, hi1, q1[i], n1[0]);
+        COMBA_SHIFT(lo0, hi0);
+        COMBA_SHIFT(lo1, hi1);
+    }
+    for (i = digits; i < 2 * digits - 1; i++) {
+        for (j = i - digits + 1; j < digits; j++) {
+            COMBA_MULADD(lo0, hi0, a0[j], b0[i - j]);
+            COMBA_MULADD(lo1, hi1, a1[j], b1[i - j]);
+            COMBA_MULADD(lo0, hi0, q0[j], n0[i - j]);
+            COMBA_MULADD(lo1, hi1, q1[j], n1[i - j]);
+        }
+        t0[i - digits] = (bn_t)lo0;
+        t1[i - digits] = (bn_t)lo1;
+        COMBA_SHIFT(lo0, hi0);
+        COMBA_SHIFT(lo1, hi1);
+    }
+    t0[digits - 1] = (bn_t)lo0;
+    t1[digits - 1] = (bn_t)lo1;
+
+    borrow = bn_sub(u, t0, (bn_t*)n0, digits);
+    mask = (bn_t)0 - (borrow & ((bn_t)(lo0 >> BN_DIGIT_BITS) ^ 1));
+    for (i = 0; i < digits; i++) {
+        c0[i] = (t0[i] & mask) | (u[i] & ~mask);
+    }
+    borrow = bn_sub(u, t1, (bn_t*)n1, digits);
+    mask = (bn_t)0 - (borrow & ((bn_t)(lo1 >> BN_DIGIT_BITS) ^ 1));
+    for (i = 0; i < digits; i++) {
+        c1[i] = (t1[i] & mask) | (u[i] & ~mask);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)q0, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)t0, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)q1, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)t1, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)u, 0, digits * sizeof(bn_t));
+}
+
+// Fixed-size kernels for the common limb counts (1024/1536/2048/3072/4096-bit operands);
+// a constant digit count lets the compiler unroll the column loops
+#define BN_COMBA_FIXED(N)                                                                           \
+static void bn_mul_comba_##N(bn_t* a, const bn_t* b, const bn_t* c)                                \
+{                                                                                                   \
+    comba_mul(a, b, N, c, N);                                                                       \
+}                                                                                                   \
+static void bn_sqr_comba_##N(bn_t* a, const bn_t* b)                                               \
+{                                                                                                   \
+    comba_sqr(a, b, N);                                                                             \
+}                                                                                                   \
+static void mont_mul_comba_##N(bn_t* c, const bn_t* a, const bn_t* b, const bn_t* n, bn_t n0inv)   \
+{                                                                                                   \
+    comba_mont_mul(c, a, b, n, N, n0inv, 0);                                                        \
+}                                                                                                   \
+static void mont_mul2_comba_##N(bn_t* c0, const bn_t* a0, const bn_t* b0, const bn_t* n0, bn_t k0, \
+                                bn_t* c1, const bn_t* a1, const bn_t* b1, const bn_t* n1, bn_t k1) \
+{                                                                                                   \
+    comba_mont_mul2(c0, a0, b0, n0, k0, c1, a1, b1, n1, k1, N);                                     \
+}
+
+BN_COMBA_FIXED(32)
+BN_COMBA_FIXED(48)
+BN_COMBA_FIXED(64)
+BN_COMBA_FIXED(96)
+BN_COMBA_FIXED(128)
+
+// Almost Montgomery kernels for 1024/1536/2048/3072-bit moduli plus one spare digit
+#define BN_AMM_FIXED(N)                                                                             \
+static void mont_amm_comba_##N(bn_t* c, const bn_t* a, const bn_t* b, const bn_t* n, bn_t n0inv)   \
+{                                                                                                   \
+    comba_mont_mul(c, a, b, n, N, n0inv, 1);                                                        \
+}
+
+BN_AMM_FIXED(33)
+BN_AMM_FIXED(49)
+BN_AMM_FIXED(65)
+BN_AMM_FIXED(97)
+
+void bn_mul_comba(bn_t* a, bn_t* b, bn_t* c, uint32_t digits)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    switch (digits) {
+    case 32:  bn_mul_comba_32(t, b, c);             break;
+    case 48:  bn_mul_comba_48(t, b, c);             break;
+    case 64:  bn_mul_comba_64(t, b, c);             break;
+    case 96:  bn_mul_comba_96(t, b, c);             break;
+    case 128: bn_mul_comba_128(t, b, c);            break;
+    default:  comba_mul(t, b, digits, c, digits);   break;
+    }
+    bn_assign(a, t, 2 * digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+void bn_sqr(bn_t* a, bn_t* b, uint32_t digits)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    switch (digits) {
+    case 32:  bn_sqr_comba_32(t, b);                break;
+    case 48:  bn_sqr_comba_48(t, b);                break;
+    case 64:  bn_sqr_comba_64(t, b);                break;
+    case 96:  bn_sqr_comba_96(t, b);                break;
+    case 128: bn_sqr_comba_128(t, b);               break;
+    default:  comba_sqr(t, b, digits);              break;
+    }
+    bn_assign(a, t, 2 * digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+static void mul_rec(bn_t* r, const bn_t* x, const bn_t* y, uint32_t n, uint32_t cutoff);
+
+/*
+ * r = x * y, r has 2n digits and must not overlap x or y. x = x1*B^h + x0,
+ * y = y1*B^h + y0; the middle term is (x0+x1)(y0+y1) - x0*y0 - x1*y1. The
+ * sums carry into an extra digit, so the middle product is h+1 digits wide.
+ */
+static void karatsuba(bn_t* r, const bn_t* x, const bn_t* y, uint32_t n, uint32_t cutoff)
+{
+    bn_t sx[BN_MAX_DIGITS + 2], sy[BN_MAX_DIGITS + 2], z1[2 * BN_MAX_DIGITS + 4];
+    uint32_t h, l, i, len;
+    dbn_t acc;
+    bn_t borrow;
+
+    if (n < cutoff || n < 4) {
+        comba_mul(r, x, n, y, n);
+        return;
+    }
+
+    h = (n + 1) / 2;
+    l = n - h;
+
+    mul_rec(r, x, y, h, cutoff);                            // z0 = x0 * y0
+    mul_rec(r + 2 * h, x + h, y + h, l, cutoff);            // z2 = x1 * y1
+
+    acc = 0;
+    for (i = 0; i < h; i++) {
+        acc += (dbn_t)x[i] + (i < l ? x[h + i] : 0);
+        sx[i] = (bn_t)acc;
+        acc >>= BN_DIGIT_BITS;
+    }
+    sx[h] = (bn_t)acc;
+    acc = 0;
+    for (i = 0; i < h; i++) {
+        acc += (dbn_t)y[i] + (i < l ? y[h + i] : 0);
+        sy[i] = (bn_t)acc;
+        acc >>= BN_DIGIT_BITS;
+    }
+    sy[h] = (bn_t)acc;
+
+    mul_rec(z1, sx, x == y ? sx : sy, h + 1, cutoff);
+
+    // z1 -= z0 + z2; the result x0*y1 + x1*y0 is non-negative
+    borrow = 0;
+    for (i = 0; i < 2 * h + 2; i++) {
+        acc = (dbn_t)z1[i] - (i < 2 * h ? r[i] : 0) - borrow;
+        z1[i] = (bn_t)acc;
+        borrow = (bn_t)(acc >> BN_DIGIT_BITS) & 1;
+    }
+    borrow = 0;
+    for (i = 0; i < 2 * h + 2; i++) {
+        acc = (dbn_t)z1[i] - (i < 2 * l ? r[2 * h + i] : 0) - borrow;
+        z1[i] = (bn_t)acc;
+        borrow = (bn_t)(acc >> BN_DIGIT_BITS) & 1;
+    }
+
+    // r += z1 * B^h; z1 < 2 * B^(h+l), so only its low n+l digits can be set
+    len = 2 * n - h;
+    acc = 0;
+    for (i = 0; i < len; i++) {
+        acc += (dbn_t)r[h + i] + (i < 2 * h + 2 ? z1[i] : 0);
+        r[h + i] = (bn_t)acc;
+        acc >>= BN_DIGIT_BITS;
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)sx, 0, (h + 1) * sizeof(bn_t));
+    memset((uint8_t*)sy, 0, (h + 1) * sizeof(bn_t));
+    memset((uint8_t*)z1, 0, (2 * h + 2) * sizeof(bn_t));
+}
+
+// Toom-3 part length bound: ceil(BN_MAX_DIGITS / 3) plus a carry digit
+#define TOOM3_PART      (BN_MAX_DIGITS / 3 + 2)
+
+// a[0 .. adigits) -= c * b[0 .. bdigits); the result must not be negative
+static void toom3_sub_mul(bn_t* a, uint32_t adigits, bn_t c, bn_t* b, uint32_t bdigits)
+{
+    bn_t borrow, ai;
+    uint32_t i;
+
+    borrow = c == 1 ? bn_sub(a, a, b, bdigits) : bn_sub_digit_mul(a, a, c, b, bdigits);
+    for (i = bdigits; i < adigits && borrow; i++) {
+        ai = a[i];
+        a[i] = ai - borrow;
+        borrow = ai < borrow;
+    }
+}
+
+// a[0 .. adigits) += b[0 .. bdigits), carries beyond adigits are dropped
+static void toom3_add(bn_t* a, uint32_t adigits, const bn_t* b, uint32_t bdigits)
+{
+    dbn_t acc = 0;
+    uint32_t i;
+
+    for (i = 0; i < adigits && (i < bdigits || acc); i++) {
+        acc += (dbn_t)a[i] + (i < bdigits ? b[i] : 0);
+        a[i] = (bn_t)acc;
+        acc >>= BN_DIGIT_BITS;
+    }
+}
+
+// a = a / d for a single digit d that divides a exactly
+static void toom3_div_digit(bn_t* a, uint32_t digits, bn_t d)
+{
+    dbn_t rem = 0;
+    int i;
+
+    for (i = digits - 1; i >= 0; i--) {
+        rem = (rem << BN_DIGIT_BITS) | a[i];
+        a[i] = (bn_t)(rem / d);
+        rem %= d;
+    }
+}
+
+/*
+ * r = x * y by Toom-3, r has 2n digits and must not overlap x or y.
+ * x = x2*B^2k + x1*B^k + x0 with k = ceil(n/3), likewise y, so r is the
+ * polynomial product w(B^k) with w = r4*z^4 + ... + r0. It is evaluated at
+ * z = 0, 1, 2, 3 and infinity by five products of about n/3 digits.
+ * Interpolation works on g = w - r4*z^4 at 0 .. 3 by forward differences:
+ * for coefficients that are all non-negative every difference is too, so
+ * the whole step runs on unsigned numbers, with two exact small divisions.
+ */
+static void toom3(bn_t* r, const bn_t* x, const bn_t* y, uint32_t n, uint32_t cutoff)
+{
+    bn_t ex[3][TOOM3_PART], ey[3][TOOM3_PART], w[3][2 * TOOM3_PART];
+    dbn_t acc[3];
+    bn_t x0, x1, x2;
+    uint32_t k, l, len, i, j;
+
+    k = (n + 2) / 3;
+    l = n - 2 * k;
+    len = 2 * k + 2;
+
+    // x(1), x(2), x(3), each below 13 * B^k
+    for (j = 0; j < 2; j++) {
+        const bn_t* v = j ? y : x;
+        bn_t (*e)[TOOM3_PART] = j ? ey : ex;
+
+        acc[0] = acc[1] = acc[2] = 0;
+        for (i = 0; i < k; i++) {
+            x0 = v[i];
+            x1 = v[k + i];
+            x2 = i < l ? v[2 * k + i] : 0;
+            acc[0] += (dbn_t)x0 + x1 + x2;
+            acc[1] += (dbn_t)x0 + 2 * (dbn_t)x1 + 4 * (dbn_t)x2;
+            acc[2] += (dbn_t)x0 + 3 * (dbn_t)x1 + 9 * (dbn_t)x2;
+            e[0][i] = (bn_t)acc[0];
+            e[1][i] = (bn_t)acc[1];
+            e[2][i] = (bn_t)acc[2];
+            acc[0] >>= BN_DIGIT_BITS;
+            acc[1] >>= BN_DIGIT_BITS;
+            acc[2] >>= BN_DIGIT_BITS;
+        }
+        e[0][k] = (bn_t)acc[0];
+        e[1][k] = (bn_t)acc[1];
+        e[2][k] = (bn_t)acc[2];
+        if (x == y) {
+            break;
+        }
+    }
+
+    // r0 = w(0) and r4 = w(inf) straight into place, the middle still empty
+    mul_rec(r, x, y, k, cutoff);
+    mul_rec(r + 4 * k, x + 2 * k, y + 2 * k, l, cutoff);
+    bn_assign_zero(r + 2 * k, 2 * k);
+    for (i = 0; i < 3; i++) {
+        mul_rec(w[i], ex[i], x == y ? ex[i] : ey[i], k + 1, cutoff);
+    }
+
+    // g(z) = w(z) - r4 * z^4
+    toom3_sub_mul(w[0], len, 1, r + 4 * k, 2 * l);
+    toom3_sub_mul(w[1], len, 16, r + 4 * k, 2 * l);
+    toom3_sub_mul(w[2], len, 81, r + 4 * k, 2 * l);
+
+    // First, second and third differences; then r3 = d3 / 6,
+    // r2 = (d2 - d3) / 2 = (d2 - 6 r3) / 2, r1 = d1 - r2 - r3
+    toom3_sub_mul(w[2], len, 1, w[1], len);
+    toom3_sub_mul(w[1], len, 1, w[0], len);
+    toom3_sub_mul(w[0], len, 1, r, 2 * k);
+    toom3_sub_mul(w[2], len, 1, w[1], len);
+    toom3_sub_mul(w[1], len, 1, w[0], len);
+    toom3_sub_mul(w[2], len, 1, w[1], len);
+    toom3_div_digit(w[2], len, 6);
+    toom3_sub_mul(w[1], len, 6, w[2], len);
+    bn_shift_r(w[1], w[1], 1, len);
+    toom3_sub_mul(w[0], len, 1, w[1], len);
+    toom3_sub_mul(w[0], len, 1, w[2], len);
+
+    // r += r1 * B^k + r2 * B^2k + r3 * B^3k; the top digits beyond 2n are zero
+    for (i = 0; i < 3; i++) {
+        toom3_add(r + (i + 1) * k, 2 * n - (i + 1) * k, w[i], len < 2 * n - (i + 1) * k ? len : 2 * n - (i + 1) * k);
+    }
+
+    // Clear potentially sensitive information
+    for (i = 0; i < 3; i++) {
+        memset((uint8_t*)ex[i], 0, (k + 1) * sizeof(bn_t));
+        if (x != y) {
+            memset((uint8_t*)ey[i], 0, (k + 1) * sizeof(bn_t));
+        }
+        memset((uint8_t*)w[i], 0, len * sizeof(bn_t));
+    }
+}
+
+// r = x * y (2n digits): Comba below cutoff, Toom-3 from BN_TOOM3_CUTOFF on,
+// Karatsuba in between; each split multiplies its parts the same way
+static void mul_rec(bn_t* r, const bn_t* x, const bn_t* y, uint32_t n, uint32_t cutoff)
+{
+    if (n < cutoff || n < 4) {
+        if (x == y) {
+            comba_sqr(r, x, n);
+        }
+        else {
+            comba_mul(r, x, n, y, n);
+        }
+    }
+    else if (n >= BN_TOOM3_CUTOFF) {
+        toom3(r, x, y, n, cutoff);
+    }
+    else {
+        karatsuba(r, x, y, n, cutoff);
+    }
+}
+
+void bn_mul_karatsuba(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    karatsuba(t, b, c, digits, cutoff);
+    bn_assign(a, t, 2 * digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+void bn_mul_toom3(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    if (digits < 9) {
+        mul_rec(t, b, c, digits, cutoff);
+    }
+    else {
+        toom3(t, b, c, digits, cutoff);
+    }
+    bn_assign(a, t, 2 * digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+void bn_mul_fast(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    mul_rec(t, b, c, digits, cutoff);
+    bn_assign(a, t, 2 * digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
 }
 
 void bn_div(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t ddigits)
@@ -170,8 +727,8 @@ void bn_div(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t ddigi
     bn_shift_r(b, cc, shift, dddigits);
 
     // Clear potentially sensitive information
-    memset((uint8_t*)cc, 0, sizeof(cc));
-    memset((uint8_t*)dd, 0, sizeof(dd));
+    memset((uint8_t*)cc, 0, (cdigits + 1) * sizeof(bn_t));
+    memset((uint8_t*)dd, 0, dddigits * sizeof(bn_t));
 }
 
 bn_t bn_shift_l(bn_t* a, bn_t* b, uint32_t c, uint32_t digits)
@@ -216,70 +773,260 @@ bn_t bn_shift_r(bn_t* a, bn_t* b, uint32_t c, uint32_t digits)
 
 void bn_mod(bn_t* a, bn_t* b, uint32_t bdigits, bn_t* c, uint32_t cdigits)
 {
-    bn_t t[2 * BN_MAX_DIGITS] = { 0 };
+    bn_t t[2 * BN_MAX_DIGITS];
 
     bn_div(t, a, b, bdigits, c, cdigits);
 
     // Clear potentially sensitive information
-    memset((uint8_t*)t, 0, sizeof(t));
+    memset((uint8_t*)t, 0, bdigits * sizeof(bn_t));
 }
 
 void bn_mod_mul(bn_t* a, bn_t* b, bn_t* c, bn_t* d, uint32_t digits)
 {
     bn_t t[2 * BN_MAX_DIGITS];
 
-    bn_mul(t, b, c, digits);
+    if (digits >= 2 * BN_KARATSUBA_CUTOFF) {
+        bn_mul_fast(t, b, c, digits, BN_KARATSUBA_CUTOFF);
+    }
+    else if (b == c) {
+        bn_sqr(t, b, digits);
+    }
+    else {
+        bn_mul_comba(t, b, c, digits);
+    }
     bn_mod(a, t, 2 * digits, d, digits);
 
     // Clear potentially sensitive information
-    memset((uint8_t*)t, 0, sizeof(t));
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
 }
 
-void bn_mod_exp(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t ddigits)
+/*
+ * Masked helpers for bn_mod_inv: every limb is read and written whatever the
+ * mask, so neither branches nor memory accesses depend on the values.
+ */
+static bn_t inv_sub(bn_t* a, const bn_t* b, bn_t mask, uint32_t digits)      // a -= b & mask, returns borrow
 {
-    bn_t bpower[5][BN_MAX_DIGITS], ci, t[BN_MAX_DIGITS];
-    int i;
-    uint32_t ci_bits, j, s;
+    dbn_t acc;
+    bn_t borrow = 0;
+    uint32_t i;
 
-    bn_assign(bpower[0], b, ddigits);
-    bn_mod_mul(bpower[1], bpower[0], b, d, ddigits);
-    bn_mod_mul(bpower[2], bpower[1], b, d, ddigits);
-    //bn_mod_mul(bpower[3], bpower[2], b, d, ddigits);
-    //bn_mod_mul(bpower[4], bpower[3], b, d, ddigits);
+    for (i = 0; i < digits; i++) {
+        acc = (dbn_t)a[i] - (b[i] & mask) - borrow;
+        a[i] = (bn_t)acc;
+        borrow = (bn_t)(acc >> BN_DIGIT_BITS) & 1;
+    }
+    return borrow;
+}
 
+static bn_t inv_add(bn_t* a, const bn_t* b, bn_t mask, uint32_t digits)      // a += b & mask, returns carry
+{
+    dbn_t acc;
+    bn_t carry = 0;
+    uint32_t i;
 
-    BN_ASSIGN_DIGIT(t, 1, ddigits);
+    for (i = 0; i < digits; i++) {
+        acc = (dbn_t)a[i] + (b[i] & mask) + carry;
+        a[i] = (bn_t)acc;
+        carry = (bn_t)(acc >> BN_DIGIT_BITS);
+    }
+    return carry;
+}
 
-    cdigits = bn_digits(c, cdigits);
-    
-    for (i = cdigits - 1; i >= 0; i--) {
-        ci = c[i];
-        ci_bits = BN_DIGIT_BITS;
+static void inv_neg(bn_t* a, bn_t mask, uint32_t digits)                     // a = -a if mask
+{
+    dbn_t acc;
+    bn_t carry = mask & 1;
+    uint32_t i;
 
-        if (i == (int)(cdigits - 1)) {
-            while (!DIGIT_2MSB(ci)) {
-                ci <<= 2;
-                ci_bits -= 2;
-            }
-        }
+    for (i = 0; i < digits; i++) {
+        acc = (dbn_t)(a[i] ^ mask) + carry;
+        a[i] = (bn_t)acc;
+        carry = (bn_t)(acc >> BN_DIGIT_BITS);
+    }
+}
 
-        for (j = 0; j < ci_bits; j += 2) {
-            bn_mod_mul(t, t, t, d, ddigits);
-            bn_mod_mul(t, t, t, d, ddigits);
-            //bn_mod_mul(t, t, t, d, ddigits);
-            //bn_mod_mul(t, t, t, d, ddigits);
-            if ((s = DIGIT_2MSB(ci)) != 0) {
-                bn_mod_mul(t, t, bpower[s - 1], d, ddigits);
-            }
-            ci <<= 2;
-        }
+static void inv_swap(bn_t* x, bn_t* y, bn_t mask, uint32_t digits)
+{
+    bn_t t;
+    uint32_t i;
+
+    for (i = 0; i < digits; i++) {
+        t = (x[i] ^ y[i]) & mask;
+        x[i] ^= t;
+        y[i] ^= t;
+    }
+}
+
+static bn_t inv_half(bn_t* a, uint32_t digits)                               // a >>= 1, returns the bit shifted out
+{
+    bn_t low = a[0] & 1;
+    uint32_t i;
+
+    for (i = 0; i + 1 < digits; i++) {
+        a[i] = (a[i] >> 1) | (a[i + 1] << (BN_DIGIT_BITS - 1));
+    }
+    a[digits - 1] >>= 1;
+    return low;
+}
+
+/*
+ * Constant-time binary extended GCD for odd m (the scheme of Nettle's
+ * sec_modinv). x = u * b and y = v * b mod m, with y odd throughout: an odd x
+ * becomes |x - y| (y takes the smaller of the two), then x and u are halved.
+ * 64 * digits steps bring x to 0, leaving y = gcd(b, m) and v = b^-1.
+ */
+static int mod_inv_odd(bn_t* a, bn_t* b, bn_t* m, uint32_t digits)
+{
+    bn_t x[BN_MAX_DIGITS], y[BN_MAX_DIGITS], u[BN_MAX_DIGITS], v[BN_MAX_DIGITS], half[BN_MAX_DIGITS];
+    bn_t odd, swap, diff;
+    dbn_t acc;
+    uint32_t i;
+
+    if (digits == 0) {
+        return -1;
+    }
+    bn_assign(x, b, digits);
+    bn_assign(y, m, digits);
+    bn_assign_one(u, digits);
+    bn_assign_zero(v, digits);
+
+    // half = (m + 1) / 2, so that u / 2 mod m = (u >> 1) + half for odd u
+    bn_assign(half, m, digits);
+    inv_half(half, digits);
+    for (i = 0, acc = 1; i < digits; i++) {
+        acc += half[i];
+        half[i] = (bn_t)acc;
+        acc >>= BN_DIGIT_BITS;
     }
 
-    bn_assign(a, t, ddigits);
+    for (i = 0; i < 2 * BN_DIGIT_BITS * digits; i++) {
+        odd = (bn_t)0 - (x[0] & 1);
+        swap = (bn_t)0 - inv_sub(x, y, odd, digits);
+        inv_add(y, x, swap, digits);
+        inv_neg(x, swap, digits);
+        inv_swap(u, v, swap, digits);
+        inv_add(u, m, (bn_t)0 - inv_sub(u, v, odd, digits), digits);
+        inv_half(x, digits);
+        inv_add(u, half, (bn_t)0 - inv_half(u, digits), digits);
+    }
+
+    diff = y[0] ^ 1;
+    for (i = 1; i < digits; i++) {
+        diff |= y[i];
+    }
+    if (diff != 0) {
+        bn_assign_zero(v, digits);
+    }
+    bn_assign(a, v, digits);
 
     // Clear potentially sensitive information
-    memset((uint8_t*)bpower, 0, sizeof(bpower));
-    memset((uint8_t*)t, 0, sizeof(t));
+    memset((uint8_t*)x, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)y, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)u, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)v, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)half, 0, digits * sizeof(bn_t));
+
+    return diff != 0 ? -1 : 0;
+}
+
+/*
+ * Even m, e.g. d = e^-1 mod lcm(p - 1, q - 1), with b odd: from
+ * y = m^-1 mod b by the odd case, b^-1 = (1 + m * (b - y)) / b mod m.
+ * Meant for public b; the run time depends on b's length.
+ */
+static int mod_inv_even(bn_t* a, bn_t* b, bn_t* m, uint32_t digits)
+{
+    bn_t t[2 * BN_MAX_DIGITS], q[2 * BN_MAX_DIGITS], one[2 * BN_MAX_DIGITS], y[BN_MAX_DIGITS], w[BN_MAX_DIGITS];
+    uint32_t bdigits = bn_digits(b, digits);
+
+    if (bdigits == 0 || (b[0] & 1) == 0) {
+        bn_assign_zero(a, digits);
+        return -1;
+    }
+    bn_mod(w, m, digits, b, bdigits);
+    if (mod_inv_odd(y, w, b, bdigits) != 0) {
+        bn_assign_zero(a, digits);
+        return -1;
+    }
+
+    bn_assign_zero(w, digits);
+    bn_sub(w, b, y, bdigits);
+    bn_mul(t, m, w, digits);
+    BN_ASSIGN_DIGIT(one, 1, 2 * digits);
+    bn_add(t, t, one, 2 * digits);
+    bn_div(q, w, t, 2 * digits, b, bdigits);
+    bn_mod(a, q, 2 * digits, m, digits);                    // only b = 1 leaves q = m + 1
+
+    return 0;
+}
+
+int bn_mod_inv(bn_t* a, bn_t* b, bn_t* m, uint32_t digits)
+{
+    return (m[0] & 1) ? mod_inv_odd(a, b, m, digits) : mod_inv_even(a, b, m, digits);
+}
+
+/*
+ * Montgomery's simultaneous inversion: a holds the prefix products
+ * c_i = b_0 * ... * b_i, a single inversion gives c_(count-1)^-1, and walking
+ * back b_i^-1 = c_i^-1 * c_(i-1) and c_(i-1)^-1 = c_i^-1 * b_i. That is one
+ * bn_mod_inv and 3 * (count - 1) bn_mod_mul calls.
+ */
+int bn_mod_inv_batch(bn_t* a, bn_t* b, uint32_t count, bn_t* m, uint32_t digits)
+{
+    bn_t inv[BN_MAX_DIGITS];
+    uint32_t i;
+    int status;
+
+    if (count == 0) {
+        return 0;
+    }
+    bn_assign(a, b, digits);
+    for (i = 1; i < count; i++) {
+        bn_mod_mul(&a[i * digits], &a[(i - 1) * digits], &b[i * digits], m, digits);
+    }
+    status = bn_mod_inv(inv, &a[(count - 1) * digits], m, digits);
+    for (i = count - 1; i > 0; i--) {
+        bn_mod_mul(&a[i * digits], inv, &a[(i - 1) * digits], m, digits);
+        bn_mod_mul(inv, inv, &b[i * digits], m, digits);
+    }
+    bn_assign(a, inv, digits);
+    if (status != 0) {
+        bn_assign_zero(a, count * digits);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)inv, 0, digits * sizeof(bn_t));
+
+    return status;
+}
+
+/*
+ * The precomputed powers b^0 .. b^(entries-1) are stored interleaved: limb i
+ * of entry k lives at table[i * entries + k], so limb i of every entry shares
+ * one cache line. bn_gather() touches every entry for every limb, so the
+ * memory access pattern does not depend on the (secret) index.
+ */
+void bn_scatter(bn_t* table, uint32_t entries, bn_t* a, uint32_t index, uint32_t digits)
+{
+    uint32_t i;
+    for (i = 0; i < digits; i++) {
+        table[i * entries + index] = a[i];
+    }
+}
+
+void bn_gather(bn_t* a, bn_t* table, uint32_t entries, uint32_t index, uint32_t digits)
+{
+    bn_t acc, mask;
+    uint32_t i, k;
+
+    for (i = 0; i < digits; i++) {
+        acc = 0;
+        for (k = 0; k < entries; k++) {
+            mask = (bn_t)0 - (((k ^ index) - 1) >> (BN_DIGIT_BITS - 1));
+            acc |= table[i * entries + k] & mask;
+        }
+        a[i] = acc;
+    }
 }
 
 int bn_cmp(bn_t* a, bn_t* b, uint32_t digits)
@@ -467,6 +1214,356 @@ void montMul(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t*
     }
 }
 
+/* montgomery c[] = a[] * b[] / R % mod, product scanning; c may alias a or b */
+void montMulComba(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv)
+{
+    switch (digit) {
+    case 32:  mont_mul_comba_32(c, a, b, n, n0inv);         break;
+    case 48:  mont_mul_comba_48(c, a, b, n, n0inv);         break;
+    case 64:  mont_mul_comba_64(c, a, b, n, n0inv);         break;
+    case 96:  mont_mul_comba_96(c, a, b, n, n0inv);         break;
+    case 128: mont_mul_comba_128(c, a, b, n, n0inv);        break;
+    default:  comba_mont_mul(c, a, b, n, digit, n0inv, 0);  break;
+    }
+}
+
+/*
+ * almost montgomery c[] = a[] * b[] / R mod n, c < 2n for a, b < 2n, without
+ * any final subtraction; needs 4n <= R, e.g. n with a zero top digit
+ * counted in digit. c may alias a or b
+ */
+void montMulAlmost(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv)
+{
+    switch (digit) {
+    case 33:  mont_amm_comba_33(c, a, b, n, n0inv);         break;
+    case 49:  mont_amm_comba_49(c, a, b, n, n0inv);         break;
+    case 65:  mont_amm_comba_65(c, a, b, n, n0inv);         break;
+    case 97:  mont_amm_comba_97(c, a, b, n, n0inv);         break;
+    default:  comba_mont_mul(c, a, b, n, digit, n0inv, 1);  break;
+    }
+}
+
+/* two independent montgomery products in lockstep, both moduli digit long; each c may alias its a or b */
+void montMulComba2(uint32_t* c0, const uint32_t* a0, const uint32_t* b0, const uint32_t* n0, uint32_t n0inv0,
+                   uint32_t* c1, const uint32_t* a1, const uint32_t* b1, const uint32_t* n1, uint32_t n0inv1, uint32_t digit)
+{
+    switch (digit) {
+    case 32:  mont_mul2_comba_32(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1);         break;
+    case 48:  mont_mul2_comba_48(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1);         break;
+    case 64:  mont_mul2_comba_64(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1);         break;
+    case 96:  mont_mul2_comba_96(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1);         break;
+    case 128: mont_mul2_comba_128(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1);        break;
+    default:  comba_mont_mul2(c0, a0, b0, n0, n0inv0, c1, a1, b1, n1, n0inv1, digit);     break;
+    }
+}
+
+/*
+ * x86-64 BMI2/ADX kernel: CIOS Montgomery over 64-bit words (pairs of digits,
+ * little endian), fully unrolled for each supported length from 16 to 128
+ * words. Each row keeps two independent carry chains: ADOX adds the
+ * accumulator word, ADCX adds the high half of the previous MULX product.
+ */
+#if defined(__x86_64__) && defined(__GNUC__)
+
+// t[0 .. N+2) += x * v[0 .. N)
+#define MULX_ROW(tp, x, vp, N)                                                  \
+    __asm__ volatile(                                                           \
+        "xor %%r11d, %%r11d\n\t"                                                \
+        "xor %%r10d, %%r10d\n\t"                                                \
+        ".set .Lbn_j, 0\n\t"                                                    \
+        ".rept " #N "\n\t"                                                      \
+        "mulx .Lbn_j*8(%[v]), %%r8, %%r9\n\t"                                   \
+        "adox .Lbn_j*8(%[t]), %%r8\n\t"                                         \
+        "adcx %%r10, %%r8\n\t"                                                  \
+        "mov %%r8, .Lbn_j*8(%[t])\n\t"                                          \
+        "mov %%r9, %%r10\n\t"                                                   \
+        ".set .Lbn_j, .Lbn_j+1\n\t"                                             \
+        ".endr\n\t"                                                             \
+        "adox " #N "*8(%[t]), %%r10\n\t"                                        \
+        "adcx %%r11, %%r10\n\t"                                                 \
+        "mov %%r10, " #N "*8(%[t])\n\t"                                         \
+        "mov $0, %%r8d\n\t"                                                     \
+        "adox %%r11, %%r8\n\t"                                                  \
+        "adcx %%r11, %%r8\n\t"                                                  \
+        "add %%r8, (" #N "+1)*8(%[t])\n\t"                                      \
+        : : [t] "r" (tp), [v] "r" (vp), "d" (x)                                 \
+        : "r8", "r9", "r10", "r11", "cc", "memory")
+
+// t = (t + q * m) / 2^64, q chosen so the low word vanishes
+#define MULX_REDC_ROW(tp, q, mp, N)                                             \
+    __asm__ volatile(                                                           \
+        "xor %%r11d, %%r11d\n\t"                                                \
+        "xor %%r10d, %%r10d\n\t"                                                \
+        ".set .Lbn_j, 0\n\t"                                                    \
+        ".rept " #N "\n\t"                                                      \
+        "mulx .Lbn_j*8(%[m]), %%r8, %%r9\n\t"                                   \
+        "adox .Lbn_j*8(%[t]), %%r8\n\t"                                         \
+        "adcx %%r10, %%r8\n\t"                                                  \
+        ".if .Lbn_j\n\t"                                                        \
+        "mov %%r8, (.Lbn_j-1)*8(%[t])\n\t"                                      \
+        ".endif\n\t"                                                            \
+        "mov %%r9, %%r10\n\t"                                                   \
+        ".set .Lbn_j, .Lbn_j+1\n\t"                                             \
+        ".endr\n\t"                                                             \
+        "adox " #N "*8(%[t]), %%r10\n\t"                                        \
+        "adcx %%r11, %%r10\n\t"                                                 \
+        "mov %%r10, (" #N "-1)*8(%[t])\n\t"                                     \
+        "mov (" #N "+1)*8(%[t]), %%r8\n\t"                                      \
+        "adox %%r11, %%r8\n\t"                                                  \
+        "adcx %%r11, %%r8\n\t"                                                  \
+        "mov %%r8, " #N "*8(%[t])\n\t"                                          \
+        "movq $0, (" #N "+1)*8(%[t])\n\t"                                       \
+        : : [t] "r" (tp), [m] "r" (mp), "d" (q)                                 \
+        : "r8", "r9", "r10", "r11", "cc", "memory")
+
+#define BN_MULX_FIXED(N)                                                                            \
+static void mont_mul_mulx_##N(bn_t* c, const bn_t* a, const bn_t* b, const bn_t* n, uint64_t n0inv) \
+{                                                                                                   \
+    uint64_t t[N + 2], u[N], x, q, mask;                                                            \
+    dbn_t acc;                                                                                      \
+    bn_t borrow;                                                                                    \
+    uint32_t i;                                                                                     \
+                                                                                                    \
+    memset(t, 0, sizeof(t));                                                                        \
+    for (i = 0; i < N; i++) {                                                                       \
+        memcpy(&x, &a[2 * i], sizeof(x));                                                           \
+        MULX_ROW(t, x, b, N);                                                                       \
+        q = t[0] * n0inv;                                                                           \
+        MULX_REDC_ROW(t, q, n, N);                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    /* t < 2n: keep t - n unless it borrowed without a carry word */                               \
+    borrow = 0;                                                                                     \
+    for (i = 0; i < 2 * N; i++) {                                                                   \
+        acc = (dbn_t)((bn_t*)t)[i] - n[i] - borrow;                                                 \
+        ((bn_t*)u)[i] = (bn_t)acc;                                                                  \
+        borrow = (bn_t)(acc >> BN_DIGIT_BITS) & 1;                                                  \
+    }                                                                                               \
+    mask = (uint64_t)0 - (uint64_t)(borrow & ((bn_t)t[N] ^ 1));                                     \
+    for (i = 0; i < N; i++) {                                                                       \
+        x = (t[i] & mask) | (u[i] & ~mask);                                                         \
+        memcpy(&c[2 * i], &x, sizeof(x));                                                           \
+    }                                                                                               \
+                                                                                                    \
+    /* Clear potentially sensitive information */                                                   \
+    memset(t, 0, sizeof(t));                                                                        \
+    memset(u, 0, sizeof(u));                                                                        \
+}
+
+BN_MULX_FIXED(16)
+BN_MULX_FIXED(24)
+BN_MULX_FIXED(32)
+BN_MULX_FIXED(48)
+BN_MULX_FIXED(64)
+BN_MULX_FIXED(128)
+
+int bn_mulx_supported(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+}
+
+#else
+
+int bn_mulx_supported(void)
+{
+    return 0;
+}
+
+#endif
+
+/* montgomery c[] = a[] * b[] / R % mod with MULX/ADX for digit 32, 48, 64, 96, 128 or 256, montMulComba otherwise (see bn_mulx_supported); c may alias a or b */
+void montMulMulx(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv)
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+    uint64_t m0, inv;
+
+    // -n^-1 mod 2^64, lifted from the 32-bit constant by one Newton step
+    m0 = (uint64_t)n[0] | ((uint64_t)n[1] << 32);
+    inv = (uint32_t)(0 - n0inv);
+    inv *= 2 - m0 * inv;
+    inv = (uint64_t)0 - inv;
+
+    switch (digit) {
+    case 32:  mont_mul_mulx_16(c, a, b, n, inv);            return;
+    case 48:  mont_mul_mulx_24(c, a, b, n, inv);            return;
+    case 64:  mont_mul_mulx_32(c, a, b, n, inv);            return;
+    case 96:  mont_mul_mulx_48(c, a, b, n, inv);            return;
+    case 128: mont_mul_mulx_64(c, a, b, n, inv);            return;
+    case 256: mont_mul_mulx_128(c, a, b, n, inv);           return;
+    default:  break;
+    }
+#endif
+    montMulComba(c, a, b, n, digit, n0inv);
+}
+
+/* returns -m0^-1 mod 2^32 for odd m0 (Newton iteration, 5 steps from 1 bit) */
+bn_t bn_mont_n0inv(bn_t m0)
+{
+    bn_t x = m0;
+    int i;
+    for (i = 0; i < 5; i++) {
+        x *= 2 - m0 * x;
+    }
+    return (bn_t)0 - x;
+}
+
+/* rr = R^2 mod m, one = R mod m, R = 2^(32 * digits) */
+void bn_mont_setup(bn_t* rr, bn_t* one, bn_t* m, uint32_t digits)
+{
+    bn_t t[2 * BN_MAX_DIGITS + 1];
+
+    bn_assign_zero(t, digits);
+    t[digits] = 1;
+    bn_mod(one, t, digits + 1, m, digits);
+
+    bn_assign_zero(t, 2 * digits);
+    t[2 * digits] = 1;
+    bn_mod(rr, t, 2 * digits + 1, m, digits);
+}
+
+/*
+ * ninv = -m^-1 mod R, R = 2^(32 * digits), for odd m: Newton iteration
+ * x = x * (2 - m * x) mod R doubles the correct low digits of x = m^-1 each
+ * step, starting from the one-digit inverse behind bn_mont_n0inv
+ */
+void bn_mont_ninv(bn_t* ninv, bn_t* m, uint32_t digits)
+{
+    bn_t x[BN_MAX_DIGITS], t[2 * BN_MAX_DIGITS];
+    uint32_t good;
+
+    bn_assign_zero(x, digits);
+    x[0] = (bn_t)0 - bn_mont_n0inv(m[0]);
+    for (good = 1; good < digits; good *= 2) {
+        bn_mul_fast(t, m, x, digits, BN_KARATSUBA_CUTOFF);
+        BN_ASSIGN_DIGIT(ninv, 2, digits);
+        bn_sub(t, ninv, t, digits);
+        bn_mul_fast(t, x, t, digits, BN_KARATSUBA_CUTOFF);
+        bn_assign(x, t, digits);
+    }
+    bn_assign_zero(ninv, digits);
+    bn_sub(ninv, ninv, x, digits);
+}
+
+#if defined(__SIZEOF_INT128__)
+/*
+ * comba_redc over 64-bit words (pairs of digits) with 128-bit products, a
+ * quarter of the multiplications; reduction rows go word by word (operand
+ * scanning) since a standalone REDC has no a*b terms to fill the columns.
+ * digits must be even.
+ */
+static void redc_words(bn_t* c, const bn_t* t, const bn_t* n, uint32_t digits, bn_t n0inv)
+{
+    uint64_t w[BN_MAX_DIGITS + 1], m[BN_MAX_DIGITS / 2 + 1], u[BN_MAX_DIGITS / 2 + 1];
+    uint64_t q, inv, carry, top, borrow, mask;
+    unsigned __int128 acc;
+    uint32_t words = digits / 2, i, j;
+
+    for (i = 0; i < 2 * words; i++) {
+        w[i] = (uint64_t)t[2 * i] | ((uint64_t)t[2 * i + 1] << BN_DIGIT_BITS);
+    }
+    for (i = 0; i < words; i++) {
+        m[i] = (uint64_t)n[2 * i] | ((uint64_t)n[2 * i + 1] << BN_DIGIT_BITS);
+    }
+
+    // -n^-1 mod 2^64, lifted from the 32-bit constant by one Newton step
+    inv = (bn_t)(0 - n0inv);
+    inv *= 2 - m[0] * inv;
+    inv = (uint64_t)0 - inv;
+
+    top = 0;
+    for (i = 0; i < words; i++) {
+        q = w[i] * inv;
+        carry = 0;
+        for (j = 0; j < words; j++) {
+            acc = (unsigned __int128)q * m[j] + w[i + j] + carry;
+            w[i + j] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+        acc = (unsigned __int128)w[i + words] + carry + top;
+        w[i + words] = (uint64_t)acc;
+        top = (uint64_t)(acc >> 64);
+    }
+
+    // w + top * R < 2n: keep w - n unless it borrowed without a carry
+    borrow = 0;
+    for (i = 0; i < words; i++) {
+        acc = (unsigned __int128)w[words + i] - m[i] - borrow;
+        u[i] = (uint64_t)acc;
+        borrow = (uint64_t)(acc >> 64) & 1;
+    }
+    mask = (uint64_t)0 - (borrow & (top ^ 1));
+    for (i = 0; i < words; i++) {
+        q = (w[words + i] & mask) | (u[i] & ~mask);
+        c[2 * i] = (bn_t)q;
+        c[2 * i + 1] = (bn_t)(q >> BN_DIGIT_BITS);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)w, 0, 2 * words * sizeof(uint64_t));
+    memset((uint8_t*)u, 0, words * sizeof(uint64_t));
+}
+#endif
+
+/* a = t / R mod m for t < m * R, t 2 * digits long; a may alias t */
+void bn_mont_redc(bn_t* a, bn_t* t, bn_t* m, uint32_t digits, bn_t n0inv)
+{
+#if defined(__SIZEOF_INT128__)
+    if ((digits & 1) == 0) {
+        redc_words(a, t, m, digits, n0inv);
+        return;
+    }
+#endif
+    comba_redc(a, t, m, digits, n0inv);
+}
+
+/*
+ * Montgomery a = b * c / R mod m, separated: the full product first, by
+ * Karatsuba down to cutoff digits (squaring leaves when b == c), then
+ * bn_mont_redc. Unlike the interleaved kernels this gains from Karatsuba;
+ * a may alias b or c.
+ */
+void bn_mont_mul_sos(bn_t* a, bn_t* b, bn_t* c, bn_t* m, bn_t n0inv, uint32_t digits, uint32_t cutoff)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    mul_rec(t, b, c, digits, cutoff);
+    bn_mont_redc(a, t, m, digits, n0inv);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+}
+
+/*
+ * Montgomery a = b * c / R mod m with separate full products (REDC):
+ * t = b * c, q = (t mod R) * ninv mod R, a = (t + q * m) / R, then one masked
+ * subtraction. All three products go through bn_mul_fast, so for long
+ * moduli the reduction is as sub-quadratic as the multiplication.
+ * ninv from bn_mont_ninv; a may alias b or c.
+ */
+void bn_mont_mul_redc(bn_t* a, bn_t* b, bn_t* c, bn_t* m, bn_t* ninv, uint32_t digits, uint32_t cutoff)
+{
+    bn_t t[2 * BN_MAX_DIGITS], q[2 * BN_MAX_DIGITS], u[2 * BN_MAX_DIGITS], carry, borrow, mask;
+    uint32_t i;
+
+    mul_rec(t, b, c, digits, cutoff);
+    mul_rec(q, t, ninv, digits, cutoff);
+    mul_rec(u, q, m, digits, cutoff);
+    carry = bn_add(t, t, u, 2 * digits);
+
+    // t / R + carry * R < 2m: keep it minus m unless that borrowed without a carry
+    borrow = bn_sub(u, &t[digits], m, digits);
+    mask = (bn_t)0 - (borrow & (carry ^ 1));
+    for (i = 0; i < digits; i++) {
+        a[i] = (t[digits + i] & mask) | (u[i] & ~mask);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * digits * sizeof(bn_t));
+    memset((uint8_t*)q, 0, 2 * digits * sizeof(bn_t));
+    memset((uint8_t*)u, 0, 2 * digits * sizeof(bn_t));
+}
+
 /*void ciosmonMult(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv)
 {
     int i;
@@ -13,7 +13,10 @@ typedef uint64_t dbn_t;
 typedef uint32_t bn_t;
 
 #define BN_DIGIT_BITS               32      // For uint32_t
-#define BN_MAX_DIGITS              129      // RSA_MAX_MODULUS_LEN + 1
+#ifndef RSA_MAX_MODULUS_BITS
+#define RSA_MAX_MODULUS_BITS      4096      // as in rsa.h
+#endif
+#define BN_MAX_DIGITS               ((RSA_MAX_MODULUS_BITS + 7) / 8 / 4 + 1)   // RSA_MAX_MODULUS_LEN / 4 + 1
 
 #define BN_MAX_DIGIT                0xFFFFFFFF
 
@@ -21,6 +24,14 @@ typedef uint32_t bn_t;
 #define DIGIT_4MSB(x)               (uint32_t)(((x) >> (BN_DIGIT_BITS - 4)) & 0x0f)
 #define DIGIT_2MSB(x)               (uint32_t)(((x) >> (BN_DIGIT_BITS - 2)) & 0x03)
 
+// Fixed-window exponentiation: 2^BN_EXP_WINDOW_BITS precomputed powers
+#define BN_EXP_WINDOW_BITS          4
+
+// Karatsuba splits operands of at least this many digits (tunable per size),
+// Toom-3 those of at least BN_TOOM3_CUTOFF
+#define BN_KARATSUBA_CUTOFF         32
+#define BN_TOOM3_CUTOFF             192
+
 
 void bn_decode(bn_t* bn, uint32_t digits, uint8_t* hexarr, uint32_t size);
 void bn_encode(uint8_t* hexarr, uint32_t size, bn_t* bn, uint32_t digits);
@@ -32,13 +43,25 @@ void bn_assign_one(bn_t* a, uint32_t digits);
 bn_t bn_add(bn_t* a, bn_t* b, bn_t* c, uint32_t digits);                                    // a = b + c, return carry
 bn_t bn_sub(bn_t* a, bn_t* b, bn_t* c, uint32_t digits);                                    // a = b - c, return borrow
 void bn_mul(bn_t* a, bn_t* b, bn_t* c, uint32_t digits);                                    // a = b * c
+void bn_mul_comba(bn_t* a, bn_t* b, bn_t* c, uint32_t digits);                              // a = b * c, product scanning
+void bn_sqr(bn_t* a, bn_t* b, uint32_t digits);                                             // a = b * b, product scanning
+void bn_mul_karatsuba(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff);         // a = b * c, Comba below cutoff digits
+void bn_mul_toom3(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff);             // a = b * c, one Toom-3 split on top
+void bn_mul_fast(bn_t* a, bn_t* b, bn_t* c, uint32_t digits, uint32_t cutoff);              // a = b * c, Comba, Karatsuba or Toom-3 by size
 void bn_div(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t ddigits);        // a = b / c, d = b % c
 bn_t bn_shift_l(bn_t* a, bn_t* b, uint32_t c, uint32_t digits);                             // a = b << c (a = b * 2^c)
 bn_t bn_shift_r(bn_t* a, bn_t* b, uint32_t c, uint32_t digits);                             // a = b >> c (a = b / 2^c)
 
 void bn_mod(bn_t* a, bn_t* b, uint32_t bdigits, bn_t* c, uint32_t cdigits);                 // a = b mod c
 void bn_mod_mul(bn_t* a, bn_t* b, bn_t* c, bn_t* d, uint32_t digits);                       // a = b * c mod d
-void bn_mod_exp(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t ddigits);    // a = b ^ c mod d
+// bn_mod_inv is constant time for odd m only. An even m (e.g. e^-1 mod phi)
+// takes a division whose run time depends on b: not for secret b, and only
+// for offline work such as key generation when m is secret
+int bn_mod_inv(bn_t* a, bn_t* b, bn_t* m, uint32_t digits);                                 // a = b^-1 mod m, b < m; 0, or -1 if none
+int bn_mod_inv_batch(bn_t* a, bn_t* b, uint32_t count, bn_t* m, uint32_t digits);           // a_i = b_i^-1 mod m for count values of digits each
+
+void bn_scatter(bn_t* table, uint32_t entries, bn_t* a, uint32_t index, uint32_t digits);   // entry index of interleaved table = a
+void bn_gather(bn_t* a, bn_t* table, uint32_t entries, uint32_t index, uint32_t digits);    // a = entry index, reads every entry
 
 int bn_cmp(bn_t* a, bn_t* b, uint32_t digits);                                              // returns sign of a - b
 
@@ -47,11 +70,24 @@ uint32_t bn_digits(bn_t* a, uint32_t digits);
 
 //ɸĺ
 void montMulAdd(uint32_t* c, const uint32_t a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
-void subM(uint32_t* a, const uint32_t* n, uint32_t digit, uint32_t n0inv);
+void subM(uint32_t* a, const uint32_t* n, uint32_t digit);
 int geM(const uint32_t* a, const uint32_t* n, uint32_t digit, uint32_t n0inv);
 void printnum(const uint32_t* a, char* name, const uint32_t* n, uint32_t digit, uint32_t n0inv);
 void montMulAdd(uint32_t* c, const uint32_t a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
 void montMul(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
+void montMulComba(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
+void montMulAlmost(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);  // c < 2n, no final subtraction
+void montMulComba2(uint32_t* c0, const uint32_t* a0, const uint32_t* b0, const uint32_t* n0, uint32_t n0inv0,
+                   uint32_t* c1, const uint32_t* a1, const uint32_t* b1, const uint32_t* n1, uint32_t n0inv1, uint32_t digit);
+void montMulMulx(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
+int bn_mulx_supported(void);                                                                // BMI2 and ADX present, montMulMulx usable
+
+bn_t bn_mont_n0inv(bn_t m0);                                                                // returns -m0^-1 mod 2^32
+void bn_mont_setup(bn_t* rr, bn_t* one, bn_t* m, uint32_t digits);                          // rr = R^2 mod m, one = R mod m
+void bn_mont_ninv(bn_t* ninv, bn_t* m, uint32_t digits);                                    // ninv = -m^-1 mod R
+void bn_mont_mul_redc(bn_t* a, bn_t* b, bn_t* c, bn_t* m, bn_t* ninv, uint32_t digits, uint32_t cutoff);  // a = b * c / R mod m by bn_mul_fast
+void bn_mont_redc(bn_t* a, bn_t* t, bn_t* m, uint32_t digits, bn_t n0inv);                  // a = t / R mod m, t < m * R of 2 * digits
+void bn_mont_mul_sos(bn_t* a, bn_t* b, bn_t* c, bn_t* m, bn_t n0inv, uint32_t digits, uint32_t cutoff);  // Karatsuba product, then bn_mont_redc
 void Bn_mod_exp(bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits, bn_t* d, uint32_t digits, uint32_t inv, bn_t* rr);
 void ciosmonMult(uint32_t* c, const uint32_t* a, const uint32_t* b, const uint32_t* n, uint32_t digit, uint32_t n0inv);
 
@@ -0,0 +1,812 @@
+/*****************************************************************************
+Filename    : bn_engine.c
+Date        : 2026-10-19
+Description : Registry of modular multiplication engines, a fixed-window
+              exponentiation shared by all of them, and a microbenchmark
+              that picks engine and Karatsuba cutoff per size.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bn_engine.h"
+
+/*
+ * classic: full product (Comba, Karatsuba or Toom-3) followed by a long division
+ */
+static void classic_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    if (mod->digits >= mod->cutoff) {
+        bn_mul_fast(t, b, c, mod->digits, mod->cutoff);
+    }
+    else {
+        bn_mul_comba(t, b, c, mod->digits);
+    }
+    bn_mod(a, t, 2 * mod->digits, mod->m, mod->digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * mod->digits * sizeof(bn_t));
+}
+
+static void classic_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+
+    if (mod->digits >= mod->cutoff) {
+        bn_mul_fast(t, b, b, mod->digits, mod->cutoff);
+    }
+    else {
+        bn_sqr(t, b, mod->digits);
+    }
+    bn_mod(a, t, 2 * mod->digits, mod->m, mod->digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, 2 * mod->digits * sizeof(bn_t));
+}
+
+/*
+ * cios: word-by-word interleaved Montgomery (montMul), which needs an output
+ * distinct from its inputs
+ */
+static void cios_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    bn_t t[BN_MAX_DIGITS];
+
+    montMul(t, b, c, mod->m, mod->digits, mod->n0inv);
+    bn_assign(a, t, mod->digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)t, 0, mod->digits * sizeof(bn_t));
+}
+
+static void cios_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    cios_mul(a, b, b, mod);
+}
+
+/*
+ * comba: product-scanning Montgomery (montMulComba)
+ */
+static void comba_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    montMulComba(a, b, c, mod->m, mod->digits, mod->n0inv);
+}
+
+static void comba_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    montMulComba(a, b, b, mod->m, mod->digits, mod->n0inv);
+}
+
+static void comba_mul2(bn_t* a0, bn_t* b0, bn_t* c0, const bn_modulus_t* mod0,
+                       bn_t* a1, bn_t* b1, bn_t* c1, const bn_modulus_t* mod1)
+{
+    montMulComba2(a0, b0, c0, mod0->m, mod0->n0inv, a1, b1, c1, mod1->m, mod1->n0inv, mod0->digits);
+}
+
+/*
+ * mulx: 64-bit word CIOS with MULX/ADCX/ADOX (montMulMulx), 1024- and
+ * 2048-bit moduli on BMI2/ADX hosts
+ */
+static void mulx_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    montMulMulx(a, b, c, mod->m, mod->digits, mod->n0inv);
+}
+
+static void mulx_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    montMulMulx(a, b, b, mod->m, mod->digits, mod->n0inv);
+}
+
+static int mulx_supports(uint32_t digits)
+{
+    return (digits == 32 || digits == 48 || digits == 64 || digits == 96 || digits == 128 || digits == 256) &&
+           digits < BN_MAX_DIGITS && bn_mulx_supported();
+}
+
+/*
+ * amm: product-scanning almost Montgomery (montMulAlmost), no per-step
+ * subtraction; runs one digit longer than the modulus (see bn_engine_exp)
+ */
+static void amm_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    montMulAlmost(a, b, c, mod->m, mod->digits, mod->n0inv);
+}
+
+static void amm_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    montMulAlmost(a, b, b, mod->m, mod->digits, mod->n0inv);
+}
+
+static int amm_supports(uint32_t digits)
+{
+    return digits + 1 < BN_MAX_DIGITS;
+}
+
+/*
+ * redc: Montgomery reduction by full products (bn_mont_mul_redc), so it
+ * gets Karatsuba and Toom-3 too; for 4096-bit and longer moduli
+ */
+static void redc_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    bn_mont_mul_redc(a, b, c, mod->m, mod->ninv, mod->digits, mod->cutoff);
+}
+
+static void redc_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    bn_mont_mul_redc(a, b, b, mod->m, mod->ninv, mod->digits, mod->cutoff);
+}
+
+/*
+ * sos: separated operand scanning, the full Karatsuba product (or square) and
+ * then a standalone REDC (bn_mont_mul_sos)
+ */
+static void sos_mul(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod)
+{
+    bn_mont_mul_sos(a, b, c, mod->m, mod->n0inv, mod->digits, mod->cutoff);
+}
+
+static void sos_sqr(bn_t* a, bn_t* b, const bn_modulus_t* mod)
+{
+    bn_mont_mul_sos(a, b, b, mod->m, mod->n0inv, mod->digits, mod->cutoff);
+}
+
+static const bn_engine_t engines[] = {
+    { "mulx",       1,  mulx_mul,       mulx_sqr,       mulx_supports,  NULL,       0,  0 },
+    { "comba",      1,  comba_mul,      comba_sqr,      NULL,           comba_mul2, 0,  0 },
+    { "amm",        1,  amm_mul,        amm_sqr,        amm_supports,   NULL,       1,  0 },
+    { "redc",       1,  redc_mul,       redc_sqr,       NULL,           NULL,       0,  1 },
+    { "sos",        1,  sos_mul,        sos_sqr,        NULL,           NULL,       0,  0 },
+    { "cios",       1,  cios_mul,       cios_sqr,       NULL,           NULL,       0,  0 },
+    { "classic",    0,  classic_mul,    classic_sqr,    NULL,           NULL,       0,  0 },
+};
+
+#define ENGINE_REDC     3
+#define ENGINE_SOS      4
+
+#define ENGINE_COUNT    (sizeof(engines) / sizeof(engines[0]))
+
+uint32_t bn_engine_count(void)
+{
+    return ENGINE_COUNT;
+}
+
+const bn_engine_t *bn_engine_at(uint32_t index)
+{
+    return index < ENGINE_COUNT ? &engines[index] : NULL;
+}
+
+const bn_engine_t *bn_engine_find(const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < ENGINE_COUNT; i++) {
+        if (strcmp(engines[i].name, name) == 0) {
+            return &engines[i];
+        }
+    }
+    return NULL;
+}
+
+int bn_engine_supports(const bn_engine_t *engine, uint32_t digits)
+{
+    return engine->supports == NULL || engine->supports(digits);
+}
+
+// window bits of c starting at bit pos
+static uint32_t exp_bits(bn_t* c, uint32_t cdigits, uint32_t pos, uint32_t window)
+{
+    uint32_t i = pos / BN_DIGIT_BITS, s = pos % BN_DIGIT_BITS;
+    bn_t v = c[i] >> s;
+
+    if (s + window > BN_DIGIT_BITS && i + 1 < cdigits) {
+        v |= c[i + 1] << (BN_DIGIT_BITS - s);
+    }
+    return v & ((1u << window) - 1);
+}
+
+static uint32_t exp_windows(bn_t* c, uint32_t cdigits, uint32_t window)
+{
+    uint32_t nbits, k;
+
+    nbits = cdigits ? (cdigits - 1) * BN_DIGIT_BITS : 0;
+    if (cdigits) {
+        for (k = c[cdigits - 1]; k; k >>= 1) {
+            nbits++;
+        }
+    }
+    return (nbits + window - 1) / window;
+}
+
+/*
+ * Cost of the table (2^window - 2 multiplications) plus, per window, window
+ * squarings, one multiplication and a gather reading all 2^window entries;
+ * products count digits^2, gathers 2^window * digits.
+ */
+uint32_t bn_exp_window(bn_t* c, uint32_t cdigits, uint32_t digits)
+{
+    uint64_t cost, best = UINT64_MAX, mul = (uint64_t)digits * digits;
+    uint32_t window, nwin, choice = BN_EXP_WINDOW_BITS;
+
+    cdigits = bn_digits(c, cdigits);
+    for (window = 2; window <= BN_ENGINE_MAX_WINDOW_BITS; window++) {
+        nwin = exp_windows(c, cdigits, window);
+        cost = ((1u << window) - 2) * mul + nwin * ((window + 1) * mul + (1u << window) * digits);
+        if (cost < best) {
+            best = cost;
+            choice = window;
+        }
+    }
+    return choice;
+}
+
+uint32_t bn_exp_recode(uint8_t* win, uint32_t max, bn_t* c, uint32_t cdigits, uint32_t window)
+{
+    uint32_t nwin, w;
+
+    cdigits = bn_digits(c, cdigits);
+    nwin = exp_windows(c, cdigits, window);
+    if (nwin > max) {
+        return 0;
+    }
+    for (w = 0; w < nwin; w++) {
+        win[w] = (uint8_t)exp_bits(c, cdigits, (nwin - 1 - w) * window, window);
+    }
+    return nwin;
+}
+
+/*
+ * The constants follow from the caller's ones without a full reduction:
+ * with k zero limbs added, R'^2 = R^2 * 2^(64k) and R' = R * 2^(32k), each
+ * one short division mod m. wide may be mod.
+ */
+void bn_engine_widen(bn_modulus_t* wide, bn_t* m, bn_t* rr, bn_t* one,
+                     const bn_modulus_t* mod, bn_t* mod_rr, bn_t* mod_one, uint32_t width)
+{
+    bn_t t[2 * BN_MAX_DIGITS];
+    uint32_t digits = mod->digits, k = width - digits;
+
+    bn_assign_zero(t, 2 * k);
+    bn_assign(&t[2 * k], mod_rr, digits);
+    bn_mod(rr, t, digits + 2 * k, mod->m, digits);
+    bn_assign_zero(&rr[digits], k);
+
+    bn_assign_zero(t, k);
+    bn_assign(&t[k], mod_one, digits);
+    bn_mod(one, t, digits + k, mod->m, digits);
+    bn_assign_zero(&one[digits], k);
+
+    bn_assign(m, mod->m, digits);
+    bn_assign_zero(&m[digits], k);
+    *wide = *mod;
+    wide->m = m;
+    wide->digits = width;
+}
+
+// Shortest length from digits on, at most BN_ENGINE_MAX_PAD longer, that the
+// engine runs (an even one if even is set); 0 if there is none
+static uint32_t engine_width(const bn_engine_t* engine, uint32_t digits, int even)
+{
+    uint32_t width;
+
+    for (width = digits; width <= digits + BN_ENGINE_MAX_PAD(digits) && width < BN_MAX_DIGITS; width++) {
+        if ((!even || (width & 1) == 0) && bn_engine_supports(engine, width)) {
+            return width;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Left-to-right square and multiply for public exponents such as 65537: no
+ * table and no dummy multiplications, so the run time depends on c. Lazy
+ * and wide engines need bn_engine_exp()'s setup and go through it.
+ */
+void bn_engine_exp_public(const bn_engine_t* engine, bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits,
+                          const bn_modulus_t* mod, bn_t* rr, bn_t* one)
+{
+    bn_t bm[BN_MAX_DIGITS], t[BN_MAX_DIGITS];
+    uint32_t digits = mod->digits, nbits, k;
+
+    if (engine->lazy || engine->wide) {
+        bn_engine_exp(engine, BN_EXP_WINDOW_BITS, a, b, c, cdigits, mod, rr, one);
+        return;
+    }
+
+    cdigits = bn_digits(c, cdigits);
+    nbits = exp_windows(c, cdigits, 1);
+    if (nbits == 0) {
+        bn_assign_one(a, digits);
+        return;
+    }
+
+    if (engine->montgomery) {
+        engine->mul(bm, b, rr, mod);
+    }
+    else {
+        bn_assign(bm, b, digits);
+    }
+    bn_assign(t, bm, digits);
+    for (k = nbits - 1; k > 0; k--) {
+        engine->sqr(t, t, mod);
+        if (exp_bits(c, cdigits, k - 1, 1)) {
+            engine->mul(t, t, bm, mod);
+        }
+    }
+
+    if (engine->montgomery) {
+        bn_assign_one(bm, digits);
+        engine->mul(t, t, bm, mod);
+        if (bn_cmp(t, mod->m, digits) >= 0) {
+            bn_sub(t, t, mod->m, digits);
+        }
+    }
+    bn_assign(a, t, digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)bm, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)t, 0, digits * sizeof(bn_t));
+}
+
+void bn_engine_exp(const bn_engine_t* engine, uint32_t window, bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits,
+                   const bn_modulus_t* mod, bn_t* rr, bn_t* one)
+{
+    uint8_t win[BN_MAX_DIGITS * BN_DIGIT_BITS];
+    uint32_t nwin;
+
+    if (window < 1 || window > BN_ENGINE_MAX_WINDOW_BITS) {
+        window = BN_EXP_WINDOW_BITS;
+    }
+    nwin = bn_exp_recode(win, sizeof(win), c, cdigits, window);
+    bn_engine_exp_win(engine, window, a, b, win, nwin, mod, rr, one);
+
+    // Clear potentially sensitive information
+    memset(win, 0, nwin);
+}
+
+/*
+ * Every window costs window squarings and one multiplication by a gathered
+ * table entry, including all-zero windows.
+ */
+void bn_engine_exp_win(const bn_engine_t* engine, uint32_t window, bn_t* a, bn_t* b, const uint8_t* win, uint32_t nwin,
+                       const bn_modulus_t* mod, bn_t* rr, bn_t* one)
+{
+    bn_t table[(1 << BN_ENGINE_MAX_WINDOW_BITS) * BN_MAX_DIGITS] __attribute__((aligned(64)));
+    bn_t bm[BN_MAX_DIGITS], bpower[BN_MAX_DIGITS], t[BN_MAX_DIGITS];
+    bn_t lazy_m[BN_MAX_DIGITS], lazy_rr[BN_MAX_DIGITS], lazy_one[BN_MAX_DIGITS], ninv[BN_MAX_DIGITS];
+    bn_modulus_t lazy_mod, wide_mod;
+    uint32_t digits = mod->digits, out_digits = mod->digits, entries = 1u << window, w, k;
+
+    bn_assign(bpower, b, digits);
+    if (engine->lazy && (mod->m[digits - 1] >> (BN_DIGIT_BITS - 2)) != 0) {
+        // m with a zero top digit, so R' = 2^32 R > 4m
+        bn_engine_widen(&lazy_mod, lazy_m, lazy_rr, lazy_one, mod, rr, one, digits + 1);
+        mod = &lazy_mod;
+        rr = lazy_rr;
+        one = lazy_one;
+        bpower[digits++] = 0;
+    }
+    if (engine->wide) {
+        bn_mont_ninv(ninv, mod->m, digits);
+        wide_mod = *mod;
+        wide_mod.ninv = ninv;
+        mod = &wide_mod;
+    }
+
+    if (engine->montgomery) {
+        engine->mul(bm, bpower, rr, mod);
+        bn_assign(t, one, digits);
+    }
+    else {
+        bn_assign(bm, b, digits);
+        bn_assign_one(t, digits);
+    }
+    bn_scatter(table, entries, t, 0, digits);
+    bn_scatter(table, entries, bm, 1, digits);
+    bn_assign(bpower, bm, digits);
+    for (k = 2; k < entries; k++) {
+        engine->mul(bpower, bpower, bm, mod);
+        bn_scatter(table, entries, bpower, k, digits);
+    }
+
+    for (w = 0; w < nwin; w++) {
+        bn_gather(bpower, table, entries, win[w], digits);
+        if (w == 0) {
+            bn_assign(t, bpower, digits);
+            continue;
+        }
+        for (k = 0; k < window; k++) {
+            engine->sqr(t, t, mod);
+        }
+        engine->mul(t, t, bpower, mod);
+    }
+
+    if (engine->montgomery) {
+        // Leave the Montgomery domain: t * 1 / R <= m, then fully reduce;
+        // for lazy engines this is the only subtraction of the whole run
+        bn_assign_one(bpower, digits);
+        engine->mul(t, t, bpower, mod);
+        if (bn_cmp(t, mod->m, digits) >= 0) {
+            bn_sub(t, t, mod->m, digits);
+        }
+    }
+    bn_assign(a, t, out_digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)table, 0, entries * digits * sizeof(bn_t));
+    memset((uint8_t*)bm, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)bpower, 0, digits * sizeof(bn_t));
+    memset((uint8_t*)t, 0, digits * sizeof(bn_t));
+    if (engine->lazy) {
+        memset((uint8_t*)lazy_m, 0, digits * sizeof(bn_t));
+        memset((uint8_t*)lazy_rr, 0, digits * sizeof(bn_t));
+        memset((uint8_t*)lazy_one, 0, digits * sizeof(bn_t));
+    }
+}
+
+/*
+ * bn_engine_exp for two moduli of one length. The shorter exponent is padded
+ * with leading zero windows, which only multiply by the table entry for 1.
+ */
+void bn_engine_exp2(const bn_engine_t* engine, uint32_t window, bn_exp_lane_t lane[2])
+{
+    bn_t table[2][(1 << BN_ENGINE_MAX_WINDOW_BITS) * BN_MAX_DIGITS] __attribute__((aligned(64)));
+    bn_t bm[2][BN_MAX_DIGITS], bpower[2][BN_MAX_DIGITS], t[2][BN_MAX_DIGITS];
+    uint8_t recoded[2][BN_MAX_DIGITS * BN_DIGIT_BITS];
+    const uint8_t *win[2];
+    uint32_t digits, nwins[2], entries, nwin, w, k, l;
+
+    if (window < 1 || window > BN_ENGINE_MAX_WINDOW_BITS) {
+        window = BN_EXP_WINDOW_BITS;
+    }
+    nwin = 0;
+    for (l = 0; l < 2; l++) {
+        if (lane[l].win != NULL) {
+            win[l] = lane[l].win;
+            nwins[l] = lane[l].nwin;
+        }
+        else {
+            nwins[l] = bn_exp_recode(recoded[l], sizeof(recoded[l]), lane[l].c, lane[l].cdigits, window);
+            win[l] = recoded[l];
+        }
+        nwin = nwins[l] > nwin ? nwins[l] : nwin;
+    }
+
+    if (engine->mul2 == NULL || lane[0].mod->digits != lane[1].mod->digits) {
+        for (l = 0; l < 2; l++) {
+            bn_engine_exp_win(engine, window, lane[l].a, lane[l].b, win[l], nwins[l],
+                              lane[l].mod, lane[l].rr, lane[l].one);
+            if (win[l] == recoded[l]) {
+                memset(recoded[l], 0, nwins[l]);
+            }
+        }
+        return;
+    }
+    entries = 1u << window;
+    digits = lane[0].mod->digits;
+
+    for (l = 0; l < 2; l++) {
+        if (engine->montgomery) {
+            bn_assign(t[l], lane[l].one, digits);
+        }
+        else {
+            bn_assign(bm[l], lane[l].b, digits);
+            bn_assign_one(t[l], digits);
+        }
+    }
+    if (engine->montgomery) {
+        engine->mul2(bm[0], lane[0].b, lane[0].rr, lane[0].mod, bm[1], lane[1].b, lane[1].rr, lane[1].mod);
+    }
+    for (l = 0; l < 2; l++) {
+        bn_scatter(table[l], entries, t[l], 0, digits);
+        bn_scatter(table[l], entries, bm[l], 1, digits);
+        bn_assign(bpower[l], bm[l], digits);
+    }
+    for (k = 2; k < entries; k++) {
+        engine->mul2(bpower[0], bpower[0], bm[0], lane[0].mod, bpower[1], bpower[1], bm[1], lane[1].mod);
+        bn_scatter(table[0], entries, bpower[0], k, digits);
+        bn_scatter(table[1], entries, bpower[1], k, digits);
+    }
+
+    for (w = nwin; w > 0; w--) {
+        for (l = 0; l < 2; l++) {
+            k = w <= nwins[l] ? win[l][nwins[l] - w] : 0;
+            bn_gather(bpower[l], table[l], entries, k, digits);
+        }
+        if (w == nwin) {
+            bn_assign(t[0], bpower[0], digits);
+            bn_assign(t[1], bpower[1], digits);
+            continue;
+        }
+        for (k = 0; k < window; k++) {
+            engine->mul2(t[0], t[0], t[0], lane[0].mod, t[1], t[1], t[1], lane[1].mod);
+        }
+        engine->mul2(t[0], t[0], bpower[0], lane[0].mod, t[1], t[1], bpower[1], lane[1].mod);
+    }
+
+    if (engine->montgomery) {
+        // Leave the Montgomery domain: a = t * 1 / R, then fully reduce
+        bn_assign_one(bpower[0], digits);
+        engine->mul2(lane[0].a, t[0], bpower[0], lane[0].mod, lane[1].a, t[1], bpower[0], lane[1].mod);
+        for (l = 0; l < 2; l++) {
+            if (bn_cmp(lane[l].a, lane[l].mod->m, digits) >= 0) {
+                bn_sub(lane[l].a, lane[l].a, lane[l].mod->m, digits);
+            }
+        }
+    }
+    else {
+        bn_assign(lane[0].a, t[0], digits);
+        bn_assign(lane[1].a, t[1], digits);
+    }
+
+    // Clear potentially sensitive information
+    for (l = 0; l < 2; l++) {
+        memset((uint8_t*)table[l], 0, entries * digits * sizeof(bn_t));
+        memset((uint8_t*)bm[l], 0, digits * sizeof(bn_t));
+        memset((uint8_t*)bpower[l], 0, digits * sizeof(bn_t));
+        memset((uint8_t*)t[l], 0, digits * sizeof(bn_t));
+        if (win[l] == recoded[l]) {
+            memset(recoded[l], 0, nwins[l]);
+        }
+    }
+}
+
+/*
+ * Tuning
+ */
+static bn_tune_t tune_table[BN_TUNE_MAX_SIZES];
+static uint32_t tune_count;
+
+void bn_tune_lookup(uint32_t digits, bn_tune_t* tune)
+{
+    uint32_t i, width;
+
+    for (i = 0; i < tune_count; i++) {
+        if (tune_table[i].digits == digits) {
+            *tune = tune_table[i];
+            return;
+        }
+    }
+    tune->digits = digits;
+    tune->width = digits;
+    if ((width = engine_width(&engines[0], digits, 0)) != 0) {
+        tune->engine = &engines[0];
+        tune->width = width;
+    }
+    else {
+        tune->engine = digits >= BN_ENGINE_REDC_DIGITS ? &engines[ENGINE_REDC] : &engines[1];
+#if defined(__SIZEOF_INT128__)
+        // bn_mont_redc runs on 64-bit words for even lengths; an odd one
+        // gains a zero limb, which costs less than the 32-bit path
+        if ((width = engine_width(&engines[ENGINE_SOS], digits, 1)) != 0) {
+            tune->engine = &engines[ENGINE_SOS];
+            tune->width = width;
+        }
+#endif
+    }
+    tune->cutoff = BN_KARATSUBA_CUTOFF;
+}
+
+static int tune_store(const bn_tune_t* tune)
+{
+    uint32_t i;
+
+    for (i = 0; i < tune_count; i++) {
+        if (tune_table[i].digits == tune->digits) {
+            tune_table[i] = *tune;
+            return 0;
+        }
+    }
+    if (tune_count == BN_TUNE_MAX_SIZES) {
+        return -1;
+    }
+    tune_table[tune_count++] = *tune;
+    return 0;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void fill_random(bn_t* a, uint32_t digits, uint32_t* state)
+{
+    uint32_t i, x = *state;
+
+    for (i = 0; i < digits; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        a[i] = x;
+    }
+    *state = x;
+}
+
+// Karatsuba cutoffs tried; the last one never splits
+static const uint32_t cutoffs[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, BN_MAX_DIGITS + 1 };
+
+int bn_tune_run(uint32_t digits, bn_tune_t* tune)
+{
+    bn_t m[BN_MAX_DIGITS], b[BN_MAX_DIGITS], c[BN_MAX_DIGITS], a[BN_MAX_DIGITS];
+    bn_t rr[BN_MAX_DIGITS], one[BN_MAX_DIGITS], p[2 * BN_MAX_DIGITS];
+    bn_t wide_m[BN_MAX_DIGITS], wide_rr[BN_MAX_DIGITS], wide_one[BN_MAX_DIGITS];
+    bn_modulus_t mod, wide;
+    bn_tune_t best;
+    double t0, dt, best_dt;
+    uint32_t seed = 0x2545F491, reps, i, e, window, width, last, r;
+    int even;
+
+    if (digits < 2 || digits > BN_MAX_DIGITS - 1) {
+        return -1;
+    }
+
+    // An odd full-length modulus, a base below it and a full-length exponent
+    fill_random(m, digits, &seed);
+    m[0] |= 1;
+    m[digits - 1] |= (bn_t)1 << (BN_DIGIT_BITS - 1);
+    fill_random(b, digits, &seed);
+    b[digits - 1] >>= 1;
+    bn_assign_zero(&b[digits], BN_MAX_DIGITS - digits);
+    fill_random(c, digits, &seed);
+
+    mod.m = m;
+    mod.digits = digits;
+    mod.n0inv = bn_mont_n0inv(m[0]);
+    bn_mont_setup(rr, one, m, digits);
+
+    best.digits = digits;
+
+    // Karatsuba cutoff, measured on the bare multiplication
+    reps = 2000000 / (digits * digits) + 1;
+    best_dt = 0;
+    for (i = 0; i < sizeof(cutoffs) / sizeof(cutoffs[0]); i++) {
+        if (cutoffs[i] > digits && cutoffs[i] != BN_MAX_DIGITS + 1) {
+            continue;
+        }
+        t0 = now();
+        for (r = 0; r < reps; r++) {
+            bn_mul_fast(p, b, c, digits, cutoffs[i]);
+        }
+        dt = now() - t0;
+        if (best_dt == 0 || dt < best_dt) {
+            best_dt = dt;
+            best.cutoff = cutoffs[i];
+        }
+    }
+    mod.cutoff = best.cutoff;
+
+    // Engine and width, best of three full exponentiations each at the
+    // window that rsa_key_ctx_init() gives such an exponent, widening
+    // included; engines with mul2 are timed per exponentiation of a CRT pair
+    window = bn_exp_window(c, digits, digits);
+    best_dt = 0;
+    for (e = 0; e < ENGINE_COUNT; e++) {
+        for (even = 0, last = 0; even < 2; even++, last = width) {
+            if ((width = engine_width(&engines[e], digits, even)) == 0 || width == last) {
+                continue;
+            }
+            for (r = 0; r < 3; r++) {
+                t0 = now();
+                wide = mod;
+                bn_assign(wide_rr, rr, digits);
+                bn_assign(wide_one, one, digits);
+                if (width > digits) {
+                    bn_engine_widen(&wide, wide_m, wide_rr, wide_one, &mod, rr, one, width);
+                }
+                if (engines[e].mul2) {
+                    bn_exp_lane_t lane[2] = {
+                        { a, b, c, digits, &wide, wide_rr, wide_one, NULL, 0 },
+                        { a, b, c, digits, &wide, wide_rr, wide_one, NULL, 0 },
+                    };
+                    bn_engine_exp2(&engines[e], window, lane);
+                    dt = (now() - t0) / 2;
+                }
+                else {
+                    bn_engine_exp(&engines[e], window, a, b, c, digits, &wide, wide_rr, wide_one);
+                    dt = now() - t0;
+                }
+                if (best_dt == 0 || dt < best_dt) {
+                    best_dt = dt;
+                    best.engine = &engines[e];
+                    best.width = width;
+                }
+            }
+        }
+    }
+
+    *tune = best;
+    return tune_store(&best);
+}
+
+/*
+ * Config file: a cpu line identifying the host, then one line per size
+ *     size <digits> <engine> <width> <cutoff>
+ * Files of older formats (with a window, or without the width) fail to load
+ * and are tuned again.
+ */
+static void cpu_model(char* buf, size_t len)
+{
+    char line[256], *p;
+    FILE* f;
+
+    snprintf(buf, len, "unknown");
+    if ((f = fopen("/proc/cpuinfo", "r")) == NULL) {
+        return;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "model name", 10) == 0 && (p = strchr(line, ':')) != NULL) {
+            p += strspn(p + 1, " \t") + 1;
+            p[strcspn(p, "\n")] = 0;
+            snprintf(buf, len, "%s", p);
+            break;
+        }
+    }
+    fclose(f);
+}
+
+int bn_tune_load(const char* path)
+{
+    bn_tune_t loaded[BN_TUNE_MAX_SIZES];
+    char line[256], name[32], host[128];
+    uint32_t count = 0, digits, width, cutoff;
+    char extra;
+    int cpu_ok = 0;
+    FILE* f;
+
+    if ((f = fopen(path, "r")) == NULL) {
+        return -1;
+    }
+    cpu_model(host, sizeof(host));
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\n")] = 0;
+        if (line[0] == '#' || line[0] == 0) {
+            continue;
+        }
+        if (strncmp(line, "cpu ", 4) == 0) {
+            cpu_ok = strcmp(line + 4, host) == 0;
+            continue;
+        }
+        if (sscanf(line, "size %u %31s %u %u %c", &digits, name, &width, &cutoff, &extra) != 4 ||
+            count == BN_TUNE_MAX_SIZES || (loaded[count].engine = bn_engine_find(name)) == NULL ||
+            width < digits || width > digits + BN_ENGINE_MAX_PAD(digits) || width >= BN_MAX_DIGITS ||
+            !bn_engine_supports(loaded[count].engine, width)) {
+            fclose(f);
+            return -1;
+        }
+        loaded[count].digits = digits;
+        loaded[count].width = width;
+        loaded[count].cutoff = cutoff;
+        count++;
+    }
+    fclose(f);
+
+    // Results from another CPU model are not trusted
+    if (!cpu_ok) {
+        return -1;
+    }
+    memcpy(tune_table, loaded, count * sizeof(loaded[0]));
+    tune_count = count;
+    return 0;
+}
+
+int bn_tune_save(const char* path)
+{
+    char host[128];
+    uint32_t i;
+    FILE* f;
+
+    if ((f = fopen(path, "w")) == NULL) {
+        return -1;
+    }
+    cpu_model(host, sizeof(host));
+    fprintf(f, "# bn_engine tuning: size <digits> <engine> <width> <karatsuba cutoff>\n");
+    fprintf(f, "cpu %s\n", host);
+    for (i = 0; i < tune_count; i++) {
+        fprintf(f, "size %u %s %u %u\n", tune_table[i].digits, tune_table[i].engine->name, tune_table[i].width,
+                tune_table[i].cutoff);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
@@ -0,0 +1,127 @@
+/*****************************************************************************
+Filename    : bn_engine.h
+Date        : 2026-10-19
+Description : Modular exponentiation engines and per-size autotuning
+*****************************************************************************/
+#ifndef __BN_ENGINE_H__
+#define __BN_ENGINE_H__
+
+#include <stdint.h>
+
+#include "bignum.h"
+
+#define BN_ENGINE_MAX_WINDOW_BITS   6
+#define BN_TUNE_MAX_SIZES           16
+#define BN_ENGINE_REDC_DIGITS       384         // untuned sizes from here on use redc
+#define BN_ENGINE_MAX_PAD(digits)   ((digits) / 4)  // zero limbs a modulus may gain for a faster kernel
+
+// Modulus as seen by an engine; n0inv is only used by Montgomery engines,
+// ninv = -m^-1 mod R only by wide ones, which get it from bn_engine_exp()
+typedef struct {
+    bn_t     *m;
+    uint32_t digits;
+    bn_t     n0inv;
+    uint32_t cutoff;                            // Karatsuba cutoff in digits
+    bn_t     *ninv;
+} bn_modulus_t;
+
+/*
+ * mul/sqr include the engine's reduction: a = b * c mod m for plain engines,
+ * a = b * c / R mod m for Montgomery ones. a may alias b or c. Exponentiation
+ * is shared by all engines, see bn_engine_exp(). supports is NULL for engines
+ * that run on any host and size. mul2, if set (only comba), does two independent
+ * mul calls for moduli of the same length in one interleaved pass. lazy Montgomery
+ * engines skip the final subtraction, which needs R > 4m: bn_engine_exp()
+ * adds a zero digit to moduli that use either of their top two bits. Every
+ * result then stays below 2m and only the final one is reduced. wide
+ * Montgomery engines reduce with full-length products and read mod->ninv.
+ */
+typedef struct {
+    const char *name;
+    int         montgomery;
+    void (*mul)(bn_t* a, bn_t* b, bn_t* c, const bn_modulus_t* mod);
+    void (*sqr)(bn_t* a, bn_t* b, const bn_modulus_t* mod);
+    int  (*supports)(uint32_t digits);
+    void (*mul2)(bn_t* a0, bn_t* b0, bn_t* c0, const bn_modulus_t* mod0,
+                 bn_t* a1, bn_t* b1, bn_t* c1, const bn_modulus_t* mod1);
+    int         lazy;
+    int         wide;
+} bn_engine_t;
+
+// One exponentiation a = b ^ c mod m of a bn_engine_exp2() pair; win, if
+// set, is c recoded for the pair's window and c is not read
+typedef struct {
+    bn_t               *a, *b, *c;
+    uint32_t           cdigits;
+    const bn_modulus_t *mod;
+    bn_t               *rr, *one;
+    const uint8_t      *win;
+    uint32_t           nwin;
+} bn_exp_lane_t;
+
+// Tuned choice for one modulus size; the engine runs the modulus zero-extended
+// to width limbs (see bn_engine_widen)
+typedef struct {
+    uint32_t          digits;
+    const bn_engine_t *engine;
+    uint32_t          width;
+    uint32_t          cutoff;
+} bn_tune_t;
+
+uint32_t bn_engine_count(void);
+const bn_engine_t *bn_engine_at(uint32_t index);
+const bn_engine_t *bn_engine_find(const char *name);
+int bn_engine_supports(const bn_engine_t *engine, uint32_t digits);
+
+// a = b ^ c mod m with a fixed window; rr and one are R^2 and R mod m,
+// R = 2^(32 * mod->digits), used by Montgomery engines only
+void bn_engine_exp(const bn_engine_t* engine, uint32_t window, bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits,
+                   const bn_modulus_t* mod, bn_t* rr, bn_t* one);
+
+/*
+ * Fixed-window recoding, for exponents that are used many times such as CRT
+ * exponents: bn_exp_window() picks the window (2 .. BN_ENGINE_MAX_WINDOW_BITS)
+ * with the fewest operations for c and a modulus of digits, bn_exp_recode()
+ * stores c's window values, most significant first, and returns their count
+ * (0 for c = 0 or more than max). bn_engine_exp_win() runs from that list.
+ */
+uint32_t bn_exp_window(bn_t* c, uint32_t cdigits, uint32_t digits);
+uint32_t bn_exp_recode(uint8_t* win, uint32_t max, bn_t* c, uint32_t cdigits, uint32_t window);
+void bn_engine_exp_win(const bn_engine_t* engine, uint32_t window, bn_t* a, bn_t* b, const uint8_t* win, uint32_t nwin,
+                       const bn_modulus_t* mod, bn_t* rr, bn_t* one);
+
+/*
+ * mod zero-extended to width >= mod->digits limbs, so that a kernel for a
+ * longer length can run it: 43-limb primes (three-prime 4096-bit keys) on the
+ * 48-limb mulx, or odd lengths on the 64-bit words of sos. m, rr and one
+ * receive the modulus and R^2, R mod m for R = 2^(32 * width), derived from
+ * mod_rr and mod_one. Operands must be zero-extended the same way.
+ */
+void bn_engine_widen(bn_modulus_t* wide, bn_t* m, bn_t* rr, bn_t* one,
+                     const bn_modulus_t* mod, bn_t* mod_rr, bn_t* mod_one, uint32_t width);
+
+// Same result for a public exponent, by square and multiply; not constant time
+void bn_engine_exp_public(const bn_engine_t* engine, bn_t* a, bn_t* b, bn_t* c, uint32_t cdigits,
+                          const bn_modulus_t* mod, bn_t* rr, bn_t* one);
+
+// Both lanes in lockstep through mul2, e.g. the p and q halves of CRT; falls
+// back to two bn_engine_exp() calls without mul2 or for unequal lengths
+void bn_engine_exp2(const bn_engine_t* engine, uint32_t window, bn_exp_lane_t lane[2]);
+
+/*
+ * The tuning table is process global. Fill it (bn_tune_run / bn_tune_load)
+ * before starting threads that use it; lookups are read-only afterwards.
+ * Sizes with no entry use the default: mulx where the CPU allows it at a
+ * length up to BN_ENGINE_MAX_PAD limbs longer, otherwise sos at the next even
+ * length on compilers with 128-bit integers, else comba, or redc from
+ * BN_ENGINE_REDC_DIGITS on, with BN_KARATSUBA_CUTOFF. The tuner also times
+ * each engine at its shortest supported (and shortest even) width.
+ * The window is not tuned: it follows the exponent (bn_exp_window()), and
+ * engines are timed at the window a full-length exponent of the size gets.
+ */
+void bn_tune_lookup(uint32_t digits, bn_tune_t* tune);
+int bn_tune_run(uint32_t digits, bn_tune_t* tune);          // benchmark this host, store and return the choice
+int bn_tune_load(const char* path);                         // 0, or -1 if missing, malformed or for another CPU
+int bn_tune_save(const char* path);
+
+#endif  // __BN_ENGINE_H__
@@ -0,0 +1,395 @@
+/*****************************************************************************
+Filename    : bn_perf.c
+Date        : 2026-10-19
+Description : Runs each bignum kernel in isolation at several limb counts
+              under perf_event_open and reports hardware counters per call;
+              results can be saved and compared against another build.
+*****************************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "bignum.h"
+
+#define BN_PERF_COUNTERS            4
+#define BN_PERF_RUNS                5       // best of
+#define BN_PERF_RUN_NS              20000000
+#define BN_PERF_MAX_RESULTS         256
+
+// Counter order in a group read and in saved results
+enum { CNT_CYCLES, CNT_INSTRUCTIONS, CNT_BRANCH_MISSES, CNT_L1D_MISSES };
+
+typedef struct {
+    bn_t     a[2 * BN_MAX_DIGITS], b[2 * BN_MAX_DIGITS], c[BN_MAX_DIGITS];
+    bn_t     n[BN_MAX_DIGITS], q[2 * BN_MAX_DIGITS];
+    uint32_t digits;
+    bn_t     n0inv, ninv[BN_MAX_DIGITS];
+} operands_t;
+
+typedef struct {
+    const char *name;
+    void (*run)(operands_t *o);
+    int  (*supports)(uint32_t digits);      // NULL for any size up to BN_MAX_DIGITS - 1
+} kernel_t;
+
+typedef struct {
+    char     kernel[32];
+    uint32_t digits;
+    double   ns;
+    double   count[BN_PERF_COUNTERS];        // per call, negative when unavailable
+} result_t;
+
+// montMul clears its output before reading the inputs, so it must not alias a
+// (as in cios_mul): the copy back is part of the measured cost
+static void run_mont_mul(operands_t *o)
+{
+    montMul(o->q, o->a, o->b, o->n, o->digits, o->n0inv);
+    bn_assign(o->a, o->q, o->digits);
+}
+static void run_mont_mul_comba(operands_t *o) { montMulComba(o->a, o->a, o->b, o->n, o->digits, o->n0inv); }
+static void run_mont_mul_almost(operands_t *o) { montMulAlmost(o->a, o->a, o->b, o->n, o->digits, o->n0inv); }
+static void run_mont_mul_mulx(operands_t *o)  { montMulMulx(o->a, o->a, o->b, o->n, o->digits, o->n0inv); }
+static void run_mont_mul_redc(operands_t *o)  { bn_mont_mul_redc(o->a, o->a, o->b, o->n, o->ninv, o->digits, BN_KARATSUBA_CUTOFF); }
+static void run_mont_mul_sos(operands_t *o)   { bn_mont_mul_sos(o->a, o->a, o->b, o->n, o->n0inv, o->digits, BN_KARATSUBA_CUTOFF); }
+static void run_mont_redc(operands_t *o)      { bn_mont_redc(o->q, o->a, o->n, o->digits, o->n0inv); }
+static void run_mul(operands_t *o)            { bn_mul(o->q, o->b, o->c, o->digits); }
+static void run_mul_comba(operands_t *o)      { bn_mul_comba(o->q, o->b, o->c, o->digits); }
+static void run_sqr(operands_t *o)            { bn_sqr(o->q, o->b, o->digits); }
+static void run_mul_karatsuba(operands_t *o)  { bn_mul_karatsuba(o->q, o->b, o->c, o->digits, BN_KARATSUBA_CUTOFF); }
+static void run_mul_toom3(operands_t *o)      { bn_mul_toom3(o->q, o->b, o->c, o->digits, BN_KARATSUBA_CUTOFF); }
+static void run_mul_fast(operands_t *o)       { bn_mul_fast(o->q, o->b, o->c, o->digits, BN_KARATSUBA_CUTOFF); }
+static void run_div(operands_t *o)            { bn_div(o->q, o->c, o->a, 2 * o->digits, o->n, o->digits); }
+static void run_mod_inv(operands_t *o)        { bn_mod_inv(o->q, o->b, o->n, o->digits); }
+
+static int supports_mulx(uint32_t digits)
+{
+    return bn_mulx_supported() && (digits == 32 || digits == 48 || digits == 64 || digits == 96 || digits == 128 || digits == 256);
+}
+
+static const kernel_t kernels[] = {
+    { "montMul",          run_mont_mul,       NULL          },
+    { "montMulComba",     run_mont_mul_comba, NULL          },
+    { "montMulAlmost",    run_mont_mul_almost, NULL         },
+    { "montMulMulx",      run_mont_mul_mulx,  supports_mulx },
+    { "bn_mont_mul_redc", run_mont_mul_redc,  NULL          },
+    { "bn_mont_mul_sos",  run_mont_mul_sos,   NULL          },
+    { "bn_mont_redc",     run_mont_redc,      NULL          },
+    { "bn_mul",           run_mul,            NULL          },
+    { "bn_mul_comba",     run_mul_comba,      NULL          },
+    { "bn_sqr",           run_sqr,            NULL          },
+    { "bn_mul_karatsuba", run_mul_karatsuba,  NULL          },
+    { "bn_mul_toom3",     run_mul_toom3,      NULL          },
+    { "bn_mul_fast",      run_mul_fast,       NULL          },
+    { "bn_div",           run_div,            NULL          },
+    { "bn_mod_inv",       run_mod_inv,        NULL          },
+};
+
+static const char *counter_names[BN_PERF_COUNTERS] = { "cycles", "instructions", "branch_misses", "l1d_misses" };
+
+static int group_fd = -1;
+static int counter_fd[BN_PERF_COUNTERS];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static int perf_open(uint32_t type, uint64_t config, int group)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+// One group on this thread; counters the PMU lacks stay closed (-1)
+static int counters_open(void)
+{
+    static const struct { uint32_t type; uint64_t config; } events[BN_PERF_COUNTERS] = {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    };
+    uint32_t i;
+
+    for(i=0; i<BN_PERF_COUNTERS; i++) {
+        counter_fd[i] = perf_open(events[i].type, events[i].config, group_fd);
+        if(group_fd < 0)
+            group_fd = counter_fd[i];
+    }
+
+    return group_fd < 0 ? -1 : 0;
+}
+
+// Runs calls iterations, fills ns and the counters per call
+static void measure(const kernel_t *k, operands_t *o, uint64_t calls, result_t *r)
+{
+    uint64_t buf[3 + BN_PERF_COUNTERS], start, i;
+    uint32_t j, slot;
+    double scale;
+
+    if(group_fd >= 0) {
+        ioctl(group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    start = now_ns();
+    for(i=0; i<calls; i++)
+        k->run(o);
+    r->ns = (double)(now_ns() - start) / calls;
+    if(group_fd >= 0)
+        ioctl(group_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    for(j=0; j<BN_PERF_COUNTERS; j++)
+        r->count[j] = -1;
+    if(group_fd < 0 || read(group_fd, buf, sizeof(buf)) < (ssize_t)(3 * sizeof(uint64_t)) || buf[2] == 0)
+        return;
+
+    // Values come in the order the counters joined the group; scale for multiplexing
+    scale = (double)buf[1] / (double)buf[2];
+    for(j=0, slot=0; j<BN_PERF_COUNTERS && slot<buf[0]; j++) {
+        if(counter_fd[j] < 0)
+            continue;
+        r->count[j] = (double)buf[3 + slot++] * scale / calls;
+    }
+}
+
+static void operands_init(operands_t *o, uint32_t digits)
+{
+    uint32_t i;
+
+    memset(o, 0, sizeof(*o));
+    o->digits = digits;
+
+    // Same operands in every build, so saved results compare like with like
+    srand(digits);
+    for(i=0; i<digits; i++) {
+        o->n[i] = ((bn_t)rand() << 16) ^ (bn_t)rand();
+        o->b[i] = ((bn_t)rand() << 16) ^ (bn_t)rand();
+        o->c[i] = ((bn_t)rand() << 16) ^ (bn_t)rand();
+    }
+    o->n[0] |= 1;
+    o->n[digits - 1] |= 0x80000000;
+    o->b[digits - 1] &= 0x7FFFFFFF;
+    o->c[digits - 1] &= 0x7FFFFFFF;
+    for(i=0; i<2*digits; i++)
+        o->a[i] = ((bn_t)rand() << 16) ^ (bn_t)rand();
+    o->a[digits - 1] &= 0x7FFFFFFF;
+    o->n0inv = bn_mont_n0inv(o->n[0]);
+    bn_mont_ninv(o->ninv, o->n, digits);
+}
+
+static void bench(const kernel_t *k, uint32_t digits, result_t *r)
+{
+    static operands_t o;
+    result_t run;
+    uint64_t calls, start;
+    uint32_t i;
+
+    operands_init(&o, digits);
+
+    // Warm caches and branch predictors, and size the runs
+    for(calls=0, start=now_ns(); now_ns()-start < BN_PERF_RUN_NS/10 || calls < 10; calls++)
+        k->run(&o);
+    calls *= 10;
+
+    memset(r, 0, sizeof(*r));
+    snprintf(r->kernel, sizeof(r->kernel), "%s", k->name);
+    r->digits = digits;
+    for(i=0; i<BN_PERF_RUNS; i++) {
+        operands_init(&o, digits);
+        measure(k, &o, calls, &run);
+        if(i == 0 || run.ns < r->ns) {
+            run.digits = digits;
+            memcpy(run.kernel, r->kernel, sizeof(run.kernel));
+            *r = run;
+        }
+    }
+}
+
+static void print_count(double v)
+{
+    if(v < 0)
+        printf(" %12s", "-");
+    else
+        printf(" %12.1f", v);
+}
+
+static void print_header(void)
+{
+    printf("%-18s %6s %10s %12s %12s %6s %12s %12s\n",
+           "kernel", "digits", "ns/call", "cycles", "instructions", "IPC", "br-misses", "L1d-misses");
+}
+
+static void print_result(const result_t *r)
+{
+    printf("%-18s %6u %10.1f", r->kernel, r->digits, r->ns);
+    print_count(r->count[CNT_CYCLES]);
+    print_count(r->count[CNT_INSTRUCTIONS]);
+    if(r->count[CNT_CYCLES] > 0 && r->count[CNT_INSTRUCTIONS] >= 0)
+        printf(" %6.2f", r->count[CNT_INSTRUCTIONS] / r->count[CNT_CYCLES]);
+    else
+        printf(" %6s", "-");
+    print_count(r->count[CNT_BRANCH_MISSES]);
+    print_count(r->count[CNT_L1D_MISSES]);
+    printf("\n");
+}
+
+static int save_results(const char *path, const result_t *res, uint32_t count)
+{
+    FILE *fp;
+    uint32_t i, j;
+
+    if((fp = fopen(path, "w")) == NULL)
+        return -1;
+    fprintf(fp, "# bn_perf 1: kernel digits ns");
+    for(j=0; j<BN_PERF_COUNTERS; j++)
+        fprintf(fp, " %s", counter_names[j]);
+    fprintf(fp, "\n");
+    for(i=0; i<count; i++) {
+        fprintf(fp, "%s %u %.3f", res[i].kernel, res[i].digits, res[i].ns);
+        for(j=0; j<BN_PERF_COUNTERS; j++)
+            fprintf(fp, " %.3f", res[i].count[j]);
+        fprintf(fp, "\n");
+    }
+
+    return fclose(fp) == 0 ? 0 : -1;
+}
+
+static int load_results(const char *path, result_t *res, uint32_t max)
+{
+    FILE *fp;
+    char line[256];
+    result_t *r;
+    uint32_t count = 0;
+
+    if((fp = fopen(path, "r")) == NULL)
+        return -1;
+    while(count < max && fgets(line, sizeof(line), fp)) {
+        r = &res[count];
+        if(line[0] == '#')
+            continue;
+        if(sscanf(line, "%31s %u %lf %lf %lf %lf %lf", r->kernel, &r->digits, &r->ns,
+                  &r->count[0], &r->count[1], &r->count[2], &r->count[3]) == 3 + BN_PERF_COUNTERS)
+            count++;
+    }
+    fclose(fp);
+
+    return (int)count;
+}
+
+static void print_change(double base, double cur)
+{
+    if(base <= 0 || cur < 0)
+        printf(" %9s", "-");
+    else
+        printf(" %+8.1f%%", (cur - base) * 100 / base);
+}
+
+// Relative change of each metric; negative is better except for IPC
+static void compare(const result_t *base, uint32_t nbase, const result_t *res, uint32_t count)
+{
+    const result_t *b, *r;
+    uint32_t i, j;
+
+    printf("%-18s %6s %10s %10s %9s %9s %9s %9s %9s %9s\n", "kernel", "digits", "base ns", "ns",
+           "ns", "cycles", "instr", "IPC", "br-miss", "L1d-miss");
+    for(i=0; i<count; i++) {
+        r = &res[i];
+        for(j=0, b=NULL; j<nbase && b==NULL; j++) {
+            if(base[j].digits == r->digits && strcmp(base[j].kernel, r->kernel) == 0)
+                b = &base[j];
+        }
+        if(b == NULL)
+            continue;
+        printf("%-18s %6u %10.1f %10.1f", r->kernel, r->digits, b->ns, r->ns);
+        print_change(b->ns, r->ns);
+        print_change(b->count[CNT_CYCLES], r->count[CNT_CYCLES]);
+        print_change(b->count[CNT_INSTRUCTIONS], r->count[CNT_INSTRUCTIONS]);
+        if(b->count[CNT_CYCLES] > 0 && r->count[CNT_CYCLES] > 0)
+            print_change(b->count[CNT_INSTRUCTIONS] / b->count[CNT_CYCLES], r->count[CNT_INSTRUCTIONS] / r->count[CNT_CYCLES]);
+        else
+            printf(" %9s", "-");
+        print_change(b->count[CNT_BRANCH_MISSES], r->count[CNT_BRANCH_MISSES]);
+        print_change(b->count[CNT_L1D_MISSES], r->count[CNT_L1D_MISSES]);
+        printf("\n");
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-k kernel] [-o results] [-c baseline] [digits ...]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    static uint32_t default_sizes[] = { 16, 32, 48, 64, 128, 256 };
+    static result_t res[BN_PERF_MAX_RESULTS], base[BN_PERF_MAX_RESULTS];
+    const char *only = NULL, *out_path = NULL, *base_path = NULL;
+    uint32_t i, k, n, digits, count = 0;
+    int opt, nbase = 0;
+
+    while((opt = getopt(argc, argv, "k:o:c:h")) != -1) {
+        switch(opt) {
+        case 'k': only = optarg;                        break;
+        case 'o': out_path = optarg;                    break;
+        case 'c': base_path = optarg;                   break;
+        default:  usage(argv[0]);                       return 1;
+        }
+    }
+    if(base_path && (nbase = load_results(base_path, base, BN_PERF_MAX_RESULTS)) < 0) {
+        fprintf(stderr, "bn_perf: cannot read %s\n", base_path);
+        return 1;
+    }
+
+    if(counters_open() != 0)
+        fprintf(stderr, "bn_perf: hardware counters unavailable (%s), reporting time only\n", strerror(errno));
+
+    print_header();
+    n = optind < argc ? (uint32_t)(argc - optind) : sizeof(default_sizes) / sizeof(default_sizes[0]);
+    for(i=0; i<n; i++) {
+        digits = optind < argc ? (uint32_t)atoi(argv[optind + i]) : default_sizes[i];
+        if(optind == argc && digits >= BN_MAX_DIGITS)
+            continue;                               // 256 digits only with a larger MAX_BITS
+        if(digits == 0 || digits >= BN_MAX_DIGITS) {
+            fprintf(stderr, "bn_perf: %u digits out of range\n", digits);
+            continue;
+        }
+        for(k=0; k<sizeof(kernels)/sizeof(kernels[0]) && count<BN_PERF_MAX_RESULTS; k++) {
+            if(only && strcmp(only, kernels[k].name) != 0)
+                continue;
+            if(kernels[k].supports && !kernels[k].supports(digits))
+                continue;
+            bench(&kernels[k], digits, &res[count]);
+            print_result(&res[count++]);
+        }
+    }
+
+    if(base_path) {
+        printf("\nchange against %s:\n", base_path);
+        compare(base, (uint32_t)nbase, res, count);
+    }
+    if(out_path && save_results(out_path, res, count) != 0) {
+        fprintf(stderr, "bn_perf: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*****************************************************************************
+Filename    : gen_keys_ctx.c
+Date        : 2026-10-19
+Description : Build step: prepares the keys embedded in keys.h and writes
+              them out as C initializers (keys_ctx.c), so every Montgomery
+              constant is derived from the raw key bytes when the program is
+              built. The generated limbs are in host order; run it on a
+              machine with the target's endianness.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "rsa.h"
+#include "bignum.h"
+#include "keys.h"
+#include "keys_load.h"
+
+static void emit_limbs(const char *name, const bn_t *a, uint32_t count, const char *indent)
+{
+    uint32_t i;
+
+    count = bn_digits((bn_t *)a, count);
+    if(count == 0)
+        return;
+    printf("%s.%s = {", indent, name);
+    for(i=0; i<count; i++) {
+        if(i % 8 == 0)
+            printf("\n%s   ", indent);
+        printf(" 0x%08X,", a[i]);
+    }
+    printf("\n%s},\n", indent);
+}
+
+static void emit_bytes(const char *name, const uint8_t *a, uint32_t count, const char *indent)
+{
+    uint32_t i;
+
+    if(count == 0)
+        return;
+    printf("%s.%s = {", indent, name);
+    for(i=0; i<count; i++) {
+        if(i % 16 == 0)
+            printf("\n%s   ", indent);
+        printf(" %u,", a[i]);
+    }
+    printf("\n%s},\n", indent);
+}
+
+static void emit_ctx(const char *name, const rsa_key_ctx_t *ctx)
+{
+    const rsa_prime_ctx_t *pc;
+    uint32_t i;
+
+    printf("rsa_key_ctx_t %s = {\n", name);
+    printf("    .magic = RSA_KEY_CTX_MAGIC, .version = RSA_KEY_CTX_VERSION, .size = sizeof(rsa_key_ctx_t),\n");
+    printf("    .key_id = %u, .bits = %u, .primes = %u, .ndigits = %u, .edigits = %u,\n",
+           ctx->key_id, ctx->bits, ctx->primes, ctx->ndigits, ctx->edigits);
+    emit_limbs("n", ctx->n, RSA_MAX_MODULUS_DIGITS, "    ");
+    emit_limbs("e", ctx->e, RSA_MAX_MODULUS_DIGITS, "    ");
+    printf("    .prime = {\n");
+    for(i=0; i<ctx->primes; i++) {
+        pc = &ctx->prime[i];
+        printf("    {\n");
+        printf("        .digits = %u, .ddigits = %u, .n0inv = 0x%08X, .window = %u, .windows = %u,\n",
+               pc->digits, pc->ddigits, pc->n0inv, pc->window, pc->windows);
+        emit_limbs("m", pc->m, RSA_MAX_PRIME_DIGITS, "        ");
+        emit_limbs("rr", pc->rr, RSA_MAX_PRIME_DIGITS, "        ");
+        emit_limbs("one", pc->one, RSA_MAX_PRIME_DIGITS, "        ");
+        emit_limbs("d", pc->d, RSA_MAX_PRIME_DIGITS, "        ");
+        emit_limbs("t", pc->t, RSA_MAX_PRIME_DIGITS, "        ");
+        emit_bytes("dwin", pc->dwin, pc->windows, "        ");
+        printf("    },\n");
+    }
+    printf("    },\n};\n\n");
+}
+
+// Encrypt with the public half and decrypt with the prepared private half
+static int check_ctx(rsa_key_ctx_t *ctx, uint8_t *m, uint32_t m_len, uint8_t *e, uint32_t e_len)
+{
+    rsa_pk_t pk = {0};
+    uint8_t input[64], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+    uint32_t output_len, msg_len, i;
+    int status;
+
+    pk.bits = ctx->bits;
+    memcpy(&pk.modulus [RSA_MAX_MODULUS_LEN-m_len], m, m_len);
+    memcpy(&pk.exponent[RSA_MAX_MODULUS_LEN-e_len], e, e_len);
+    for(i=0; i<sizeof(input); i++)
+        input[i] = (uint8_t)(i * 37 + 11);
+
+    if((status = rsa_public_encrypt(output, &output_len, input, sizeof(input), &pk)) != 0 ||
+       (status = rsa_private_decrypt_ctx(msg, &msg_len, output, output_len, ctx)) != 0)
+        return status;
+    return msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0 ? ERR_WRONG_DATA : 0;
+}
+
+int main(void)
+{
+    rsa_sk_t sk;
+    rsa_key_ctx_t ctx;
+    int status;
+
+    memset(&sk, 0, sizeof(sk));
+    KEY_LOAD_SK(sk, key, KEY_M_BITS);
+
+    if((status = rsa_key_ctx_init(&ctx, &sk, 0)) != 0 ||
+       (status = check_ctx(&ctx, key_m, sizeof(key_m), key_e, sizeof(key_e))) != 0) {
+        fprintf(stderr, "gen_keys_ctx: key_m does not match its private key (%x)\n", status);
+        return 1;
+    }
+
+    printf("/* Generated from keys.h by gen_keys_ctx; do not edit */\n");
+    printf("#include \"keys_ctx.h\"\n\n");
+    emit_ctx("key_ctx", &ctx);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&sk, 0, sizeof(sk));
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    return 0;
+}
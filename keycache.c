@@ -0,0 +1,228 @@
+/*****************************************************************************
+Filename    : keycache.c
+Date        : 2026-10-19
+Description : Sharded LRU cache of prepared key contexts. A miss inserts a
+              placeholder and runs the loader outside the shard lock; other
+              threads asking for the same key wait for that single load.
+*****************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "keycache.h"
+
+enum { ENTRY_LOADING, ENTRY_READY, ENTRY_FAILED };
+
+struct rsa_key_entry {
+    rsa_key_ctx_t   ctx;                        // first, so put() can map ctx back
+    uint32_t        key_id;
+    uint32_t        refs;
+    int             state;
+    rsa_key_entry_t *hnext;
+    rsa_key_entry_t *prev, *next;
+};
+
+static uint32_t key_hash(uint32_t key_id)
+{
+    return key_id * 0x9E3779B1u;
+}
+
+static rsa_key_shard_t *shard_of(rsa_key_cache_t *cache, uint32_t key_id)
+{
+    return &cache->shard[key_hash(key_id) >> 28];
+}
+
+static rsa_key_entry_t **bucket_of(rsa_key_shard_t *s, uint32_t key_id)
+{
+    return &s->bucket[(key_hash(key_id) >> 16) % RSA_KEY_CACHE_BUCKETS];
+}
+
+static void lru_unlink(rsa_key_shard_t *s, rsa_key_entry_t *e)
+{
+    if(e->prev) e->prev->next = e->next;
+    else        s->lru_head = e->next;
+    if(e->next) e->next->prev = e->prev;
+    else        s->lru_tail = e->prev;
+    e->prev = e->next = NULL;
+}
+
+static void lru_push_front(rsa_key_shard_t *s, rsa_key_entry_t *e)
+{
+    e->prev = NULL;
+    e->next = s->lru_head;
+    if(s->lru_head) s->lru_head->prev = e;
+    else            s->lru_tail = e;
+    s->lru_head = e;
+}
+
+static void entry_unlink(rsa_key_shard_t *s, rsa_key_entry_t *e)
+{
+    rsa_key_entry_t **pp;
+
+    for(pp = bucket_of(s, e->key_id); *pp; pp = &(*pp)->hnext) {
+        if(*pp == e) {
+            *pp = e->hnext;
+            break;
+        }
+    }
+    lru_unlink(s, e);
+    s->stats.entries--;
+}
+
+static void entry_free(rsa_key_entry_t *e)
+{
+    // Clear potentially sensitive information
+    memset((uint8_t *)e, 0, sizeof(*e));
+    free(e);
+}
+
+// Drop unpinned entries from the cold end until the shard fits again
+static void shard_evict(rsa_key_shard_t *s)
+{
+    rsa_key_entry_t *e = s->lru_tail, *prev;
+
+    while(e && s->stats.entries > s->capacity) {
+        prev = e->prev;
+        if(e->refs == 0 && e->state == ENTRY_READY) {
+            entry_unlink(s, e);
+            entry_free(e);
+            s->stats.evictions++;
+        }
+        e = prev;
+    }
+}
+
+int rsa_key_cache_init(rsa_key_cache_t *cache, uint32_t capacity, rsa_key_loader_t load, void *load_arg)
+{
+    uint32_t i;
+
+    if(load == NULL)
+        return ERR_WRONG_DATA;
+
+    memset(cache, 0, sizeof(*cache));
+    cache->load = load;
+    cache->load_arg = load_arg;
+    for(i=0; i<RSA_KEY_CACHE_SHARDS; i++) {
+        pthread_mutex_init(&cache->shard[i].lock, NULL);
+        pthread_cond_init(&cache->shard[i].loaded, NULL);
+        cache->shard[i].capacity = (capacity + RSA_KEY_CACHE_SHARDS - 1) / RSA_KEY_CACHE_SHARDS;
+        if(cache->shard[i].capacity == 0)
+            cache->shard[i].capacity = 1;
+    }
+
+    return 0;
+}
+
+void rsa_key_cache_destroy(rsa_key_cache_t *cache)
+{
+    rsa_key_entry_t *e, *next;
+    uint32_t i;
+
+    for(i=0; i<RSA_KEY_CACHE_SHARDS; i++) {
+        for(e = cache->shard[i].lru_head; e; e = next) {
+            next = e->next;
+            entry_free(e);
+        }
+        pthread_mutex_destroy(&cache->shard[i].lock);
+        pthread_cond_destroy(&cache->shard[i].loaded);
+    }
+    memset(cache, 0, sizeof(*cache));
+}
+
+rsa_key_ctx_t *rsa_key_cache_get(rsa_key_cache_t *cache, uint32_t key_id)
+{
+    rsa_key_shard_t *s = shard_of(cache, key_id);
+    rsa_key_entry_t *e, **bucket;
+    int status;
+
+    pthread_mutex_lock(&s->lock);
+    bucket = bucket_of(s, key_id);
+    for(e = *bucket; e; e = e->hnext) {
+        if(e->key_id == key_id)
+            break;
+    }
+
+    if(e) {
+        e->refs++;
+        if(e->state == ENTRY_READY) {
+            s->stats.hits++;
+        } else {
+            s->stats.misses++;
+            while(e->state == ENTRY_LOADING)
+                pthread_cond_wait(&s->loaded, &s->lock);
+            if(e->state == ENTRY_FAILED) {
+                if(--e->refs == 0)
+                    entry_free(e);
+                pthread_mutex_unlock(&s->lock);
+                return NULL;
+            }
+        }
+        lru_unlink(s, e);
+        lru_push_front(s, e);
+        pthread_mutex_unlock(&s->lock);
+        return &e->ctx;
+    }
+
+    s->stats.misses++;
+    if((e = aligned_alloc(64, sizeof(*e))) == NULL) {
+        s->stats.load_errors++;
+        pthread_mutex_unlock(&s->lock);
+        return NULL;
+    }
+    memset(e, 0, sizeof(*e));
+    e->key_id = key_id;
+    e->refs = 1;
+    e->state = ENTRY_LOADING;
+    e->hnext = *bucket;
+    *bucket = e;
+    lru_push_front(s, e);
+    s->stats.entries++;
+    shard_evict(s);
+    pthread_mutex_unlock(&s->lock);
+
+    status = cache->load(cache->load_arg, key_id, &e->ctx);
+    if(status == 0)
+        status = rsa_key_ctx_check(&e->ctx);
+
+    pthread_mutex_lock(&s->lock);
+    if(status == 0) {
+        e->state = ENTRY_READY;
+    } else {
+        e->state = ENTRY_FAILED;
+        entry_unlink(s, e);
+        s->stats.load_errors++;
+        if(--e->refs == 0)
+            entry_free(e);
+        e = NULL;
+    }
+    pthread_cond_broadcast(&s->loaded);
+    pthread_mutex_unlock(&s->lock);
+
+    return e ? &e->ctx : NULL;
+}
+
+void rsa_key_cache_put(rsa_key_cache_t *cache, rsa_key_ctx_t *ctx)
+{
+    rsa_key_entry_t *e = (rsa_key_entry_t *)ctx;
+    rsa_key_shard_t *s = shard_of(cache, e->key_id);
+
+    pthread_mutex_lock(&s->lock);
+    if(--e->refs == 0 && s->stats.entries > s->capacity)
+        shard_evict(s);
+    pthread_mutex_unlock(&s->lock);
+}
+
+void rsa_key_cache_stats(rsa_key_cache_t *cache, rsa_key_cache_stats_t *stats)
+{
+    uint32_t i;
+
+    memset(stats, 0, sizeof(*stats));
+    for(i=0; i<RSA_KEY_CACHE_SHARDS; i++) {
+        pthread_mutex_lock(&cache->shard[i].lock);
+        stats->hits        += cache->shard[i].stats.hits;
+        stats->misses      += cache->shard[i].stats.misses;
+        stats->evictions   += cache->shard[i].stats.evictions;
+        stats->load_errors += cache->shard[i].stats.load_errors;
+        stats->entries     += cache->shard[i].stats.entries;
+        pthread_mutex_unlock(&cache->shard[i].lock);
+    }
+}
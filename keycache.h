@@ -0,0 +1,56 @@
+/*****************************************************************************
+Filename    : keycache.h
+Date        : 2026-10-19
+Description : Bounded, thread-safe cache of prepared key contexts
+*****************************************************************************/
+#ifndef __KEYCACHE_H__
+#define __KEYCACHE_H__
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "rsa.h"
+
+// Keys are spread over shards by key_id; each shard has its own lock, hash
+// table and LRU list, so lookups of different keys rarely contend.
+#define RSA_KEY_CACHE_SHARDS                16
+#define RSA_KEY_CACHE_BUCKETS               64              // per shard
+
+// Fills ctx for key_id on a miss (e.g. rsa_key_ctx_init() or a key store copy).
+// Returns 0 or an ERR_* code; it is called without any cache lock held.
+typedef int (*rsa_key_loader_t)(void *arg, uint32_t key_id, rsa_key_ctx_t *ctx);
+
+typedef struct rsa_key_entry rsa_key_entry_t;
+
+typedef struct {
+    uint64_t hits, misses;                      // misses include waits on a load in progress
+    uint64_t evictions, load_errors;
+    uint32_t entries;
+} rsa_key_cache_stats_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  loaded;
+    rsa_key_entry_t *bucket[RSA_KEY_CACHE_BUCKETS];
+    rsa_key_entry_t *lru_head, *lru_tail;       // most / least recently used
+    uint32_t capacity;
+    rsa_key_cache_stats_t stats;
+} rsa_key_shard_t;
+
+typedef struct {
+    rsa_key_shard_t  shard[RSA_KEY_CACHE_SHARDS];
+    rsa_key_loader_t load;
+    void             *load_arg;
+} rsa_key_cache_t;
+
+int rsa_key_cache_init(rsa_key_cache_t *cache, uint32_t capacity, rsa_key_loader_t load, void *load_arg);
+void rsa_key_cache_destroy(rsa_key_cache_t *cache);
+
+// rsa_key_cache_get() returns a pinned context (loading it on a miss), or NULL
+// when the loader fails. Every successful get must be paired with a put.
+rsa_key_ctx_t *rsa_key_cache_get(rsa_key_cache_t *cache, uint32_t key_id);
+void rsa_key_cache_put(rsa_key_cache_t *cache, rsa_key_ctx_t *ctx);
+
+void rsa_key_cache_stats(rsa_key_cache_t *cache, rsa_key_cache_stats_t *stats);
+
+#endif  // __KEYCACHE_H__
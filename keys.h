@@ -1,5 +1,7 @@
 #include <stdint.h>
 
+// Raw key material only. Montgomery constants and the rest of the prepared
+// context are derived from these bytes at build time (gen_keys_ctx -> keys_ctx.c).
 #define KEY_M_BITS      4096
 
 uint8_t key_m[] = {
@@ -178,13 +180,774 @@ uint8_t key_c[] = {
 		0x58, 0x79, 0x4c, 0x09, 0x4e, 0x80, 0x56, 0xd6, 0x11, 0x08, 0x14, 0xfb, 0x09, 0xa5, 0x9a,
 		0xeb};
 
-uint32_t key_n_inv = 0xED62BCF1;
-uint32_t key_p_inv = 0x51C32F17;
-uint32_t key_q_inv = 0x908B46C9;
+// Multi-prime 4096-bit keys (RFC 8017 otherPrimeInfos): primes in descending
+// order, d_i = d mod (r_i - 1), t_i = (r_1 * ... * r_(i-1))^-1 mod r_i
+#define KEY_MP_BITS     4096
 
+uint8_t key_mp3_m[] = {
+		0xac, 0xc6, 0x89, 0xd7, 0xd9, 0xac, 0xb1, 0xdf, 0x9f, 0xfc, 0x99, 0xc0, 0xc7, 0xb3,
+		0x4b, 0xde, 0x08, 0x00, 0xee, 0x4e, 0x1a, 0x7b, 0x69, 0x1f, 0x49, 0x7f, 0x17, 0x04,
+		0x1d, 0x61, 0x6c, 0xaf, 0x23, 0x24, 0x21, 0xed, 0xcf, 0x09, 0x23, 0x58, 0xd0, 0x8b,
+		0x19, 0x9d, 0x47, 0xfe, 0xf6, 0x67, 0x86, 0x75, 0x48, 0xcb, 0xa9, 0x8f, 0xc7, 0xab,
+		0xcc, 0x3a, 0xa9, 0xa0, 0x63, 0x58, 0xb7, 0xdc, 0x72, 0xf4, 0x46, 0xf6, 0x96, 0x8a,
+		0x2b, 0xa0, 0x07, 0xde, 0xc2, 0x56, 0x8b, 0xcb, 0x7e, 0x42, 0x7e, 0xcf, 0x4b, 0xc4,
+		0x4a, 0xea, 0x39, 0x18, 0x9c, 0xb2, 0x2f, 0x60, 0xef, 0xbd, 0x4f, 0x9d, 0xa0, 0xc2,
+		0x73, 0xf4, 0xd3, 0xa7, 0x01, 0xe5, 0xe2, 0x8d, 0x74, 0x0e, 0x79, 0x17, 0x42, 0xd3,
+		0x50, 0x91, 0x59, 0xee, 0xe3, 0x29, 0x57, 0xb0, 0xdc, 0x79, 0x92, 0xec, 0x57, 0x04,
+		0xa7, 0x16, 0x62, 0xc0, 0xe4, 0xe8, 0xd7, 0xf1, 0xd9, 0xfc, 0xa2, 0x48, 0x93, 0x5c,
+		0xf0, 0xc4, 0x56, 0x78, 0x56, 0x1b, 0x9b, 0x2a, 0xaa, 0x9d, 0x7c, 0x04, 0xa8, 0x23,
+		0xd4, 0xc0, 0x2c, 0x65, 0xc4, 0x92, 0x6e, 0x8f, 0x41, 0x7a, 0x22, 0x8e, 0xa5, 0x4b,
+		0x2b, 0xb7, 0xc0, 0x9a, 0x83, 0x9b, 0x6d, 0xef, 0x82, 0x65, 0x9a, 0x6b, 0xda, 0x56,
+		0x0a, 0xc9, 0xc4, 0x9b, 0x2b, 0xc7, 0xb3, 0x69, 0x67, 0xc3, 0xa8, 0x3f, 0x94, 0x5d,
+		0x5d, 0x6a, 0xa2, 0x8d, 0x76, 0xa9, 0x46, 0x3f, 0x25, 0xb6, 0x18, 0x0d, 0xac, 0xd5,
+		0xb0, 0x00, 0xb6, 0xe1, 0x49, 0x5e, 0xa3, 0xa1, 0xca, 0x00, 0x2e, 0x1e, 0xca, 0x08,
+		0xcc, 0xa7, 0x01, 0x7e, 0x4f, 0x0e, 0x8e, 0x6e, 0xd3, 0xfd, 0x2b, 0x3e, 0x8d, 0x4b,
+		0xf3, 0x79, 0x42, 0x5a, 0x6b, 0x02, 0x4f, 0xe7, 0x61, 0xae, 0x93, 0x2b, 0xb8, 0xbc,
+		0x11, 0x96, 0x17, 0x09, 0xe0, 0xfa, 0xa2, 0x6a, 0xde, 0xf5, 0xb1, 0x0c, 0x8f, 0x7d,
+		0xd7, 0xe9, 0xce, 0xee, 0x16, 0xa9, 0x2b, 0x68, 0xdf, 0xd3, 0x01, 0x3a, 0xd2, 0x85,
+		0xbe, 0xdb, 0x65, 0xe0, 0xa8, 0xee, 0x4b, 0x28, 0x4e, 0x60, 0xd9, 0xb1, 0x01, 0x14,
+		0x76, 0x1e, 0x19, 0xe8, 0x64, 0xe3, 0xdf, 0x61, 0x9e, 0x0c, 0x10, 0x09, 0xba, 0x5c,
+		0x31, 0xb0, 0xe1, 0x1e, 0x14, 0x72, 0x71, 0xd2, 0x4f, 0x81, 0x83, 0xec, 0xa7, 0x48,
+		0xfd, 0x83, 0x26, 0xfd, 0xb1, 0x83, 0x6e, 0x49, 0xd5, 0x23, 0x38, 0xdb, 0x44, 0x91,
+		0x6f, 0x4b, 0xb9, 0x24, 0x52, 0xd4, 0xf0, 0xe6, 0xd2, 0x36, 0xf8, 0xa0, 0xe7, 0x19,
+		0x58, 0x03, 0xd8, 0x54, 0x6f, 0x84, 0xd0, 0x3c, 0x0f, 0x8d, 0x06, 0xcb, 0x8c, 0x45,
+		0x6b, 0xc0, 0xd4, 0xe5, 0xe5, 0x39, 0xe0, 0x5b, 0xd1, 0xbc, 0xda, 0x28, 0x2f, 0x3e,
+		0x73, 0xbb, 0x46, 0x90, 0x75, 0x05, 0x30, 0x08, 0x56, 0x0a, 0x6d, 0xf7, 0x62, 0x04,
+		0xf5, 0x0f, 0x9a, 0x4a, 0xb8, 0x26, 0x77, 0x1a, 0xbb, 0xc4, 0x81, 0x30, 0xe1, 0x97,
+		0x23, 0x20, 0x0a, 0x2a, 0x65, 0x1f, 0xba, 0xff, 0xb4, 0xfa, 0xca, 0x9d, 0x18, 0x3b,
+		0x24, 0x77, 0xea, 0x3d, 0x7e, 0xda, 0xb8, 0xf3, 0x61, 0x48, 0x90, 0x27, 0xd0, 0x5e,
+		0xd2, 0x55, 0x1f, 0xb4, 0x9d, 0x90, 0x13, 0xb1, 0x22, 0x5b, 0x3d, 0xf5, 0xf1, 0x63,
+		0x4c, 0x7a, 0xe1, 0x63, 0x64, 0xc0, 0xac, 0xab, 0x8b, 0x44, 0xf8, 0x8a, 0x1e, 0x55,
+		0x37, 0xe2, 0x65, 0x1e, 0x78, 0xd9, 0x76, 0xa6, 0x12, 0xab, 0x36, 0xd0, 0x64, 0x22,
+		0x81, 0x5a, 0x67, 0xad, 0xe8, 0xcc, 0x4f, 0x97, 0xeb, 0xe2, 0x73, 0xa2, 0xa1, 0x1d,
+		0x3d, 0x9a, 0xa5, 0x06, 0x43, 0x1b, 0x94, 0xc8, 0x3e, 0xbe, 0xf1, 0xe2, 0xd7, 0xcd,
+		0xd5, 0x42, 0x9a, 0x09, 0x31, 0x56, 0x99, 0x1b};
 
-uint8_t key_n_rr[] = { 0x79,0x2D,0xF0,0xF7,0x1B,0xB1,0x82,0x90,0x44,0x3A,0x2E,0x94,0xE0,0x6C,0xC5,0x19,0x3B,0x69,0x7E,0x7E,0x19,0x1A,0xB1,0x8D,0x23,0xAB,0x6B,0x49,0x44,0xBD,0xD4,0x57,0x13,0xDD,0x38,0x14,0xB0,0x7D,0x5B,0xD8,0x60,0x6A,0x75,0x9C,0x5E,0x19,0x8F,0x0D,0xD9,0xD9,0x68,0xEF,0x02,0xFB,0xFA,0x13,0xF2,0x6D,0x2F,0x7A,0x39,0xFD,0x98,0x86,0x15,0xBA,0x5A,0xAC,0x92,0xFE,0x5B,0x75,0x29,0xE0,0x10,0x58,0x4D,0x13,0xF3,0x33,0xE1,0xA1,0x2C,0x22,0x5B,0x85,0xB6,0xBB,0xAE,0x17,0xBB,0x53,0xE1,0xD9,0xE3,0x66,0x4A,0x9C,0x4D,0x8F,0xED,0xBA,0x63,0xB3,0xC6,0x44,0xC3,0x36,0x68,0x06,0x41,0x12,0x2E,0xFB,0x8C,0xF2,0xB4,0x56,0xA3,0x00,0x8C,0x72,0x5F,0x44,0x48,0x73,0xDD,0xD6,0xB5,0xE1,0x36,0x2E,0xF1,0xAA,0xEC,0xB7,0x25,0xBD,0x4D,0xBB,0x1E,0x71,0xD4,0xE5,0x93,0xD4,0x3F,0x3A,0x5C,0x7E,0xB0,0x34,0x0D,0xC8,0x06,0x83,0x55,0xB6,0x80,0x6B,0x2A,0x83,0xCC,0x1E,0x38,0xBA,0xEA,0x1B,0x1A,0x1D,0x2E,0xC6,0xB7,0xE4,0x2C,0xB0,0x9D,0x5F,0x88,0xD3,0x9A,0xEA,0xAD,0xB6,0xA6,0xA3,0x1F,0xA3,0x34,0x1B,0x16,0xEA,0x64,0x21,0x89,0x7A,0x46,0xDD,0xAC,0x49,0x48,0xF6,0xDB,0x30,0x4E,0x1C,0xCE,0xC0,0x2D,0xFB,0x8A,0xC4,0x2B,0x83,0x7D,0x3B,0xBD,0x70,0x44,0xC3,0x99,0x72,0x3F,0xFC,0x29,0x76,0x18,0x41,0x43,0x86,0x66,0x74,0xEE,0xF0,0xD6,0x0C,0x33,0xAB,0x74,0x6B,0x8A,0x25,0x82,0xFB,0x31,0x5A,0x23,0xBF,0x4E,0xF6,0xBC,0x3B,0xB7,0x50,0x84,0xC4,0x63,0xDC,0xDD,0xF8,0x58,0xEF,0x61,0x7D,0xB5,0x30,0x14,0x48,0xED,0x82,0xA7,0x4A,0x6A,0x2D,0x2D,0xD4,0xE1,0x9C,0x97,0x2E,0xB4,0x8A,0xEC,0x27,0x6B,0xBE,0x44,0x6B,0xA5,0x4F,0x90,0xE5,0xF2,0xC2,0xAB,0xB6,0x03,0x55,0xDC,0x16,0x47,0xEC,0xC4,0x6B,0xA1,0x15,0x20,0x7B,0xEB,0xB0,0xE1,0xEE,0xF4,0x23,0xC5,0x6A,0xE2,0x1D,0xBE,0xF1,0x26,0xF7,0x96,0x84,0xE7,0xD3,0x54,0xDC,0x0E,0xDC,0x4D,0x01,0xDF,0x99,0x91,0xD6,0x57,0xF8,0x32,0x53,0x25,0x3F,0x41,0xFE,0x98,0xDC,0x03,0x8F,0x0A,0x91,0x8C,0xD2,0xF9,0xE7,0x28,0x16,0xCE,0xB5,0xB7,0xA9,0x94,0xA3,0x87,0xCF,0x41,0x3B,0x29,0x4B,0x8A,0x81,0x56,0x78,0xE4,0xE2,0x93,0x99,0xB6,0x35,0xD8,0x3A,0x21,0x2C,0x9B,0xE6,0x35,0xD4,0xE1,0xBE,0x29,0x9A,0x26,0x28,0xB5,0xA3,0xB3,0xFC,0x46,0x10,0xEE,0x85,0x14,0x7E,0x09,0x54,0x62,0x70,0x86,0x01,0x0C,0x9C,0x25,0x46,0x8D,0x1C,0x19,0x19,0x2C,0xC9,0x82,0xA0,0x3C,0x64,0x64,0x1B,0xDF,0x8B,0x88,0x16,0x3C,0x7E,0xE8,0x15,0xA2,0x04,0x42,0xCA,0x82,0x5F,0x3B,0x34,0xB1,0x36,0x60,0x97,0x6A,0xF4,0xDF,0xF7,0x83,0xBD,0xD4,0x69,0x16,0x6E,0x73,0x30,0x2E,0x16,0x96,0xDF,0x97,0x13,0x2E,0xF7,0x5C,0x91,0xF5,0x76,0x18,0x67,0x5B,0xDF,0x5F,0x4C,0x41,0xED,0x77,0xAC,0x74,0xF4,0x8D,0x56,0x8F,0x79,0x50,0x28,0x4F,0x91,0xB2,0x5A,0xD3,0x50,0x02,0x38,0xCD,0x84,0x64,0xAF,0xA3,0x18,0xB4,0xC8,0xDE,0x4B,0x66,0x58,0x6D,0xFD,0x0C,0x15,0xC5,0x7B };
+uint8_t key_mp3_pe[] = {
+		0xe0, 0x0d, 0xb9, 0x89, 0x3d, 0xf6, 0x8f, 0x70, 0x38, 0xd9, 0xc5, 0x01, 0x25, 0x6f,
+		0x84, 0x5d, 0xd4, 0xfa, 0xb5, 0x63, 0xf1, 0x84, 0xba, 0xe3, 0x6d, 0x3d, 0x3c, 0x17,
+		0x73, 0x8a, 0xf0, 0x95, 0x50, 0x34, 0x6d, 0x53, 0xf2, 0xf0, 0xfc, 0x14, 0x8a, 0x7e,
+		0x83, 0x12, 0xa2, 0x9b, 0xe2, 0xd4, 0xaa, 0x9e, 0x87, 0x6e, 0xc8, 0x45, 0xec, 0x47,
+		0x6a, 0x84, 0x75, 0x4a, 0x0d, 0x24, 0xf3, 0x05, 0x9d, 0x51, 0x88, 0x81, 0xe0, 0xbf,
+		0x56, 0x0f, 0x35, 0xbf, 0x26, 0x4e, 0x62, 0x59, 0x0e, 0xcd, 0xbd, 0x9c, 0x73, 0x0f,
+		0x85, 0x7d, 0x63, 0x51, 0xd8, 0x8d, 0x4a, 0xfd, 0x3b, 0x5f, 0xc0, 0x74, 0xad, 0xab,
+		0x39, 0x34, 0x5a, 0x88, 0xf9, 0x24, 0x98, 0x09, 0x35, 0xfb, 0xe4, 0x25, 0xdb, 0x76,
+		0x47, 0x1a, 0x37, 0x1b, 0x6d, 0x1c, 0x89, 0x86, 0x08, 0xec, 0x7d, 0x75, 0x2a, 0x1f,
+		0x27, 0x06, 0x8f, 0x9b, 0x04, 0xfa, 0xde, 0x20, 0x40, 0x47, 0x37, 0x92, 0x99, 0x87,
+		0x79, 0xf7, 0x67, 0x2b, 0x37, 0x90, 0x37, 0x57, 0x76, 0xd0, 0x54, 0x76, 0xd7, 0xa5,
+		0xe3, 0xee, 0xb8, 0xd7, 0xb7, 0xdb, 0x71, 0x59, 0xd5, 0x2d, 0x56, 0x23, 0x14, 0xc8,
+		0xb7, 0xb9, 0xd8, 0x28, 0x9e, 0xbd, 0xd5, 0xba, 0xdb, 0x7f, 0x54, 0x13, 0x32, 0x87,
+		0x8e, 0xaa, 0x52, 0x1b, 0x18, 0x2a, 0x0e, 0xfa, 0x7d, 0x3c, 0x6b, 0x6b, 0x83, 0x60,
+		0x55, 0x43, 0x28, 0xc3, 0xbb, 0x21, 0xe6, 0x99, 0x7d, 0x69, 0x95, 0xc1, 0x23, 0x48,
+		0x93, 0x67, 0xc8, 0x8e, 0x40, 0x8e, 0x2d, 0x64, 0x00, 0xa3, 0xd9, 0x46, 0x6f, 0xc9,
+		0x91, 0xbe, 0x26, 0xf7, 0x07, 0x6a, 0x1d, 0x56, 0xd9, 0x51, 0x25, 0xfa, 0xcb, 0x8d,
+		0x3e, 0xbb, 0x5b, 0xd1, 0xfb, 0xc1, 0xb0, 0x66, 0xda, 0x70, 0x35, 0xa0, 0x0b, 0x11,
+		0x2a, 0x22, 0x95, 0xae, 0x80, 0x7d, 0x7c, 0x63, 0xd8, 0xd6, 0x0e, 0x6f, 0x4f, 0xf0,
+		0x42, 0xb4, 0x86, 0xe1, 0x89, 0xfd, 0x33, 0xa5, 0x89, 0x5c, 0xc3, 0xa8, 0x99, 0x48,
+		0xe6, 0xd4, 0xe8, 0x2d, 0xb6, 0x70, 0x72, 0xe3, 0x86, 0x99, 0xd4, 0xa8, 0x45, 0x76,
+		0xdd, 0xbf, 0xfa, 0x98, 0x98, 0x0d, 0xc1, 0x0b, 0x13, 0xa5, 0xbe, 0xdb, 0x26, 0x87,
+		0x1a, 0x93, 0x03, 0x64, 0x22, 0xb5, 0x3c, 0x0f, 0x48, 0x80, 0x28, 0xfc, 0xe5, 0x94,
+		0x60, 0x21, 0x9e, 0x1c, 0xad, 0x0c, 0xce, 0xdc, 0x8c, 0x25, 0x20, 0x69, 0xd8, 0x0d,
+		0xc1, 0x65, 0xa2, 0x45, 0xdb, 0x6b, 0x5b, 0x10, 0x99, 0x1e, 0x73, 0x52, 0x40, 0x7c,
+		0xfa, 0xd5, 0x7e, 0xf8, 0x13, 0x0c, 0x32, 0xde, 0xfa, 0xcc, 0xb1, 0x9e, 0xf7, 0xfc,
+		0x81, 0xa1, 0xef, 0x5c, 0x77, 0xe0, 0x72, 0x79, 0xd7, 0xc4, 0x84, 0x88, 0x73, 0x5e,
+		0x87, 0x21, 0x72, 0x14, 0x14, 0x4e, 0x3f, 0x9d, 0x9d, 0x61, 0xf7, 0x52, 0x9b, 0x1f,
+		0xcd, 0xb5, 0x76, 0x56, 0x9c, 0x55, 0x7e, 0x25, 0x61, 0x0e, 0x41, 0xf4, 0xe1, 0xe3,
+		0x35, 0xc7, 0x7e, 0x7c, 0x8a, 0xe3, 0xd8, 0xe8, 0x6e, 0xf9, 0x8e, 0x8a, 0x3a, 0x93,
+		0xab, 0xb4, 0xfe, 0xea, 0x3b, 0xb5, 0x5a, 0xc3, 0x79, 0x63, 0xb5, 0x8d, 0x5d, 0xa5,
+		0x80, 0x55, 0x3a, 0xf3, 0x78, 0xf9, 0xed, 0x61, 0xea, 0x52, 0xfb, 0xce, 0x0c, 0x73,
+		0x23, 0x54, 0x27, 0xf1, 0x88, 0x0d, 0xc8, 0xcc, 0x28, 0x3a, 0x92, 0xfc, 0x18, 0x00,
+		0x8c, 0xb7, 0xda, 0x31, 0xec, 0x79, 0xcf, 0xfd, 0xaa, 0x75, 0xff, 0x2f, 0x15, 0x2d,
+		0x2a, 0xc3, 0x94, 0xc4, 0x6a, 0x0e, 0xce, 0xf9, 0x22, 0x5d, 0x38, 0xd9, 0x1f, 0xbe,
+		0xd5, 0xe6, 0xc1, 0x29, 0x0e, 0xf5, 0x69, 0x27, 0x8d, 0xe5, 0xbc, 0x2a, 0x25, 0xcf,
+		0xe9, 0x22, 0x85, 0xf6, 0xfc, 0x46, 0xbb};
 
-uint8_t key_p_rr[] = { 0xC9,0xCA,0x9B,0x57,0xD8,0xA0,0x4B,0x9E,0x2D,0x8E,0x36,0xC1,0x78,0x0C,0xF2,0x32,0xFE,0xC4,0x40,0xBE,0xE6,0x5C,0xB0,0xC3,0xD3,0xBB,0xB6,0xFB,0x96,0x68,0xA4,0x76,0xC3,0x0C,0x7C,0xD7,0x1A,0x85,0x11,0x81,0x22,0xDE,0xDC,0xE9,0x6A,0x75,0x49,0xA0,0xD5,0xC8,0x4C,0x81,0x68,0xF3,0xEB,0xBD,0xF3,0xA5,0xC6,0xC8,0xBE,0xFC,0xA0,0xF7,0x6F,0x52,0xB1,0x2A,0xE0,0xC7,0x87,0x06,0x21,0x51,0x12,0x0C,0xE4,0x57,0x3E,0xD3,0x0A,0x02,0x17,0xBA,0xCA,0x1D,0x04,0x1A,0x86,0x4D,0x50,0xBC,0xD2,0x2E,0x72,0x73,0xB8,0x88,0xFF,0x11,0xBF,0xF6,0x8D,0xBD,0x52,0xCE,0x0D,0xEB,0x22,0x94,0x2F,0xE6,0x8C,0xBD,0x80,0x80,0x95,0xE0,0xC8,0x76,0x17,0x8F,0x60,0x37,0xA1,0xC0,0x62,0xAD,0xDE,0xBB,0x74,0x44,0x56,0x2D,0x50,0x7A,0xE1,0x4C,0xF7,0x08,0x30,0xF2,0x28,0xAE,0xA9,0x2C,0x5C,0x71,0x2A,0xE6,0x28,0xE7,0x4D,0x02,0x07,0xA3,0x79,0x34,0x1A,0xB6,0xCF,0x71,0xDC,0x76,0x31,0x69,0x64,0xCC,0xBB,0x03,0x39,0x7B,0x00,0x8A,0x90,0x3F,0xA6,0x41,0x60,0xFF,0x41,0x96,0xCA,0xB0,0x0D,0xA7,0x19,0x74,0x91,0xCD,0xE8,0xE6,0x15,0x90,0x9F,0x28,0x92,0x64,0x33,0x7E,0x27,0x12,0xA0,0xD7,0x9A,0x94,0x4E,0x8F,0xC3,0xE4,0xB9,0xAE,0xD4,0x9E,0x51,0xEA,0x83,0xDF,0x02,0x63,0xDD,0x1B,0xCD,0xDF,0x92,0x38,0xA5,0x10,0x54,0x32,0x50,0x38,0x55,0x9A,0x0A,0x00,0xDD,0x68,0xC7,0x7E,0xE9,0x25,0xD7,0x80,0x69,0x11,0xEF,0x41,0x30,0xC9,0xA5,0xBD,0x2A,0x76,0x7D,0x24 };
-uint8_t key_q_rr[] = { 0x24,0xFE,0xE7,0xC2,0xC6,0x2E,0x23,0x01,0xB4,0xAB,0xA5,0x13,0x09,0x72,0x1B,0x1E,0x9E,0x71,0x4D,0x6E,0x0A,0x7B,0xF8,0xDA,0x62,0xBC,0x19,0xFF,0xCF,0xBC,0xD8,0xDF,0x31,0x71,0xF8,0x20,0x15,0x4E,0xFE,0x60,0x3C,0x18,0x4B,0xB0,0xCE,0x83,0xC0,0x16,0xDE,0x40,0x3E,0x3B,0x5F,0x8B,0x4B,0x70,0xD6,0x69,0xB1,0x49,0xF0,0xC5,0x78,0xAB,0x4B,0xB8,0x7D,0x8E,0xE5,0xC3,0x40,0xC9,0x8E,0xC2,0x46,0xAF,0xC8,0x91,0x1D,0x18,0xE2,0xB0,0x35,0x2D,0x39,0x8A,0x1A,0x68,0x98,0x4A,0xF4,0x84,0x76,0xD8,0xAD,0xC4,0x9A,0x17,0xDC,0x77,0x00,0xB9,0x0B,0x12,0xB0,0xAB,0x14,0xF8,0x8C,0x69,0x5E,0x8A,0xC5,0xC6,0x6B,0x6B,0x6A,0x06,0xF8,0x24,0xC3,0xE4,0x78,0x39,0x9A,0x27,0x82,0x99,0x6E,0x69,0x3D,0xEB,0x46,0xBD,0x10,0x0C,0xC5,0x07,0x56,0x96,0x43,0x74,0xA8,0x4B,0x72,0x7E,0x1C,0x81,0xEB,0x6D,0xD7,0xED,0xDF,0x46,0x32,0xF9,0xF7,0x28,0x3D,0x98,0x56,0x6E,0x53,0x98,0x18,0x0E,0x83,0x83,0x71,0x6C,0x48,0x6B,0xBB,0x5A,0x88,0x5A,0x79,0x72,0x5A,0x59,0x62,0x34,0xA2,0x1D,0x03,0x96,0x28,0xB5,0xB6,0x2F,0x2B,0xE4,0xF3,0xAB,0xB8,0x1F,0x91,0xCA,0x3A,0x9B,0x93,0x7C,0x67,0x7F,0x8A,0x03,0x29,0xE0,0x73,0x5A,0x3D,0xD7,0xA5,0xFB,0x39,0xB4,0x17,0x80,0x8F,0x7B,0x0D,0x31,0xBB,0xA8,0xEF,0x4B,0xC8,0x45,0xEE,0x24,0xC7,0xF8,0x31,0x66,0x52,0xA6,0x78,0x70,0x15,0x20,0x78,0x60,0x9F,0x56,0x7D,0x14,0xDA,0x4F,0x63,0x4F,0xA9,0x28,0xF7,0x4E,0xB2,0xF4 };
-// uint8_t key_n_rr[] = { 0xa2,0xd4,0xf3,0x85,0x86,0x3f,0xab,0x7f,0xae,0x1d,0x56,0x95,0x73,0x03,0xdc,0x4f,0xc7,0x09,0xc6,0xfb,0x9f,0x66,0x31,0x8b,0xe0,0x70,0x4f,0xc2,0x0f,0x56,0xab,0x84,0x45,0x34,0x19,0xdb,0x39,0x13,0x39,0x88,0x54,0x7e,0x7e,0x7d,0xb2,0xb3,0xf5,0xe6,0x36,0x0d,0xa9,0xbf,0x34,0xad,0xa2,0xed,0xd3,0x43,0x6b,0x03,0x32,0x16,0xc8,0x99,0xf4,0xaa,0x89,0x96,0xaa,0x21,0xb5,0xad,0x70,0x58,0x60,0xb1,0x6d,0xd1,0xac,0x9f,0xd5,0xaf,0x08,0x93,0xba,0xd2,0x89,0x41,0xc4,0xe3,0x88,0x8b,0x12,0x35,0x00,0x0a,0x54,0x35,0xb0,0x9c,0x70,0xee,0xd9,0xf8,0x85,0xb9,0x31,0x1e,0x7e,0x2a,0x87,0x51,0xdf,0x88,0x2c,0x31,0xdb,0x5a,0xc3,0xa2,0xdd,0x9b,0x22,0xfa,0x6b,0x5f,0x02,0xbf,0xe7,0xeb,0x80,0x26,0xbe,0x54,0x8e,0x8f,0x22,0x75,0x14,0xf2,0x85,0x76,0xc5,0xd8,0x2d,0x42,0xd7,0x74,0x1b,0xfc,0x73,0x44,0x14,0x21,0xf0,0x63,0x63,0xe5,0xa5,0x38,0xd1,0x9b,0x7f,0x45,0xc8,0x13,0xc8,0x04,0x0c,0xfb,0xf4,0x79,0xe8,0x41,0x7b,0x04,0x56,0x67,0xe7,0x8b,0x77,0xcb,0x70,0x14,0x25,0x35,0xca,0xf4,0x5e,0x4f,0x8c,0x72,0x64,0x34,0x87,0x9e,0xb4,0xb4,0x5c,0x16,0x25,0x7b,0x8a,0x9a,0x62,0xab,0x78,0x87,0x08,0x3a,0x07,0x16,0xfe,0x12,0x41,0x2c,0x27,0x1c,0x9f,0x83,0x37,0xff,0x70,0xcb,0x9e,0x18,0x98,0x62,0x88,0x0b,0x02,0xbf,0x80,0x83,0x3b,0x93,0x3a,0xfd,0x54,0xcf,0x03,0x71,0x5c,0x4b,0x93,0x8a,0xd8,0xeb,0xf2,0x08,0x00,0x00,0x00,0x00,0x00,0x00 };
\ No newline at end of file
+uint8_t key_mp3_p1[] = {
+		0x3e, 0x22, 0x19, 0x7e, 0xb0, 0xb9, 0x59, 0xe3, 0x73, 0x37, 0xbd, 0xd5, 0x3d, 0xac,
+		0x3e, 0xa8, 0x47, 0x73, 0x42, 0xf0, 0xd4, 0x18, 0xe9, 0x71, 0x22, 0x7a, 0xae, 0xac,
+		0x60, 0xd5, 0x86, 0xe1, 0xad, 0xb2, 0xbe, 0x63, 0x23, 0xc0, 0xc6, 0x42, 0x47, 0x24,
+		0x79, 0x26, 0x27, 0x5c, 0x08, 0xf9, 0x61, 0xf9, 0x10, 0x55, 0x82, 0x4c, 0xb8, 0xe5,
+		0x5f, 0x29, 0x32, 0xcc, 0xa0, 0x18, 0xdd, 0x43, 0x5c, 0x58, 0x68, 0x4a, 0x2f, 0x24,
+		0xf3, 0x28, 0xe0, 0xe2, 0xbc, 0x43, 0xa1, 0x34, 0x48, 0x4c, 0x8c, 0xfd, 0xf8, 0x7f,
+		0x49, 0x99, 0x40, 0x4b, 0x6c, 0xeb, 0x63, 0x93, 0x23, 0x07, 0xe5, 0xdc, 0x73, 0xe2,
+		0x71, 0xeb, 0x29, 0x88, 0xb5, 0x80, 0x9f, 0x46, 0xbd, 0x4f, 0x83, 0x03, 0x93, 0x0a,
+		0x2b, 0x06, 0xed, 0x47, 0x23, 0xff, 0x30, 0x35, 0xfd, 0x96, 0x18, 0x52, 0x38, 0x5c,
+		0xbe, 0x85, 0x79, 0x86, 0xc9, 0x55, 0x5d, 0x71, 0xca, 0x6f, 0xb8, 0x46, 0xd7, 0x22,
+		0x24, 0x67, 0x50, 0x79, 0xda, 0x48, 0xa2, 0x4d, 0xca, 0xcc, 0xd1, 0x83, 0xa8, 0x95,
+		0x01, 0xa5, 0xef, 0xff, 0xfe, 0xd2, 0xbe, 0xe7, 0xf9, 0x40, 0x47, 0xfc, 0xab, 0x23,
+		0x8a, 0x1c, 0x67};
+
+uint8_t key_mp3_p2[] = {
+		0x1c, 0x6f, 0xfd, 0xdd, 0xd3, 0x3d, 0x23, 0x55, 0x74, 0x89, 0xa5, 0xae, 0xd7, 0xa6,
+		0x33, 0xb5, 0xa1, 0x6d, 0xad, 0xe3, 0x1e, 0x87, 0xe5, 0x96, 0x20, 0x8a, 0x73, 0x40,
+		0x25, 0x56, 0xb3, 0xa3, 0x1f, 0xe3, 0xa3, 0x4c, 0xe2, 0x9e, 0xbf, 0x0f, 0xbf, 0xe8,
+		0xed, 0x29, 0x53, 0xc1, 0x6e, 0x82, 0x95, 0xcc, 0xb1, 0x15, 0x83, 0x6f, 0xf1, 0x8c,
+		0x8c, 0x12, 0x26, 0x29, 0xed, 0xe9, 0x62, 0x87, 0x6b, 0xed, 0xb4, 0x33, 0x61, 0x6a,
+		0x80, 0xed, 0x94, 0x5b, 0x7d, 0xb9, 0xee, 0x44, 0x29, 0x3d, 0x74, 0x1e, 0xde, 0x54,
+		0xde, 0x1a, 0x99, 0xa5, 0x69, 0xd4, 0xf0, 0xdb, 0x5e, 0x8c, 0x9c, 0x3b, 0xc2, 0xc6,
+		0x4a, 0xc7, 0x1c, 0x08, 0xed, 0x07, 0x7d, 0x00, 0x56, 0x15, 0x3b, 0x73, 0x43, 0x18,
+		0x9a, 0x39, 0x87, 0xf4, 0x3c, 0x27, 0xf6, 0xc3, 0xe7, 0xf4, 0x38, 0x8e, 0x80, 0xa9,
+		0x98, 0x6e, 0xec, 0x60, 0x62, 0xf7, 0xe8, 0x63, 0xb7, 0x58, 0xf2, 0xff, 0xce, 0xac,
+		0x0d, 0x24, 0x68, 0x9c, 0x0f, 0xc6, 0xe6, 0x3f, 0x1d, 0x06, 0x32, 0x39, 0x0d, 0x69,
+		0xb2, 0x8c, 0x97, 0xac, 0x74, 0x37, 0x39, 0xc9, 0x10, 0x05, 0x98, 0x6d, 0x8a, 0x15,
+		0x78, 0x50, 0x17};
+
+uint8_t key_mp3_e1[] = {
+		0x10, 0xdc, 0xbc, 0x42, 0x8f, 0xbf, 0x9d, 0xcf, 0x86, 0xa3, 0x68, 0x17, 0x89, 0x27,
+		0x47, 0xd1, 0xef, 0xa2, 0x2e, 0x56, 0xa1, 0x99, 0x29, 0x31, 0x95, 0x03, 0xea, 0x87,
+		0xc9, 0xb7, 0xe9, 0x65, 0x31, 0xf8, 0xc2, 0x86, 0xb1, 0x5b, 0x4d, 0xf3, 0x0a, 0xcf,
+		0xb1, 0x39, 0x53, 0x91, 0x3c, 0xb6, 0x41, 0x8a, 0x90, 0x8e, 0x44, 0x50, 0x82, 0x15,
+		0x6d, 0xe0, 0x06, 0x73, 0x56, 0x37, 0xa9, 0x44, 0xf0, 0xb8, 0xe5, 0x84, 0xcc, 0x8a,
+		0xa0, 0x9b, 0x45, 0x7d, 0x03, 0x4e, 0xef, 0x5e, 0xfb, 0x08, 0x1b, 0x73, 0x89, 0x8f,
+		0x31, 0xf0, 0x2f, 0x6c, 0xc8, 0xe0, 0x91, 0x23, 0x8b, 0x6c, 0x47, 0x4b, 0xae, 0xff,
+		0x93, 0x9f, 0x18, 0xa4, 0x8b, 0x6d, 0x9e, 0xcc, 0x59, 0xf0, 0x4c, 0x44, 0x1a, 0x11,
+		0xb6, 0x5f, 0xa8, 0xe1, 0x97, 0xb9, 0x57, 0xe2, 0x2f, 0x32, 0x1e, 0xe3, 0xa1, 0x7c,
+		0x3a, 0x10, 0x8b, 0x4c, 0xb3, 0x33, 0x41, 0xaa, 0xf2, 0x1f, 0xa3, 0xc9, 0x45, 0xf5,
+		0x74, 0x1f, 0xbd, 0xcd, 0x74, 0x1a, 0x26, 0x42, 0x2a, 0x79, 0xaf, 0x9a, 0xa5, 0x93,
+		0xda, 0xe0, 0xa7, 0xe3, 0xb7, 0xca, 0x86, 0x18, 0xfa, 0xa2, 0x21, 0x67, 0x47, 0x22,
+		0xdc, 0x06, 0x9d};
+
+uint8_t key_mp3_e2[] = {
+		0x11, 0x7e, 0xd5, 0x31, 0x24, 0x44, 0xf8, 0xf8, 0x1a, 0x3a, 0x95, 0x34, 0x7c, 0x78,
+		0x44, 0x57, 0xfa, 0x79, 0x00, 0x02, 0x3b, 0x46, 0x60, 0x79, 0x7c, 0x8b, 0xb1, 0x5c,
+		0x45, 0x9c, 0x91, 0xe8, 0x4a, 0x36, 0x42, 0xc1, 0x8a, 0xab, 0x1f, 0xe1, 0x10, 0xb0,
+		0xbd, 0x38, 0x2f, 0xcf, 0x51, 0xae, 0x05, 0x7b, 0x69, 0x77, 0x52, 0xe6, 0x0c, 0x35,
+		0xeb, 0xf7, 0x3e, 0x83, 0x8d, 0x5b, 0x88, 0xc2, 0xc8, 0x23, 0xf6, 0x39, 0xa6, 0x35,
+		0x60, 0x1c, 0xca, 0xa9, 0x7f, 0x30, 0x64, 0xe6, 0x8a, 0x78, 0xc4, 0x78, 0x39, 0x50,
+		0xfd, 0x54, 0x60, 0x32, 0xe4, 0x69, 0x9d, 0xc5, 0x58, 0xe6, 0x29, 0x38, 0x9b, 0x1c,
+		0x63, 0xe5, 0x1b, 0xda, 0x61, 0xf9, 0xb9, 0x6d, 0xfb, 0x88, 0x14, 0x8b, 0x55, 0x3c,
+		0x4d, 0xa6, 0x17, 0x7e, 0xab, 0x83, 0xea, 0xcd, 0x9c, 0x67, 0x24, 0x64, 0x87, 0xc3,
+		0xcf, 0x84, 0x6e, 0xe8, 0xdd, 0xfa, 0xa7, 0x7e, 0xb1, 0xce, 0x87, 0xb1, 0xd9, 0xf5,
+		0x00, 0x20, 0xe6, 0x3b, 0x1d, 0x79, 0xc1, 0x2e, 0x13, 0x2d, 0x3c, 0xb8, 0xdd, 0x07,
+		0xaa, 0x51, 0xd4, 0xfe, 0xc4, 0x81, 0x35, 0x8b, 0xfd, 0xcf, 0x73, 0x77, 0xf0, 0xfc,
+		0x44, 0x89, 0x01};
+
+uint8_t key_mp3_c[] = {
+		0x36, 0x10, 0x99, 0xe1, 0x3d, 0xf1, 0x66, 0x17, 0x2c, 0x1a, 0xa3, 0x9e, 0x37, 0x0a,
+		0xdd, 0x93, 0x20, 0x94, 0x5b, 0xcc, 0xea, 0x82, 0xa1, 0xd7, 0x6d, 0x44, 0x27, 0x42,
+		0xb9, 0x70, 0xd4, 0xda, 0xbe, 0x93, 0x93, 0x4d, 0xe7, 0x0e, 0xa6, 0x1d, 0xa8, 0xbd,
+		0x6b, 0x1d, 0x51, 0x75, 0x3d, 0xcc, 0x2c, 0x43, 0x59, 0xf5, 0xd8, 0x79, 0xcc, 0x50,
+		0x03, 0x40, 0x2e, 0x21, 0x8c, 0x63, 0xfb, 0xb5, 0x7f, 0xfc, 0xc8, 0xde, 0xa1, 0x11,
+		0xcd, 0x6e, 0x39, 0xc8, 0x97, 0x84, 0xb3, 0x96, 0x7b, 0x2d, 0x08, 0xb7, 0x09, 0x81,
+		0xff, 0x4e, 0x3c, 0x45, 0x03, 0x22, 0x64, 0x8d, 0xc2, 0xe2, 0x00, 0xbc, 0xf7, 0xd3,
+		0xce, 0x42, 0x7e, 0x6d, 0xbd, 0xcc, 0x67, 0x49, 0xcc, 0x2d, 0x6c, 0xb2, 0x93, 0x08,
+		0x78, 0x93, 0x02, 0xd8, 0x5e, 0x9e, 0x7e, 0x07, 0x1c, 0x9d, 0x10, 0x28, 0xa3, 0xd9,
+		0xb9, 0x76, 0xea, 0x60, 0xf1, 0x59, 0x8b, 0x6d, 0x80, 0x93, 0x1c, 0x93, 0x42, 0xa4,
+		0xef, 0x64, 0x36, 0x11, 0xdd, 0x58, 0xf5, 0x89, 0x82, 0x19, 0xf4, 0x34, 0x09, 0x33,
+		0x7b, 0x66, 0xc1, 0xed, 0xfc, 0x51, 0x98, 0xd9, 0xad, 0x4a, 0xd8, 0xa0, 0xf7, 0xbe,
+		0xf2, 0x8a, 0x35};
+
+uint8_t key_mp3_r3[] = {
+		0x19, 0x08, 0x5e, 0x95, 0xbb, 0xfb, 0x89, 0x23, 0x20, 0xb6, 0x4d, 0x19, 0x68, 0xce,
+		0x6c, 0x01, 0xce, 0x29, 0x1b, 0xd1, 0x6f, 0x24, 0x2f, 0x48, 0x85, 0x0e, 0xff, 0xed,
+		0xdb, 0x91, 0x12, 0x69, 0x9e, 0xa2, 0xe1, 0xd3, 0xbb, 0x42, 0x7d, 0x00, 0x9a, 0x54,
+		0xda, 0x0a, 0xfd, 0x87, 0xf4, 0xd9, 0x3a, 0x60, 0x13, 0xbd, 0x7f, 0x6e, 0xd6, 0x9a,
+		0x3b, 0x7f, 0xd0, 0xbe, 0xde, 0x4c, 0x03, 0x83, 0x95, 0x6d, 0x76, 0x57, 0xfa, 0x56,
+		0x40, 0xeb, 0x58, 0x24, 0xda, 0xd7, 0x56, 0xcc, 0xa1, 0xf8, 0xc4, 0xa0, 0x96, 0x56,
+		0x50, 0x80, 0x64, 0xe3, 0x15, 0x7e, 0xda, 0x4c, 0xd8, 0xf8, 0xcd, 0x39, 0xf1, 0xd8,
+		0xaf, 0x9e, 0xdc, 0x42, 0x12, 0xb9, 0x8f, 0x24, 0x5f, 0x0f, 0x1c, 0x09, 0x01, 0xf0,
+		0x2a, 0x65, 0x09, 0xb6, 0x69, 0xd5, 0xcd, 0x66, 0x5b, 0x1c, 0x1b, 0xed, 0x83, 0xd7,
+		0xd8, 0xf6, 0xc8, 0x6d, 0xcf, 0xdb, 0xcc, 0x32, 0x1e, 0xa4, 0x4d, 0xbd, 0x47, 0xed,
+		0xed, 0xb5, 0xde, 0x87, 0xa2, 0xd1, 0x42, 0xef, 0x2c, 0x76, 0xd0, 0xd0, 0x64, 0x5c,
+		0xc0, 0x40, 0x53, 0xd9, 0x8c, 0x95, 0x3e, 0xd8, 0xa3, 0x2a, 0xda, 0xbb, 0x30, 0x59,
+		0x77, 0x93, 0x5b};
+
+uint8_t key_mp3_d3[] = {
+		0x18, 0x6f, 0x89, 0x15, 0x15, 0x49, 0x77, 0x16, 0xe9, 0x49, 0xcb, 0x7d, 0x30, 0x47,
+		0xc0, 0x3b, 0x0a, 0xea, 0x2a, 0x13, 0x89, 0x30, 0x83, 0x4f, 0x81, 0x43, 0xa1, 0x24,
+		0xa9, 0x1e, 0xb6, 0x20, 0x90, 0x10, 0x63, 0xed, 0x71, 0x70, 0x77, 0xe1, 0x6c, 0xc5,
+		0xc3, 0x8a, 0xd2, 0xee, 0x32, 0x5f, 0x12, 0x92, 0xd2, 0xf2, 0x3a, 0x41, 0x12, 0x0f,
+		0xc0, 0x61, 0x06, 0x7e, 0x2b, 0x35, 0x7c, 0x80, 0xa8, 0x0f, 0x10, 0x64, 0xd5, 0x23,
+		0xf9, 0x7f, 0x42, 0xad, 0xc7, 0x4a, 0x49, 0x9a, 0xbb, 0xc9, 0xc0, 0xf7, 0x19, 0x89,
+		0xec, 0x4f, 0x49, 0x2c, 0x3a, 0xc1, 0x77, 0x8b, 0x68, 0x89, 0x86, 0x9c, 0x37, 0xae,
+		0xd3, 0xd0, 0x79, 0x25, 0xae, 0x6d, 0xa0, 0x83, 0x5a, 0x9f, 0xbf, 0x38, 0x33, 0xc2,
+		0x23, 0x40, 0x39, 0xf8, 0xec, 0xdb, 0x1e, 0x03, 0xfa, 0x90, 0x37, 0xda, 0xe4, 0xc6,
+		0x81, 0x2e, 0x75, 0x7c, 0x6c, 0x59, 0x1c, 0xbd, 0x18, 0x18, 0x3f, 0x22, 0xb3, 0xe2,
+		0x58, 0x17, 0x1e, 0xc0, 0xbc, 0x79, 0x15, 0xa3, 0xaf, 0x7d, 0xd4, 0x5c, 0x78, 0x7b,
+		0xe9, 0xd7, 0x61, 0x82, 0x8d, 0xae, 0xea, 0x88, 0x42, 0xcf, 0x04, 0x71, 0x91, 0xc2,
+		0xe3, 0xec, 0xdd};
+
+uint8_t key_mp3_t3[] = {
+		0x18, 0x86, 0x12, 0x6e, 0x7b, 0x3e, 0x1e, 0x76, 0x69, 0xc0, 0x2b, 0x77, 0xe5, 0x0d,
+		0x28, 0x71, 0x52, 0x8c, 0x18, 0xfb, 0x11, 0xd9, 0xab, 0x34, 0x69, 0xef, 0xd0, 0x3c,
+		0x48, 0x95, 0xbe, 0x2c, 0x08, 0x9a, 0x22, 0x9c, 0xe5, 0x79, 0x4d, 0xf8, 0xdc, 0xfc,
+		0xce, 0x8e, 0xf8, 0x51, 0x4e, 0x08, 0xb9, 0x7c, 0x8b, 0x83, 0x63, 0xcf, 0x39, 0xb1,
+		0xcf, 0x1b, 0x3f, 0x0a, 0x08, 0xdb, 0xf2, 0x2f, 0xfd, 0x15, 0xa0, 0xef, 0x89, 0x2b,
+		0x6d, 0x16, 0x21, 0xba, 0xac, 0xa1, 0x93, 0xfc, 0xfd, 0x62, 0x42, 0xbb, 0xb0, 0xc3,
+		0x99, 0x5a, 0x25, 0x23, 0x0c, 0x4a, 0x0e, 0x68, 0x7d, 0xbd, 0xf3, 0xfa, 0x35, 0xaa,
+		0xd1, 0x4b, 0x0e, 0x75, 0x0f, 0x9b, 0xb7, 0x8e, 0x78, 0xaa, 0xf7, 0xcb, 0x64, 0x1f,
+		0xe9, 0x2f, 0x9d, 0x9a, 0xb5, 0x6c, 0x72, 0x37, 0x0a, 0x50, 0x95, 0x84, 0x19, 0x3c,
+		0xd2, 0xd9, 0x38, 0x14, 0x2e, 0xb8, 0x93, 0x08, 0xb2, 0x5a, 0x09, 0x6c, 0x25, 0x4e,
+		0xf2, 0x7e, 0x40, 0xbc, 0xc2, 0x4d, 0xa4, 0x4f, 0x02, 0xe1, 0xd4, 0x24, 0x26, 0x64,
+		0xd4, 0xcf, 0xba, 0x72, 0x8b, 0x24, 0x18, 0x66, 0xe2, 0x52, 0xa5, 0x24, 0x12, 0xd5,
+		0x09, 0xbe, 0x5c};
+
+uint8_t key_mp4_m[] = {
+		0xb4, 0x06, 0x1f, 0xa9, 0xc4, 0x1d, 0x95, 0x60, 0xbe, 0x85, 0x99, 0x4c, 0x48, 0x8e,
+		0xee, 0x44, 0xea, 0x33, 0x79, 0x6f, 0x7c, 0x97, 0x1e, 0xc0, 0x8a, 0x4f, 0x3c, 0x7b,
+		0xe7, 0xc8, 0x67, 0x90, 0xd4, 0x9c, 0x04, 0x50, 0x07, 0xaa, 0xb8, 0xde, 0xf0, 0x1c,
+		0x76, 0x6e, 0x20, 0xf7, 0x35, 0xac, 0x59, 0xb4, 0x76, 0x6f, 0x12, 0x61, 0x85, 0x2e,
+		0x0c, 0x26, 0xfc, 0x72, 0x6c, 0x75, 0x8d, 0xe3, 0x54, 0x85, 0x83, 0xcf, 0x56, 0xc0,
+		0xfc, 0x70, 0x7e, 0x68, 0xba, 0x59, 0xbf, 0xc5, 0x90, 0x91, 0xf9, 0xad, 0x0b, 0x5d,
+		0x28, 0x35, 0x8f, 0x7a, 0xa1, 0xc9, 0x47, 0x62, 0x9b, 0xd2, 0xdc, 0xf4, 0xf0, 0x33,
+		0xe8, 0x65, 0x7c, 0xf6, 0x85, 0xe3, 0x0f, 0xff, 0x15, 0x1b, 0xd3, 0x8f, 0x9a, 0xa5,
+		0x2a, 0xdd, 0x88, 0x10, 0x00, 0xed, 0x73, 0xed, 0x91, 0xf0, 0xd7, 0xff, 0x4a, 0xc7,
+		0xf9, 0x2d, 0x40, 0xe5, 0xd6, 0x3b, 0xc2, 0x2d, 0x7f, 0x71, 0x6d, 0xa9, 0xfe, 0xa6,
+		0x39, 0x0f, 0x2d, 0x2e, 0x0e, 0x5e, 0x4d, 0xed, 0x10, 0xb7, 0x94, 0x00, 0xd2, 0x12,
+		0x14, 0x04, 0xce, 0x45, 0x68, 0x84, 0xf5, 0xf8, 0x22, 0x82, 0xb2, 0x71, 0x1c, 0x61,
+		0x0e, 0xcc, 0x08, 0xa2, 0xcc, 0x40, 0x95, 0x86, 0x62, 0x32, 0xaa, 0x23, 0xc9, 0x59,
+		0xb2, 0x80, 0x77, 0x28, 0xdd, 0x15, 0xa0, 0x63, 0x2a, 0x35, 0x7b, 0x61, 0x9a, 0xff,
+		0x9f, 0xb0, 0xad, 0x47, 0xbe, 0x5c, 0x9c, 0x6a, 0xee, 0xcf, 0x46, 0x05, 0x46, 0x13,
+		0x1a, 0x1f, 0x1a, 0xa7, 0x2f, 0x81, 0xc2, 0xab, 0x38, 0xab, 0x18, 0x7e, 0xa3, 0xea,
+		0x77, 0x72, 0xe4, 0xf2, 0x70, 0x70, 0x60, 0x99, 0xe9, 0xf3, 0xea, 0x95, 0x98, 0xb4,
+		0x4a, 0xca, 0xf3, 0x3d, 0xf9, 0xa3, 0x54, 0x0d, 0x43, 0x35, 0xd5, 0xfa, 0x2d, 0x3d,
+		0x1a, 0x23, 0x40, 0xd5, 0xda, 0x41, 0x70, 0xd5, 0xcf, 0xb1, 0x04, 0x9d, 0x84, 0x2d,
+		0x6d, 0xc9, 0x30, 0x9d, 0x30, 0x95, 0x54, 0x6a, 0xd3, 0x1a, 0x8f, 0xbd, 0x72, 0x7d,
+		0x22, 0x49, 0x26, 0x99, 0xae, 0x51, 0x40, 0x63, 0x3d, 0x0a, 0x03, 0x1e, 0x3b, 0x31,
+		0x49, 0x83, 0x09, 0x90, 0x2b, 0x76, 0x13, 0x9d, 0xd0, 0x5f, 0x95, 0x07, 0x3b, 0xab,
+		0x2a, 0xc3, 0xaa, 0xbb, 0x63, 0xfe, 0x4f, 0xf8, 0x68, 0x32, 0x2c, 0x1f, 0x0c, 0x95,
+		0xe7, 0xbc, 0x5c, 0x1e, 0x17, 0x32, 0x9c, 0x13, 0x0e, 0x92, 0xe7, 0xaf, 0x9e, 0x51,
+		0x52, 0x89, 0x72, 0x20, 0x4a, 0x2b, 0x66, 0xae, 0x23, 0x03, 0x86, 0x34, 0x32, 0x0a,
+		0x54, 0xc3, 0xfb, 0xd8, 0xe2, 0x0e, 0x9d, 0x61, 0xfe, 0xbb, 0xb9, 0x48, 0x1f, 0xfb,
+		0xf5, 0xdb, 0x77, 0xbc, 0x79, 0x2f, 0xe5, 0x5b, 0xdd, 0x46, 0x92, 0x57, 0x44, 0x40,
+		0xc4, 0xde, 0x21, 0x0e, 0x05, 0xa9, 0xee, 0x59, 0x8e, 0xe1, 0x25, 0x40, 0x25, 0xf7,
+		0x09, 0x50, 0x77, 0xfb, 0x87, 0x28, 0x28, 0x13, 0x3b, 0x0a, 0x4c, 0xe8, 0x5a, 0xb6,
+		0x45, 0x35, 0x9e, 0x51, 0xda, 0xfb, 0xe1, 0xb2, 0x0d, 0xb7, 0x66, 0xd1, 0x23, 0x89,
+		0x8e, 0xdf, 0x48, 0xcd, 0xa0, 0x76, 0xba, 0xaf, 0x7c, 0xac, 0x7d, 0x7c, 0x2d, 0x39,
+		0xed, 0x0e, 0x79, 0x35, 0x4d, 0x36, 0x29, 0x0b, 0x00, 0x50, 0xc3, 0x8a, 0xfb, 0x2a,
+		0x97, 0x3e, 0x36, 0xca, 0x43, 0xd2, 0x6d, 0x92, 0x21, 0xbb, 0xaf, 0x4e, 0x7f, 0x73,
+		0x51, 0x3d, 0xe0, 0x22, 0x32, 0xa3, 0xf7, 0x10, 0x74, 0x53, 0x9f, 0x67, 0x1f, 0x8b,
+		0x52, 0xa6, 0xd6, 0x61, 0x69, 0xfc, 0x66, 0x5f, 0x52, 0xee, 0xbc, 0xb4, 0x96, 0xcb,
+		0x0a, 0x34, 0x40, 0x08, 0x60, 0xfa, 0x5e, 0x2a, 0x8c, 0x88, 0x6f, 0x23, 0x4d, 0xf7,
+		0x8f, 0xe6, 0x6e, 0x67, 0x71, 0xc9, 0x84, 0xeb};
+
+uint8_t key_mp4_pe[] = {
+		0x01, 0x2c, 0x2f, 0xf1, 0xe8, 0x82, 0x4f, 0xda, 0x61, 0x02, 0x11, 0x80, 0xf8, 0xc5,
+		0x1d, 0x21, 0x8f, 0xe5, 0x00, 0x84, 0x84, 0x35, 0x3b, 0x41, 0x5a, 0x4a, 0xc7, 0xa9,
+		0xd1, 0xeb, 0x44, 0x2f, 0xfe, 0x3f, 0xa9, 0x11, 0x3f, 0xea, 0x28, 0xf2, 0x31, 0x3e,
+		0x2e, 0x18, 0x05, 0xb8, 0x0e, 0xc1, 0x7f, 0x6d, 0xee, 0x10, 0x77, 0x52, 0x2d, 0x2f,
+		0x89, 0x03, 0x56, 0x97, 0x2a, 0xae, 0x54, 0xaf, 0x8e, 0xdd, 0xc7, 0xed, 0x6d, 0x75,
+		0xfa, 0x44, 0x77, 0xc9, 0x32, 0x15, 0x5b, 0xc6, 0xfe, 0x47, 0xfe, 0x42, 0x5a, 0x1d,
+		0x52, 0xef, 0xd3, 0xb0, 0x37, 0x0b, 0x44, 0xb9, 0x36, 0x63, 0x24, 0x10, 0xb2, 0x97,
+		0x3f, 0xd7, 0x4c, 0x34, 0x3e, 0x58, 0x2f, 0xb2, 0xe2, 0xe5, 0x6e, 0x0b, 0x2f, 0xb0,
+		0xed, 0xae, 0x36, 0xcd, 0xc5, 0xf1, 0xe6, 0x02, 0xa3, 0xa9, 0xf1, 0xf4, 0x1b, 0x8d,
+		0xb5, 0x3b, 0x74, 0xea, 0xb8, 0x17, 0x99, 0xec, 0x38, 0xcb, 0x6e, 0x09, 0xce, 0xe0,
+		0x7a, 0x49, 0x62, 0xf1, 0x30, 0xa5, 0x7e, 0x34, 0xe7, 0x48, 0x48, 0xb3, 0x1b, 0x58,
+		0xf7, 0x48, 0x8c, 0x54, 0xd7, 0xba, 0xe5, 0x2d, 0x60, 0x4e, 0x3d, 0x27, 0x8d, 0x43,
+		0x04, 0x69, 0xb5, 0x14, 0x0d, 0xb7, 0xc3, 0xaf, 0x43, 0x5b, 0x46, 0x5c, 0x10, 0x11,
+		0xfb, 0x83, 0xb8, 0xa2, 0x90, 0xaf, 0xd7, 0x14, 0x27, 0xd9, 0x10, 0xd1, 0x14, 0x70,
+		0xe4, 0xae, 0x12, 0xac, 0xb0, 0x35, 0xf4, 0x74, 0x3c, 0x54, 0x8d, 0xc5, 0x58, 0xd4,
+		0x7b, 0x18, 0x2e, 0x88, 0x49, 0x83, 0x3f, 0xbb, 0x77, 0x29, 0x65, 0x4e, 0x65, 0xb2,
+		0xc8, 0x30, 0x52, 0xbd, 0x8f, 0xaf, 0xdb, 0x4b, 0xa4, 0xe6, 0x11, 0x7e, 0xcc, 0x05,
+		0xf8, 0x50, 0x44, 0x79, 0x80, 0xd3, 0xba, 0xc5, 0xb5, 0x79, 0xe6, 0x51, 0xbd, 0x16,
+		0x90, 0x82, 0x35, 0x6a, 0xf6, 0xcf, 0xb3, 0xcf, 0x15, 0xa5, 0xfc, 0xa8, 0x45, 0xae,
+		0x9c, 0x92, 0x8f, 0xa7, 0xc0, 0xdd, 0x7f, 0x37, 0x88, 0xa4, 0xfd, 0x0f, 0x17, 0xfe,
+		0x20, 0x88, 0x93, 0x22, 0xde, 0xb4, 0x0b, 0x56, 0xf1, 0x7a, 0xd8, 0xcc, 0xac, 0xa7,
+		0x11, 0x2c, 0x86, 0xcc, 0xec, 0x96, 0xc0, 0xb5, 0xad, 0xc1, 0xe1, 0x3d, 0x67, 0xc3,
+		0xd1, 0xc5, 0x44, 0xf2, 0x8e, 0xc0, 0xc3, 0xe8, 0x6b, 0xcd, 0x54, 0x42, 0x7a, 0xb9,
+		0xd3, 0x6d, 0x61, 0x61, 0xf6, 0x22, 0x87, 0x16, 0x1f, 0xef, 0xb5, 0xb7, 0x10, 0x50,
+		0xf9, 0x8e, 0x50, 0x5f, 0x95, 0x04, 0x00, 0x97, 0x4e, 0x47, 0x4d, 0x74, 0x21, 0x57,
+		0x2e, 0x07, 0x7a, 0x2e, 0x3d, 0xf8, 0x91, 0x78, 0x85, 0x07, 0x4e, 0xef, 0x68, 0x3f,
+		0x9e, 0xf7, 0x12, 0x9e, 0xb2, 0x99, 0x33, 0x1c, 0xb1, 0x4b, 0x88, 0xcd, 0x93, 0x8b,
+		0xb2, 0x7d, 0x3e, 0x06, 0x2c, 0xcb, 0x87, 0xa7, 0xa9, 0x57, 0x2b, 0x6f, 0xd1, 0x2c,
+		0x8d, 0x0a, 0x94, 0xde, 0xe3, 0x84, 0xbe, 0x52, 0x2c, 0xff, 0xfb, 0x0b, 0x24, 0x18,
+		0xe3, 0x5a, 0x13, 0xeb, 0xb8, 0x96, 0x16, 0x48, 0x97, 0x70, 0xb7, 0x2b, 0xe7, 0x1f,
+		0xad, 0x38, 0x9c, 0xef, 0xf5, 0xf2, 0x1b, 0xde, 0x90, 0x4c, 0x9b, 0x90, 0x18, 0x81,
+		0x66, 0x3a, 0xac, 0x2e, 0x86, 0x37, 0x0b, 0x64, 0x77, 0x34, 0xb8, 0x8f, 0xb0, 0x0d,
+		0x44, 0x9e, 0xbe, 0xde, 0x83, 0x34, 0xd9, 0x36, 0x3e, 0x03, 0x32, 0x3e, 0xb6, 0x85,
+		0xa3, 0x77, 0xd1, 0x2d, 0xeb, 0xb6, 0x83, 0xd9, 0xff, 0xe8, 0x65, 0x8f, 0x1f, 0xac,
+		0xfe, 0xaa, 0xa6, 0xfc, 0x35, 0xd8, 0x50, 0xe7, 0x41, 0x7f, 0xb1, 0x0b, 0x64, 0xe7,
+		0x8d, 0xd8, 0x50, 0x54, 0x73, 0x94, 0x36, 0xd9, 0x3d, 0x2c, 0x14, 0x41, 0x1b, 0x17,
+		0x19, 0xc0, 0x1b, 0xf4, 0x0e, 0x90, 0x92, 0x71};
+
+uint8_t key_mp4_p1[] = {
+		0xf7, 0xbc, 0x0d, 0xf1, 0x44, 0x6f, 0xcc, 0xb4, 0xe7, 0x11, 0xd9, 0x8b, 0x99, 0x44,
+		0x6a, 0xe1, 0x30, 0x75, 0x09, 0xc9, 0x95, 0x92, 0x41, 0x30, 0xfb, 0xc2, 0xb7, 0x24,
+		0xaa, 0x15, 0x74, 0x11, 0x5d, 0x32, 0xee, 0xc3, 0x6d, 0x3c, 0xcf, 0x16, 0xe6, 0x13,
+		0xd3, 0xb4, 0xbf, 0xb2, 0xde, 0xbb, 0xc8, 0x9e, 0x4a, 0xb0, 0x3c, 0x81, 0x02, 0x0b,
+		0x58, 0x48, 0x05, 0xe8, 0xff, 0x8e, 0xbe, 0x5a, 0x5a, 0x65, 0x0e, 0x3f, 0x7d, 0x22,
+		0x54, 0xcb, 0x2e, 0xbd, 0x6b, 0xc1, 0xf7, 0x2d, 0x32, 0x4b, 0x8b, 0xa2, 0xc4, 0x18,
+		0x62, 0xa3, 0x39, 0x5b, 0x85, 0xaf, 0xc9, 0x7e, 0xa5, 0xb8, 0x3e, 0x79, 0xa6, 0x34,
+		0xe5, 0x12, 0x13, 0x1c, 0x62, 0x57, 0xd3, 0x01, 0x15, 0x36, 0x6f, 0x8e, 0x33, 0x97,
+		0x6a, 0x38, 0xc4, 0xe2, 0x2e, 0x70, 0x00, 0x42, 0x04, 0xf8, 0x8a, 0x3f, 0xd3, 0xe4,
+		0xe9, 0xbd};
+
+uint8_t key_mp4_p2[] = {
+		0xf3, 0xda, 0x15, 0x18, 0x87, 0x40, 0x0d, 0x1a, 0x5e, 0x79, 0x5a, 0x2b, 0xf6, 0xcd,
+		0x44, 0xe4, 0xef, 0xa8, 0x50, 0x8e, 0x52, 0x9c, 0xd7, 0x18, 0x57, 0x4d, 0x70, 0x3c,
+		0xf5, 0xad, 0xf8, 0x1c, 0x41, 0xc6, 0xcf, 0x90, 0xb7, 0x66, 0xd0, 0xbe, 0x9f, 0x1a,
+		0xa9, 0x9e, 0xda, 0x31, 0x6d, 0x74, 0x77, 0xf3, 0xa5, 0x6e, 0x26, 0xa1, 0xfb, 0x88,
+		0x17, 0x74, 0x67, 0xa6, 0xf7, 0x26, 0xa8, 0x93, 0x12, 0x65, 0x40, 0x94, 0x16, 0xa2,
+		0x67, 0x91, 0x7f, 0x79, 0xa8, 0xe8, 0x16, 0xc9, 0x34, 0x19, 0xb0, 0xdd, 0xc5, 0x50,
+		0x11, 0x95, 0x20, 0xe0, 0xa9, 0xb3, 0x24, 0x05, 0x2d, 0x0c, 0x8a, 0x11, 0x1b, 0x91,
+		0xc6, 0x78, 0x33, 0xea, 0xb2, 0xd9, 0xed, 0x68, 0xbd, 0x41, 0x04, 0xba, 0xec, 0x10,
+		0x64, 0xa5, 0x8f, 0x48, 0xbf, 0xea, 0x4c, 0x18, 0xf4, 0x88, 0xc8, 0x15, 0xdb, 0x9e,
+		0xb6, 0xf1};
+
+uint8_t key_mp4_e1[] = {
+		0x94, 0x5c, 0x3a, 0xbd, 0x52, 0x8e, 0xe1, 0xb9, 0x34, 0xe8, 0xab, 0xaf, 0xbe, 0x8a,
+		0x0a, 0xb7, 0xf1, 0x9d, 0x25, 0xcf, 0x63, 0x93, 0xc3, 0x16, 0xe2, 0xaf, 0x29, 0x9e,
+		0xfb, 0x7c, 0xfd, 0x95, 0xa8, 0x8a, 0xe8, 0x12, 0x81, 0x48, 0xf9, 0x7c, 0x6d, 0x2d,
+		0x52, 0x8b, 0xdc, 0x81, 0xf2, 0x81, 0xe3, 0x13, 0x69, 0x07, 0x42, 0x34, 0xc0, 0x54,
+		0xaa, 0xf9, 0xf7, 0x10, 0x22, 0x7c, 0x09, 0xe3, 0x72, 0x5f, 0x32, 0xb9, 0x32, 0xe7,
+		0x6c, 0x80, 0x81, 0xed, 0x4e, 0xab, 0x4a, 0xab, 0xf6, 0x82, 0xe7, 0x8d, 0x02, 0x82,
+		0xd8, 0x0f, 0x88, 0x3a, 0x17, 0x45, 0xbf, 0x15, 0xe9, 0x88, 0xfd, 0x61, 0x3c, 0xf8,
+		0x50, 0x77, 0x12, 0x9a, 0xdd, 0x0a, 0x5b, 0x83, 0x3a, 0x80, 0xef, 0x2d, 0xea, 0x17,
+		0xb3, 0xb5, 0x6b, 0xb3, 0x48, 0xbc, 0x2a, 0x6b, 0x5f, 0x2e, 0xb9, 0x1c, 0xa0, 0x79,
+		0x66, 0xc1};
+
+uint8_t key_mp4_e2[] = {
+		0x73, 0x75, 0x10, 0x83, 0xfa, 0x95, 0xd3, 0x1e, 0x67, 0x18, 0xe2, 0x1e, 0xea, 0xce,
+		0x2a, 0x0e, 0x93, 0x82, 0x88, 0x11, 0xba, 0xff, 0xd3, 0xc0, 0x0c, 0xa5, 0xf7, 0xbc,
+		0x85, 0x3e, 0x87, 0xb9, 0x29, 0x53, 0xae, 0xb7, 0x80, 0x7e, 0xc7, 0xdb, 0x59, 0x8d,
+		0xd0, 0x3e, 0x0c, 0x65, 0x56, 0xc3, 0xcc, 0x7f, 0xaa, 0x16, 0x4b, 0x68, 0x6a, 0xa5,
+		0xf7, 0x25, 0x00, 0x66, 0xc7, 0xa2, 0xa0, 0x32, 0x72, 0x85, 0x4a, 0x5c, 0x53, 0x93,
+		0x35, 0xa2, 0x68, 0x4e, 0xfc, 0x30, 0x57, 0x89, 0x90, 0x87, 0x91, 0x7c, 0x8f, 0x8d,
+		0xe7, 0xa5, 0x4a, 0x59, 0xd5, 0x3f, 0xa2, 0x90, 0x68, 0xd2, 0x05, 0x15, 0x30, 0x8e,
+		0x87, 0x00, 0x26, 0xe4, 0xbb, 0x26, 0x00, 0x08, 0x95, 0x83, 0x11, 0x70, 0x47, 0x91,
+		0x43, 0x76, 0x38, 0x2f, 0x63, 0xde, 0xd5, 0x85, 0x03, 0x53, 0x38, 0x19, 0x51, 0x51,
+		0x06, 0xa1};
+
+uint8_t key_mp4_c[] = {
+		0xed, 0x2a, 0x43, 0x01, 0x1b, 0x2d, 0x44, 0xfc, 0x52, 0x24, 0xc3, 0xdd, 0x65, 0xf0,
+		0x97, 0xfd, 0xc9, 0xe1, 0x16, 0x06, 0x9d, 0x67, 0x7b, 0x30, 0x88, 0x9a, 0xdf, 0xac,
+		0x63, 0x7b, 0x0c, 0x2f, 0xcc, 0x16, 0xdb, 0xcf, 0x62, 0x21, 0x7f, 0x9d, 0x6c, 0xa4,
+		0x4d, 0x3c, 0xcf, 0xfc, 0xd2, 0xdd, 0x14, 0xd1, 0xb3, 0x8e, 0xb3, 0xc8, 0xd0, 0x1d,
+		0x97, 0x1c, 0x49, 0x04, 0xd0, 0xae, 0xd7, 0x22, 0x5e, 0xff, 0xc8, 0x06, 0x4e, 0x9d,
+		0xe2, 0xda, 0xf9, 0xfa, 0x68, 0x6f, 0x76, 0x70, 0x10, 0x8c, 0xa7, 0x02, 0x1a, 0x6e,
+		0x02, 0xdf, 0x0f, 0x80, 0x0d, 0x8e, 0xfd, 0x29, 0xdb, 0x3d, 0x4d, 0xbe, 0xd7, 0xc3,
+		0x85, 0xe4, 0x39, 0xb6, 0xd8, 0x13, 0x20, 0xe2, 0x97, 0x59, 0x03, 0xb0, 0xd7, 0xc8,
+		0xaf, 0xa7, 0x91, 0x33, 0xe2, 0x12, 0xf6, 0x3f, 0xd3, 0x76, 0x95, 0x3b, 0x09, 0x13,
+		0xff, 0xa4};
+
+uint8_t key_mp4_r3[] = {
+		0xec, 0x2c, 0x53, 0xcc, 0x1a, 0x70, 0xce, 0x52, 0xb8, 0x04, 0x69, 0xed, 0x01, 0x85,
+		0x36, 0xff, 0xb8, 0x23, 0xbf, 0x89, 0x16, 0xf9, 0x21, 0xb5, 0xc1, 0x9b, 0xd2, 0xdd,
+		0x68, 0xff, 0xfb, 0x10, 0x04, 0x83, 0x92, 0x57, 0x60, 0x36, 0x12, 0x5a, 0x02, 0xfd,
+		0x2e, 0xe1, 0x0e, 0x5b, 0x63, 0x94, 0x4d, 0x8b, 0x0a, 0xfb, 0x1f, 0x74, 0x0a, 0xd5,
+		0x96, 0x3f, 0x0f, 0x0d, 0xdf, 0xe3, 0xf6, 0xdc, 0x5b, 0x7d, 0x39, 0x66, 0xc9, 0xf9,
+		0x91, 0x5f, 0xa0, 0x52, 0xaf, 0x6a, 0xf1, 0x45, 0x6b, 0x48, 0xfc, 0xb2, 0xbf, 0x49,
+		0xe0, 0xfc, 0xd9, 0x0e, 0x24, 0x86, 0x2e, 0x5f, 0x3e, 0xb5, 0x43, 0xeb, 0xa8, 0x7a,
+		0xe2, 0xd5, 0x0b, 0x60, 0x11, 0xbf, 0x39, 0x80, 0x32, 0x7a, 0xd3, 0x7d, 0x03, 0x52,
+		0x6e, 0x53, 0xff, 0xc4, 0x8c, 0x18, 0x18, 0x39, 0x05, 0x2f, 0x9f, 0xf4, 0x41, 0x1a,
+		0xd3, 0x87};
+
+uint8_t key_mp4_d3[] = {
+		0x6a, 0xa0, 0x08, 0xa5, 0x19, 0x3a, 0xdc, 0xab, 0x93, 0xd0, 0xca, 0x51, 0xea, 0x61,
+		0xce, 0x56, 0xdd, 0x37, 0xa6, 0x7d, 0xaa, 0x15, 0x88, 0x16, 0x9a, 0xf6, 0x52, 0xd9,
+		0x0b, 0x52, 0xa6, 0x72, 0xb0, 0xd7, 0x05, 0xf6, 0xd4, 0xc5, 0x14, 0xbb, 0xf6, 0xa5,
+		0x7f, 0xc8, 0xb3, 0xc6, 0xa6, 0xca, 0x89, 0xc7, 0xc0, 0x89, 0x67, 0xc5, 0xe8, 0x2e,
+		0x4d, 0xca, 0xe2, 0x6d, 0x0d, 0x2b, 0xca, 0x83, 0xe9, 0xfa, 0x3b, 0x34, 0x20, 0xf3,
+		0xbf, 0xa2, 0x40, 0xab, 0x93, 0xee, 0xe0, 0x46, 0xcb, 0x0d, 0x04, 0xa9, 0x5e, 0x9b,
+		0x68, 0x2c, 0x3f, 0x82, 0x97, 0x12, 0xcd, 0x54, 0xca, 0xe6, 0xe3, 0x67, 0x3d, 0x85,
+		0x5d, 0x6b, 0x79, 0xdb, 0x41, 0xa7, 0xe7, 0xb9, 0xed, 0x10, 0x6e, 0xf2, 0xfd, 0xd0,
+		0xf5, 0x66, 0x8f, 0x0e, 0x99, 0x81, 0x37, 0x4e, 0x66, 0xfc, 0xfd, 0x66, 0x35, 0x0e,
+		0x7b, 0x79};
+
+uint8_t key_mp4_t3[] = {
+		0xcf, 0xd8, 0x5c, 0x97, 0x86, 0x04, 0x56, 0x40, 0x30, 0xe5, 0x7b, 0x28, 0xe5, 0x61,
+		0xb2, 0xb6, 0x05, 0x61, 0xd2, 0x99, 0x30, 0x00, 0xb6, 0x46, 0xc7, 0x7f, 0xb9, 0xf6,
+		0x90, 0xf5, 0xdb, 0x51, 0x74, 0x16, 0x14, 0x36, 0xd3, 0xd3, 0xa7, 0x6b, 0x23, 0x22,
+		0xf8, 0x02, 0xdf, 0x0c, 0x81, 0x8d, 0xec, 0xa1, 0xb0, 0x9f, 0x82, 0x11, 0x07, 0x5a,
+		0x91, 0x70, 0xa6, 0xaa, 0x42, 0x6e, 0xb4, 0x6d, 0x35, 0x52, 0xad, 0xfc, 0xf9, 0xfc,
+		0x94, 0x40, 0x0c, 0x4f, 0x32, 0x3b, 0x86, 0xa8, 0x94, 0x5d, 0x85, 0x64, 0x91, 0x2e,
+		0x23, 0x68, 0xf5, 0x4f, 0xa1, 0xd0, 0xb6, 0x77, 0x75, 0xa4, 0x6c, 0x21, 0xb2, 0x67,
+		0x06, 0xa0, 0x54, 0x5c, 0x3a, 0x86, 0x1f, 0x55, 0x9e, 0x7b, 0x44, 0x54, 0x68, 0xb0,
+		0xe0, 0x6e, 0xa5, 0x50, 0xe6, 0x7f, 0xc3, 0xcf, 0x92, 0x03, 0x19, 0x03, 0xe8, 0x27,
+		0xcf, 0x5f};
+
+uint8_t key_mp4_r4[] = {
+		0xd3, 0xb1, 0x72, 0xcb, 0xff, 0xbd, 0x2f, 0x1a, 0xd5, 0x88, 0xa6, 0x8b, 0x29, 0x18,
+		0x10, 0x94, 0x67, 0x0d, 0x6b, 0x18, 0x97, 0x9d, 0xdd, 0x01, 0x78, 0x92, 0x93, 0xc5,
+		0x19, 0x86, 0x13, 0x88, 0x17, 0x9b, 0xc2, 0xc6, 0xa7, 0xae, 0x00, 0x20, 0x99, 0xf1,
+		0x22, 0x60, 0x9e, 0xc3, 0x35, 0x85, 0xae, 0x37, 0xaa, 0x89, 0x50, 0x4c, 0x61, 0x72,
+		0xa4, 0x51, 0xdb, 0xfa, 0xbb, 0x7e, 0xab, 0xfc, 0xfe, 0x0f, 0x9a, 0x6b, 0x8f, 0x12,
+		0x67, 0x71, 0x3a, 0x3e, 0xa2, 0x3b, 0xc8, 0x0c, 0x66, 0x7f, 0x6a, 0x8f, 0xf2, 0xf8,
+		0xe8, 0xec, 0x6d, 0xb7, 0xd5, 0xe6, 0x37, 0x6c, 0x97, 0xab, 0xf8, 0x2a, 0xa8, 0x7f,
+		0x7b, 0xe9, 0x01, 0x63, 0xe8, 0xea, 0xb4, 0x75, 0x97, 0x99, 0x0c, 0xd2, 0xc6, 0xf3,
+		0xc5, 0x1a, 0xc1, 0x0e, 0xe3, 0x61, 0xc8, 0xd3, 0xc7, 0xc8, 0x8a, 0x89, 0x83, 0xd1,
+		0xc7, 0xd1};
+
+uint8_t key_mp4_d4[] = {
+		0x7c, 0x1a, 0x07, 0x06, 0x78, 0xc2, 0x5b, 0x9f, 0x0b, 0x97, 0xb4, 0xaa, 0xd8, 0x48,
+		0x77, 0x4f, 0xc8, 0xaa, 0x21, 0x22, 0xa5, 0x9f, 0xb2, 0x34, 0x6e, 0x8e, 0xdf, 0x7a,
+		0x28, 0xe0, 0x65, 0x0a, 0xdf, 0x6c, 0x3c, 0xdf, 0x60, 0xe5, 0xac, 0xc5, 0x6f, 0xf9,
+		0xe1, 0x01, 0x6b, 0x91, 0x5d, 0x0b, 0x25, 0x7b, 0x14, 0xca, 0xb2, 0xfc, 0x54, 0x14,
+		0x75, 0x28, 0x58, 0x21, 0xc1, 0x51, 0x1d, 0x5a, 0x8f, 0x46, 0x6e, 0x6c, 0xa7, 0xcf,
+		0x4e, 0x3d, 0x1e, 0xbc, 0x21, 0x37, 0x92, 0xab, 0x52, 0x5b, 0x58, 0x09, 0x53, 0x93,
+		0x80, 0x59, 0x3a, 0x69, 0x0f, 0x48, 0x8b, 0x2d, 0x6a, 0x2d, 0x32, 0xab, 0x2f, 0x64,
+		0xad, 0x2b, 0x87, 0xd9, 0x1e, 0x6e, 0x99, 0xa4, 0x66, 0x5f, 0x1f, 0x19, 0x61, 0xf0,
+		0xfe, 0x98, 0x14, 0x9d, 0xb9, 0xc7, 0x55, 0x88, 0x72, 0x12, 0xaa, 0xc4, 0xbb, 0x36,
+		0x7c, 0x41};
+
+uint8_t key_mp4_t4[] = {
+		0x04, 0x60, 0xb9, 0x95, 0x05, 0x68, 0x30, 0xc6, 0x46, 0x4e, 0x27, 0xe8, 0x18, 0xe1,
+		0x2e, 0x3a, 0x63, 0xaa, 0x71, 0x66, 0x32, 0xa7, 0x07, 0x94, 0xac, 0xf0, 0x0f, 0xaa,
+		0xaa, 0x6e, 0x1a, 0xff, 0x8d, 0x2f, 0xb9, 0xa6, 0xbf, 0x67, 0x2a, 0x02, 0xe1, 0xee,
+		0x9a, 0x9e, 0xc3, 0xf1, 0xdf, 0x01, 0x57, 0x15, 0x3e, 0x73, 0xf2, 0x5e, 0x03, 0x99,
+		0x41, 0x19, 0xf5, 0x71, 0x67, 0x13, 0xc1, 0x35, 0x53, 0xa6, 0x31, 0xa2, 0x65, 0x32,
+		0x01, 0xa6, 0xd2, 0x1b, 0x07, 0xb6, 0x01, 0x08, 0x40, 0xe2, 0x64, 0x34, 0x31, 0x6d,
+		0xe3, 0xba, 0xc1, 0xf1, 0x22, 0x2c, 0x3a, 0xd2, 0x3f, 0x41, 0x2c, 0x28, 0x7b, 0x93,
+		0xa1, 0x09, 0x66, 0x68, 0xcb, 0x66, 0x1f, 0x7d, 0x2c, 0x29, 0xfd, 0xac, 0x5e, 0x1b,
+		0xe2, 0x40, 0xf5, 0x4e, 0x0f, 0xdd, 0xd6, 0xb6, 0x13, 0xfb, 0x53, 0xb0, 0x26, 0xde,
+		0x6f, 0x88};
+
+// Two-prime keys of the other supported sizes, served by the same build
+#define KEY_2048_BITS     2048
+
+uint8_t key_2048_m[] = {
+		0xd0, 0xb6, 0x61, 0xb6, 0x3f, 0xea, 0xa4, 0xd1, 0x6f, 0x4b, 0x4f, 0xd0, 0x87, 0x39,
+		0xf9, 0x79, 0x51, 0x75, 0x6e, 0xad, 0xef, 0xcf, 0xbe, 0x75, 0x46, 0x62, 0xe4, 0x15,
+		0xfa, 0x9e, 0x17, 0xce, 0xea, 0x9f, 0x88, 0xc9, 0xdd, 0xa5, 0xed, 0x1a, 0x26, 0xe5,
+		0x54, 0xcb, 0x41, 0x5d, 0x3a, 0x26, 0xf1, 0x57, 0xaa, 0xca, 0xf0, 0x3f, 0x64, 0xdd,
+		0xbe, 0x4e, 0x10, 0xc6, 0xed, 0xa6, 0x33, 0x84, 0x54, 0x9a, 0x3a, 0x36, 0xf8, 0xa9,
+		0x25, 0x3d, 0x23, 0x34, 0x72, 0xaa, 0xf6, 0x13, 0xc8, 0x8d, 0xb7, 0xfb, 0xb4, 0xce,
+		0x5d, 0xb8, 0xe5, 0x8f, 0xab, 0x6a, 0x30, 0x88, 0x12, 0xd8, 0x97, 0xb9, 0x19, 0xef,
+		0xa9, 0xb0, 0x96, 0x35, 0x42, 0xab, 0x97, 0x09, 0x7b, 0x48, 0x83, 0x08, 0xad, 0x9d,
+		0xb8, 0xd2, 0xe4, 0x5e, 0x05, 0x85, 0x4b, 0xe3, 0xd2, 0x79, 0xd9, 0x89, 0xb7, 0x7c,
+		0xee, 0x80, 0x42, 0xd1, 0x2a, 0x54, 0xbb, 0xdc, 0x9f, 0x3e, 0x06, 0xf0, 0x64, 0x1c,
+		0xcd, 0xa6, 0x05, 0x22, 0x70, 0x92, 0xcb, 0x41, 0x8a, 0x72, 0xe7, 0xee, 0x91, 0x33,
+		0xe2, 0x87, 0xad, 0x1a, 0x01, 0x3b, 0xad, 0xf2, 0x6e, 0x74, 0xd0, 0xbc, 0xc5, 0xc2,
+		0xb8, 0xee, 0xf8, 0x77, 0x28, 0x3e, 0x90, 0x31, 0x5b, 0xc5, 0xed, 0xe0, 0x34, 0x52,
+		0x93, 0x58, 0x50, 0xc5, 0xda, 0xda, 0xba, 0xf4, 0xe5, 0xd5, 0xa6, 0x41, 0xe4, 0x6d,
+		0xe8, 0x1f, 0x79, 0xc2, 0xdd, 0xaf, 0xa4, 0x02, 0xdc, 0x22, 0xeb, 0x65, 0x23, 0x7a,
+		0x1c, 0xbf, 0x33, 0xc5, 0xb3, 0x12, 0xb4, 0xfe, 0x98, 0xed, 0x36, 0xf8, 0x1b, 0xc6,
+		0xfb, 0x1f, 0x05, 0xa2, 0x20, 0x9c, 0x03, 0xc4, 0x0b, 0x25, 0x2a, 0x32, 0x1c, 0x3b,
+		0x40, 0xe9, 0x4d, 0xb4, 0x9b, 0x8b, 0x92, 0x28, 0x3a, 0xdc, 0xc1, 0x36, 0x38, 0x31,
+		0x38, 0xab, 0xe1, 0x93};
+
+uint8_t key_2048_pe[] = {
+		0x00, 0xac, 0x76, 0xf3, 0x22, 0xbc, 0x6c, 0x87, 0xe2, 0xd1, 0xae, 0x45, 0x6a, 0x80,
+		0x45, 0x10, 0x0d, 0x3e, 0x93, 0x39, 0x1c, 0xbc, 0x7b, 0x63, 0x4d, 0x10, 0x58, 0xff,
+		0x19, 0x9f, 0x6c, 0x71, 0xbc, 0x5e, 0x15, 0xdc, 0xa9, 0xa2, 0x26, 0xad, 0x8c, 0x13,
+		0x47, 0x99, 0xfd, 0x28, 0x06, 0x2a, 0xa8, 0x69, 0xcd, 0x2c, 0x21, 0x9b, 0xfe, 0xa9,
+		0x4c, 0x3b, 0x28, 0x9e, 0xd1, 0xb4, 0x6a, 0xb8, 0x35, 0xf1, 0xd0, 0x5b, 0x51, 0xde,
+		0x45, 0xc9, 0xfc, 0x28, 0xef, 0x4b, 0x4e, 0x34, 0xd6, 0x7b, 0xf9, 0x23, 0x42, 0x66,
+		0x60, 0x5b, 0x69, 0xaf, 0xff, 0x34, 0x2a, 0x07, 0xd3, 0x36, 0x60, 0x73, 0xcc, 0x46,
+		0x8c, 0x65, 0x54, 0x7f, 0x05, 0x75, 0x36, 0xbb, 0xd2, 0x96, 0x47, 0x9e, 0x3a, 0x2e,
+		0x7e, 0xe4, 0xa1, 0xa9, 0x38, 0x60, 0x24, 0x49, 0x6d, 0x1d, 0x4c, 0x5f, 0xf2, 0x91,
+		0x9e, 0x61, 0xa1, 0x32, 0xf8, 0x09, 0x8c, 0xbf, 0xaf, 0x42, 0x34, 0x01, 0xf6, 0x42,
+		0x3b, 0x73, 0x81, 0x4b, 0xac, 0x63, 0x0f, 0xa0, 0xce, 0xa9, 0x11, 0x8e, 0x4e, 0x74,
+		0x28, 0x4e, 0x1f, 0x02, 0x8c, 0x0f, 0xcb, 0x5e, 0x42, 0x41, 0x44, 0xf7, 0x67, 0x7e,
+		0xd7, 0x38, 0x1b, 0xde, 0xc1, 0x6e, 0xb2, 0x86, 0xf7, 0x52, 0x55, 0xe7, 0xd2, 0xcd,
+		0x57, 0x90, 0xd6, 0x1b, 0x22, 0xe5, 0x79, 0x52, 0xc6, 0x1b, 0xbb, 0x74, 0xb2, 0xa2,
+		0x2f, 0x5a, 0x84, 0x1f, 0xcc, 0xdb, 0xeb, 0x9d, 0xa1, 0x6f, 0x33, 0x9a, 0x5a, 0x4c,
+		0x53, 0xdc, 0xdc, 0x44, 0xa3, 0x47, 0x91, 0xc7, 0x27, 0xd7, 0x0f, 0x44, 0x81, 0x56,
+		0xe4, 0x18, 0x96, 0x21, 0x9f, 0xfd, 0xd7, 0x9e, 0x40, 0x9b, 0xde, 0xb4, 0x39, 0xec,
+		0x23, 0xcc, 0x0b, 0x3b, 0x01, 0xed, 0xd4, 0xef, 0x72, 0x45, 0x1f, 0x81, 0x29, 0x1d,
+		0xb6, 0xf8, 0x8e, 0xa1};
+
+uint8_t key_2048_p1[] = {
+		0xe9, 0xe5, 0xfc, 0x02, 0x44, 0x92, 0x2d, 0x4e, 0x66, 0x6b, 0x90, 0x48, 0x14, 0x17,
+		0x28, 0x5f, 0xe6, 0x6e, 0x41, 0x49, 0x5a, 0xcf, 0x2b, 0xae, 0xd6, 0x08, 0x00, 0x4e,
+		0xdf, 0x20, 0x7d, 0x33, 0x4e, 0x38, 0x1b, 0x24, 0x39, 0xe0, 0x62, 0x94, 0x4a, 0x02,
+		0x3f, 0x30, 0xdc, 0xe6, 0xdd, 0xca, 0xf5, 0x18, 0xac, 0x3c, 0x76, 0x49, 0x36, 0xe6,
+		0xea, 0x06, 0x1f, 0xc8, 0xfc, 0x60, 0xf8, 0xf9, 0x3d, 0xd0, 0xff, 0x31, 0x37, 0x16,
+		0x46, 0xcf, 0xce, 0x3f, 0xd8, 0x77, 0x4e, 0x94, 0x4c, 0x21, 0x20, 0x8b, 0x8d, 0x3c,
+		0xc1, 0xbd, 0xe1, 0x12, 0x9f, 0x5c, 0x75, 0x73, 0xb6, 0x6c, 0x70, 0x14, 0x9e, 0x0a,
+		0x49, 0xb6, 0x21, 0x6a, 0xfd, 0x20, 0xb2, 0x8e, 0x41, 0xfe, 0x3d, 0x12, 0x59, 0x99,
+		0xcf, 0x59, 0x0a, 0x14, 0x31, 0x5b, 0x62, 0xea, 0x59, 0x58, 0x60, 0x5c, 0x7b, 0xae,
+		0x55, 0x8d};
+
+uint8_t key_2048_p2[] = {
+		0xe4, 0x6f, 0x25, 0xcf, 0xa5, 0xc9, 0xd0, 0x53, 0x66, 0xec, 0x4d, 0x4d, 0x9b, 0x84,
+		0xb1, 0x38, 0x69, 0xa6, 0xcd, 0x7b, 0x92, 0x31, 0x5f, 0x83, 0x12, 0xc7, 0x51, 0x49,
+		0xd0, 0x9f, 0xa2, 0xab, 0x27, 0xdb, 0xa0, 0xeb, 0xbd, 0x76, 0x50, 0x48, 0x77, 0xf0,
+		0xde, 0x54, 0xc2, 0xe0, 0x63, 0xc4, 0x48, 0xe3, 0x3b, 0x27, 0x84, 0xe3, 0xc8, 0x08,
+		0xe5, 0x31, 0x08, 0x78, 0xed, 0xfe, 0x23, 0x80, 0x33, 0xeb, 0x1d, 0xe9, 0x1a, 0x44,
+		0x31, 0xf1, 0xbb, 0x68, 0xdb, 0xc9, 0x35, 0xd5, 0x6c, 0x49, 0x74, 0xb1, 0x71, 0x71,
+		0x69, 0xfe, 0x68, 0xea, 0x55, 0xf7, 0x4f, 0xd1, 0x28, 0xf9, 0x06, 0x99, 0xf1, 0xd6,
+		0x27, 0x32, 0x73, 0xbc, 0x14, 0x13, 0xc9, 0xeb, 0x69, 0x89, 0xd4, 0x7b, 0x76, 0xec,
+		0x89, 0xe0, 0xdf, 0x6c, 0x07, 0x4a, 0xd4, 0xe8, 0x19, 0x2c, 0x9d, 0xdc, 0x19, 0xf2,
+		0x7b, 0x9f};
+
+uint8_t key_2048_e1[] = {
+		0xd6, 0x3c, 0xad, 0x83, 0x76, 0x43, 0x5d, 0xf4, 0x3d, 0xa3, 0xb0, 0x58, 0x14, 0xee,
+		0xd1, 0x30, 0x65, 0xe3, 0xff, 0x30, 0xad, 0x58, 0xac, 0xee, 0x4b, 0x64, 0xb0, 0xc3,
+		0x8d, 0x64, 0x38, 0xc9, 0x51, 0x8f, 0xda, 0x6c, 0x68, 0x06, 0xba, 0xc4, 0x90, 0xb5,
+		0x56, 0x23, 0xef, 0x72, 0x17, 0x1c, 0xdb, 0x3a, 0x6a, 0x28, 0x47, 0x3f, 0xf0, 0x65,
+		0xb9, 0x5d, 0x3a, 0xa7, 0xe1, 0x63, 0x01, 0x29, 0x6a, 0x11, 0x90, 0x6d, 0x07, 0xc4,
+		0x03, 0xc0, 0x3b, 0x6e, 0x07, 0x5b, 0xe0, 0x41, 0xbd, 0x29, 0x6a, 0xa1, 0xe8, 0x10,
+		0x0a, 0x75, 0x5d, 0x3e, 0xad, 0x71, 0x06, 0xb3, 0xa2, 0x17, 0xd8, 0xe1, 0x49, 0x90,
+		0xaa, 0xcb, 0x83, 0xf8, 0x77, 0x3a, 0x07, 0xd2, 0x7d, 0x67, 0xdd, 0x90, 0x7d, 0x39,
+		0x80, 0xce, 0x51, 0x89, 0x05, 0x5c, 0x6b, 0x51, 0xb3, 0xdc, 0x5b, 0x06, 0xda, 0xd2,
+		0x67, 0xd1};
+
+uint8_t key_2048_e2[] = {
+		0x0c, 0x07, 0x5a, 0x4b, 0x5b, 0xe4, 0x8b, 0xa6, 0xc8, 0xa5, 0xaa, 0xd0, 0x6a, 0x5f,
+		0x0b, 0x61, 0xf8, 0x16, 0x43, 0x7d, 0xbd, 0x4e, 0x02, 0x44, 0x89, 0xa9, 0x9b, 0x3b,
+		0x32, 0xd4, 0x25, 0x21, 0xb4, 0x20, 0x99, 0x91, 0xb0, 0x51, 0x59, 0x9a, 0xe7, 0x4d,
+		0xf4, 0xb7, 0x2b, 0xe7, 0xda, 0xf9, 0x0c, 0x09, 0x83, 0x24, 0xea, 0x97, 0x80, 0x02,
+		0x0f, 0xe7, 0x8c, 0x15, 0xaa, 0x1a, 0x96, 0xcd, 0xfa, 0x6d, 0xe8, 0x0e, 0x4d, 0x46,
+		0xc8, 0x06, 0x7d, 0xa2, 0xe0, 0xe7, 0xf0, 0x80, 0xc3, 0x89, 0xfe, 0xae, 0x15, 0x56,
+		0x2e, 0x89, 0xaa, 0x06, 0xa4, 0xee, 0x37, 0xf2, 0xc0, 0xa0, 0x94, 0x5b, 0x68, 0xe3,
+		0xa8, 0xfe, 0xbc, 0x1f, 0x6c, 0x43, 0x3a, 0x7f, 0xbd, 0xf7, 0xf7, 0x0b, 0x65, 0x50,
+		0xc1, 0x55, 0xe9, 0x0d, 0xec, 0x38, 0x61, 0x8b, 0xb3, 0x3f, 0xa9, 0x34, 0x5c, 0xdd,
+		0x6a, 0xeb};
+
+uint8_t key_2048_c[] = {
+		0x76, 0xef, 0x5d, 0xb7, 0xcb, 0x2d, 0x6c, 0x45, 0xdd, 0x8c, 0x39, 0x88, 0x8d, 0x04,
+		0x3b, 0x74, 0x6e, 0xaf, 0xb1, 0xf0, 0x1c, 0xf5, 0xc0, 0x1e, 0x6c, 0xe1, 0x12, 0x69,
+		0xdf, 0x52, 0x14, 0x9b, 0x88, 0x3a, 0xc2, 0x03, 0xd7, 0xe3, 0x0c, 0x40, 0xe9, 0xf2,
+		0x76, 0xe0, 0x72, 0x99, 0x66, 0x2b, 0xf6, 0x6b, 0x9f, 0x43, 0x83, 0xcd, 0x60, 0x15,
+		0xb7, 0x5d, 0x52, 0x57, 0x17, 0xd7, 0x08, 0xca, 0x85, 0xf0, 0xab, 0x38, 0x81, 0x09,
+		0x8c, 0x4e, 0xb6, 0x7f, 0xfc, 0x51, 0x62, 0x28, 0x87, 0x5d, 0x45, 0x92, 0x02, 0x4c,
+		0x89, 0xf0, 0x65, 0x45, 0xcd, 0xee, 0xdf, 0x8f, 0x48, 0x96, 0xb8, 0x82, 0xdb, 0x63,
+		0x4a, 0xab, 0x9f, 0x44, 0xc6, 0xee, 0x70, 0xae, 0x2d, 0xb3, 0x5a, 0xfa, 0xf2, 0xe2,
+		0xa0, 0xd8, 0xe1, 0xc5, 0xfe, 0x31, 0xc5, 0x24, 0x27, 0xff, 0xd0, 0x90, 0xdd, 0x72,
+		0x19, 0xaf};
+
+// The 2048-bit key above as DER: PKCS#8 PrivateKeyInfo and X.509 SubjectPublicKeyInfo
+uint8_t key_2048_pkcs8[] = {
+		0x30, 0x82, 0x04, 0xbd, 0x02, 0x01, 0x00, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48,
+		0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x04, 0x82, 0x04, 0xa7, 0x30, 0x82,
+		0x04, 0xa3, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00, 0xd0, 0xb6, 0x61, 0xb6,
+		0x3f, 0xea, 0xa4, 0xd1, 0x6f, 0x4b, 0x4f, 0xd0, 0x87, 0x39, 0xf9, 0x79, 0x51, 0x75,
+		0x6e, 0xad, 0xef, 0xcf, 0xbe, 0x75, 0x46, 0x62, 0xe4, 0x15, 0xfa, 0x9e, 0x17, 0xce,
+		0xea, 0x9f, 0x88, 0xc9, 0xdd, 0xa5, 0xed, 0x1a, 0x26, 0xe5, 0x54, 0xcb, 0x41, 0x5d,
+		0x3a, 0x26, 0xf1, 0x57, 0xaa, 0xca, 0xf0, 0x3f, 0x64, 0xdd, 0xbe, 0x4e, 0x10, 0xc6,
+		0xed, 0xa6, 0x33, 0x84, 0x54, 0x9a, 0x3a, 0x36, 0xf8, 0xa9, 0x25, 0x3d, 0x23, 0x34,
+		0x72, 0xaa, 0xf6, 0x13, 0xc8, 0x8d, 0xb7, 0xfb, 0xb4, 0xce, 0x5d, 0xb8, 0xe5, 0x8f,
+		0xab, 0x6a, 0x30, 0x88, 0x12, 0xd8, 0x97, 0xb9, 0x19, 0xef, 0xa9, 0xb0, 0x96, 0x35,
+		0x42, 0xab, 0x97, 0x09, 0x7b, 0x48, 0x83, 0x08, 0xad, 0x9d, 0xb8, 0xd2, 0xe4, 0x5e,
+		0x05, 0x85, 0x4b, 0xe3, 0xd2, 0x79, 0xd9, 0x89, 0xb7, 0x7c, 0xee, 0x80, 0x42, 0xd1,
+		0x2a, 0x54, 0xbb, 0xdc, 0x9f, 0x3e, 0x06, 0xf0, 0x64, 0x1c, 0xcd, 0xa6, 0x05, 0x22,
+		0x70, 0x92, 0xcb, 0x41, 0x8a, 0x72, 0xe7, 0xee, 0x91, 0x33, 0xe2, 0x87, 0xad, 0x1a,
+		0x01, 0x3b, 0xad, 0xf2, 0x6e, 0x74, 0xd0, 0xbc, 0xc5, 0xc2, 0xb8, 0xee, 0xf8, 0x77,
+		0x28, 0x3e, 0x90, 0x31, 0x5b, 0xc5, 0xed, 0xe0, 0x34, 0x52, 0x93, 0x58, 0x50, 0xc5,
+		0xda, 0xda, 0xba, 0xf4, 0xe5, 0xd5, 0xa6, 0x41, 0xe4, 0x6d, 0xe8, 0x1f, 0x79, 0xc2,
+		0xdd, 0xaf, 0xa4, 0x02, 0xdc, 0x22, 0xeb, 0x65, 0x23, 0x7a, 0x1c, 0xbf, 0x33, 0xc5,
+		0xb3, 0x12, 0xb4, 0xfe, 0x98, 0xed, 0x36, 0xf8, 0x1b, 0xc6, 0xfb, 0x1f, 0x05, 0xa2,
+		0x20, 0x9c, 0x03, 0xc4, 0x0b, 0x25, 0x2a, 0x32, 0x1c, 0x3b, 0x40, 0xe9, 0x4d, 0xb4,
+		0x9b, 0x8b, 0x92, 0x28, 0x3a, 0xdc, 0xc1, 0x36, 0x38, 0x31, 0x38, 0xab, 0xe1, 0x93,
+		0x02, 0x03, 0x01, 0x00, 0x01, 0x02, 0x82, 0x01, 0x00, 0x00, 0xac, 0x76, 0xf3, 0x22,
+		0xbc, 0x6c, 0x87, 0xe2, 0xd1, 0xae, 0x45, 0x6a, 0x80, 0x45, 0x10, 0x0d, 0x3e, 0x93,
+		0x39, 0x1c, 0xbc, 0x7b, 0x63, 0x4d, 0x10, 0x58, 0xff, 0x19, 0x9f, 0x6c, 0x71, 0xbc,
+		0x5e, 0x15, 0xdc, 0xa9, 0xa2, 0x26, 0xad, 0x8c, 0x13, 0x47, 0x99, 0xfd, 0x28, 0x06,
+		0x2a, 0xa8, 0x69, 0xcd, 0x2c, 0x21, 0x9b, 0xfe, 0xa9, 0x4c, 0x3b, 0x28, 0x9e, 0xd1,
+		0xb4, 0x6a, 0xb8, 0x35, 0xf1, 0xd0, 0x5b, 0x51, 0xde, 0x45, 0xc9, 0xfc, 0x28, 0xef,
+		0x4b, 0x4e, 0x34, 0xd6, 0x7b, 0xf9, 0x23, 0x42, 0x66, 0x60, 0x5b, 0x69, 0xaf, 0xff,
+		0x34, 0x2a, 0x07, 0xd3, 0x36, 0x60, 0x73, 0xcc, 0x46, 0x8c, 0x65, 0x54, 0x7f, 0x05,
+		0x75, 0x36, 0xbb, 0xd2, 0x96, 0x47, 0x9e, 0x3a, 0x2e, 0x7e, 0xe4, 0xa1, 0xa9, 0x38,
+		0x60, 0x24, 0x49, 0x6d, 0x1d, 0x4c, 0x5f, 0xf2, 0x91, 0x9e, 0x61, 0xa1, 0x32, 0xf8,
+		0x09, 0x8c, 0xbf, 0xaf, 0x42, 0x34, 0x01, 0xf6, 0x42, 0x3b, 0x73, 0x81, 0x4b, 0xac,
+		0x63, 0x0f, 0xa0, 0xce, 0xa9, 0x11, 0x8e, 0x4e, 0x74, 0x28, 0x4e, 0x1f, 0x02, 0x8c,
+		0x0f, 0xcb, 0x5e, 0x42, 0x41, 0x44, 0xf7, 0x67, 0x7e, 0xd7, 0x38, 0x1b, 0xde, 0xc1,
+		0x6e, 0xb2, 0x86, 0xf7, 0x52, 0x55, 0xe7, 0xd2, 0xcd, 0x57, 0x90, 0xd6, 0x1b, 0x22,
+		0xe5, 0x79, 0x52, 0xc6, 0x1b, 0xbb, 0x74, 0xb2, 0xa2, 0x2f, 0x5a, 0x84, 0x1f, 0xcc,
+		0xdb, 0xeb, 0x9d, 0xa1, 0x6f, 0x33, 0x9a, 0x5a, 0x4c, 0x53, 0xdc, 0xdc, 0x44, 0xa3,
+		0x47, 0x91, 0xc7, 0x27, 0xd7, 0x0f, 0x44, 0x81, 0x56, 0xe4, 0x18, 0x96, 0x21, 0x9f,
+		0xfd, 0xd7, 0x9e, 0x40, 0x9b, 0xde, 0xb4, 0x39, 0xec, 0x23, 0xcc, 0x0b, 0x3b, 0x01,
+		0xed, 0xd4, 0xef, 0x72, 0x45, 0x1f, 0x81, 0x29, 0x1d, 0xb6, 0xf8, 0x8e, 0xa1, 0x02,
+		0x81, 0x81, 0x00, 0xe9, 0xe5, 0xfc, 0x02, 0x44, 0x92, 0x2d, 0x4e, 0x66, 0x6b, 0x90,
+		0x48, 0x14, 0x17, 0x28, 0x5f, 0xe6, 0x6e, 0x41, 0x49, 0x5a, 0xcf, 0x2b, 0xae, 0xd6,
+		0x08, 0x00, 0x4e, 0xdf, 0x20, 0x7d, 0x33, 0x4e, 0x38, 0x1b, 0x24, 0x39, 0xe0, 0x62,
+		0x94, 0x4a, 0x02, 0x3f, 0x30, 0xdc, 0xe6, 0xdd, 0xca, 0xf5, 0x18, 0xac, 0x3c, 0x76,
+		0x49, 0x36, 0xe6, 0xea, 0x06, 0x1f, 0xc8, 0xfc, 0x60, 0xf8, 0xf9, 0x3d, 0xd0, 0xff,
+		0x31, 0x37, 0x16, 0x46, 0xcf, 0xce, 0x3f, 0xd8, 0x77, 0x4e, 0x94, 0x4c, 0x21, 0x20,
+		0x8b, 0x8d, 0x3c, 0xc1, 0xbd, 0xe1, 0x12, 0x9f, 0x5c, 0x75, 0x73, 0xb6, 0x6c, 0x70,
+		0x14, 0x9e, 0x0a, 0x49, 0xb6, 0x21, 0x6a, 0xfd, 0x20, 0xb2, 0x8e, 0x41, 0xfe, 0x3d,
+		0x12, 0x59, 0x99, 0xcf, 0x59, 0x0a, 0x14, 0x31, 0x5b, 0x62, 0xea, 0x59, 0x58, 0x60,
+		0x5c, 0x7b, 0xae, 0x55, 0x8d, 0x02, 0x81, 0x81, 0x00, 0xe4, 0x6f, 0x25, 0xcf, 0xa5,
+		0xc9, 0xd0, 0x53, 0x66, 0xec, 0x4d, 0x4d, 0x9b, 0x84, 0xb1, 0x38, 0x69, 0xa6, 0xcd,
+		0x7b, 0x92, 0x31, 0x5f, 0x83, 0x12, 0xc7, 0x51, 0x49, 0xd0, 0x9f, 0xa2, 0xab, 0x27,
+		0xdb, 0xa0, 0xeb, 0xbd, 0x76, 0x50, 0x48, 0x77, 0xf0, 0xde, 0x54, 0xc2, 0xe0, 0x63,
+		0xc4, 0x48, 0xe3, 0x3b, 0x27, 0x84, 0xe3, 0xc8, 0x08, 0xe5, 0x31, 0x08, 0x78, 0xed,
+		0xfe, 0x23, 0x80, 0x33, 0xeb, 0x1d, 0xe9, 0x1a, 0x44, 0x31, 0xf1, 0xbb, 0x68, 0xdb,
+		0xc9, 0x35, 0xd5, 0x6c, 0x49, 0x74, 0xb1, 0x71, 0x71, 0x69, 0xfe, 0x68, 0xea, 0x55,
+		0xf7, 0x4f, 0xd1, 0x28, 0xf9, 0x06, 0x99, 0xf1, 0xd6, 0x27, 0x32, 0x73, 0xbc, 0x14,
+		0x13, 0xc9, 0xeb, 0x69, 0x89, 0xd4, 0x7b, 0x76, 0xec, 0x89, 0xe0, 0xdf, 0x6c, 0x07,
+		0x4a, 0xd4, 0xe8, 0x19, 0x2c, 0x9d, 0xdc, 0x19, 0xf2, 0x7b, 0x9f, 0x02, 0x81, 0x81,
+		0x00, 0xd6, 0x3c, 0xad, 0x83, 0x76, 0x43, 0x5d, 0xf4, 0x3d, 0xa3, 0xb0, 0x58, 0x14,
+		0xee, 0xd1, 0x30, 0x65, 0xe3, 0xff, 0x30, 0xad, 0x58, 0xac, 0xee, 0x4b, 0x64, 0xb0,
+		0xc3, 0x8d, 0x64, 0x38, 0xc9, 0x51, 0x8f, 0xda, 0x6c, 0x68, 0x06, 0xba, 0xc4, 0x90,
+		0xb5, 0x56, 0x23, 0xef, 0x72, 0x17, 0x1c, 0xdb, 0x3a, 0x6a, 0x28, 0x47, 0x3f, 0xf0,
+		0x65, 0xb9, 0x5d, 0x3a, 0xa7, 0xe1, 0x63, 0x01, 0x29, 0x6a, 0x11, 0x90, 0x6d, 0x07,
+		0xc4, 0x03, 0xc0, 0x3b, 0x6e, 0x07, 0x5b, 0xe0, 0x41, 0xbd, 0x29, 0x6a, 0xa1, 0xe8,
+		0x10, 0x0a, 0x75, 0x5d, 0x3e, 0xad, 0x71, 0x06, 0xb3, 0xa2, 0x17, 0xd8, 0xe1, 0x49,
+		0x90, 0xaa, 0xcb, 0x83, 0xf8, 0x77, 0x3a, 0x07, 0xd2, 0x7d, 0x67, 0xdd, 0x90, 0x7d,
+		0x39, 0x80, 0xce, 0x51, 0x89, 0x05, 0x5c, 0x6b, 0x51, 0xb3, 0xdc, 0x5b, 0x06, 0xda,
+		0xd2, 0x67, 0xd1, 0x02, 0x81, 0x80, 0x0c, 0x07, 0x5a, 0x4b, 0x5b, 0xe4, 0x8b, 0xa6,
+		0xc8, 0xa5, 0xaa, 0xd0, 0x6a, 0x5f, 0x0b, 0x61, 0xf8, 0x16, 0x43, 0x7d, 0xbd, 0x4e,
+		0x02, 0x44, 0x89, 0xa9, 0x9b, 0x3b, 0x32, 0xd4, 0x25, 0x21, 0xb4, 0x20, 0x99, 0x91,
+		0xb0, 0x51, 0x59, 0x9a, 0xe7, 0x4d, 0xf4, 0xb7, 0x2b, 0xe7, 0xda, 0xf9, 0x0c, 0x09,
+		0x83, 0x24, 0xea, 0x97, 0x80, 0x02, 0x0f, 0xe7, 0x8c, 0x15, 0xaa, 0x1a, 0x96, 0xcd,
+		0xfa, 0x6d, 0xe8, 0x0e, 0x4d, 0x46, 0xc8, 0x06, 0x7d, 0xa2, 0xe0, 0xe7, 0xf0, 0x80,
+		0xc3, 0x89, 0xfe, 0xae, 0x15, 0x56, 0x2e, 0x89, 0xaa, 0x06, 0xa4, 0xee, 0x37, 0xf2,
+		0xc0, 0xa0, 0x94, 0x5b, 0x68, 0xe3, 0xa8, 0xfe, 0xbc, 0x1f, 0x6c, 0x43, 0x3a, 0x7f,
+		0xbd, 0xf7, 0xf7, 0x0b, 0x65, 0x50, 0xc1, 0x55, 0xe9, 0x0d, 0xec, 0x38, 0x61, 0x8b,
+		0xb3, 0x3f, 0xa9, 0x34, 0x5c, 0xdd, 0x6a, 0xeb, 0x02, 0x81, 0x80, 0x76, 0xef, 0x5d,
+		0xb7, 0xcb, 0x2d, 0x6c, 0x45, 0xdd, 0x8c, 0x39, 0x88, 0x8d, 0x04, 0x3b, 0x74, 0x6e,
+		0xaf, 0xb1, 0xf0, 0x1c, 0xf5, 0xc0, 0x1e, 0x6c, 0xe1, 0x12, 0x69, 0xdf, 0x52, 0x14,
+		0x9b, 0x88, 0x3a, 0xc2, 0x03, 0xd7, 0xe3, 0x0c, 0x40, 0xe9, 0xf2, 0x76, 0xe0, 0x72,
+		0x99, 0x66, 0x2b, 0xf6, 0x6b, 0x9f, 0x43, 0x83, 0xcd, 0x60, 0x15, 0xb7, 0x5d, 0x52,
+		0x57, 0x17, 0xd7, 0x08, 0xca, 0x85, 0xf0, 0xab, 0x38, 0x81, 0x09, 0x8c, 0x4e, 0xb6,
+		0x7f, 0xfc, 0x51, 0x62, 0x28, 0x87, 0x5d, 0x45, 0x92, 0x02, 0x4c, 0x89, 0xf0, 0x65,
+		0x45, 0xcd, 0xee, 0xdf, 0x8f, 0x48, 0x96, 0xb8, 0x82, 0xdb, 0x63, 0x4a, 0xab, 0x9f,
+		0x44, 0xc6, 0xee, 0x70, 0xae, 0x2d, 0xb3, 0x5a, 0xfa, 0xf2, 0xe2, 0xa0, 0xd8, 0xe1,
+		0xc5, 0xfe, 0x31, 0xc5, 0x24, 0x27, 0xff, 0xd0, 0x90, 0xdd, 0x72, 0x19, 0xaf};
+
+uint8_t key_2048_spki[] = {
+		0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d,
+		0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a,
+		0x02, 0x82, 0x01, 0x01, 0x00, 0xd0, 0xb6, 0x61, 0xb6, 0x3f, 0xea, 0xa4, 0xd1, 0x6f,
+		0x4b, 0x4f, 0xd0, 0x87, 0x39, 0xf9, 0x79, 0x51, 0x75, 0x6e, 0xad, 0xef, 0xcf, 0xbe,
+		0x75, 0x46, 0x62, 0xe4, 0x15, 0xfa, 0x9e, 0x17, 0xce, 0xea, 0x9f, 0x88, 0xc9, 0xdd,
+		0xa5, 0xed, 0x1a, 0x26, 0xe5, 0x54, 0xcb, 0x41, 0x5d, 0x3a, 0x26, 0xf1, 0x57, 0xaa,
+		0xca, 0xf0, 0x3f, 0x64, 0xdd, 0xbe, 0x4e, 0x10, 0xc6, 0xed, 0xa6, 0x33, 0x84, 0x54,
+		0x9a, 0x3a, 0x36, 0xf8, 0xa9, 0x25, 0x3d, 0x23, 0x34, 0x72, 0xaa, 0xf6, 0x13, 0xc8,
+		0x8d, 0xb7, 0xfb, 0xb4, 0xce, 0x5d, 0xb8, 0xe5, 0x8f, 0xab, 0x6a, 0x30, 0x88, 0x12,
+		0xd8, 0x97, 0xb9, 0x19, 0xef, 0xa9, 0xb0, 0x96, 0x35, 0x42, 0xab, 0x97, 0x09, 0x7b,
+		0x48, 0x83, 0x08, 0xad, 0x9d, 0xb8, 0xd2, 0xe4, 0x5e, 0x05, 0x85, 0x4b, 0xe3, 0xd2,
+		0x79, 0xd9, 0x89, 0xb7, 0x7c, 0xee, 0x80, 0x42, 0xd1, 0x2a, 0x54, 0xbb, 0xdc, 0x9f,
+		0x3e, 0x06, 0xf0, 0x64, 0x1c, 0xcd, 0xa6, 0x05, 0x22, 0x70, 0x92, 0xcb, 0x41, 0x8a,
+		0x72, 0xe7, 0xee, 0x91, 0x33, 0xe2, 0x87, 0xad, 0x1a, 0x01, 0x3b, 0xad, 0xf2, 0x6e,
+		0x74, 0xd0, 0xbc, 0xc5, 0xc2, 0xb8, 0xee, 0xf8, 0x77, 0x28, 0x3e, 0x90, 0x31, 0x5b,
+		0xc5, 0xed, 0xe0, 0x34, 0x52, 0x93, 0x58, 0x50, 0xc5, 0xda, 0xda, 0xba, 0xf4, 0xe5,
+		0xd5, 0xa6, 0x41, 0xe4, 0x6d, 0xe8, 0x1f, 0x79, 0xc2, 0xdd, 0xaf, 0xa4, 0x02, 0xdc,
+		0x22, 0xeb, 0x65, 0x23, 0x7a, 0x1c, 0xbf, 0x33, 0xc5, 0xb3, 0x12, 0xb4, 0xfe, 0x98,
+		0xed, 0x36, 0xf8, 0x1b, 0xc6, 0xfb, 0x1f, 0x05, 0xa2, 0x20, 0x9c, 0x03, 0xc4, 0x0b,
+		0x25, 0x2a, 0x32, 0x1c, 0x3b, 0x40, 0xe9, 0x4d, 0xb4, 0x9b, 0x8b, 0x92, 0x28, 0x3a,
+		0xdc, 0xc1, 0x36, 0x38, 0x31, 0x38, 0xab, 0xe1, 0x93, 0x02, 0x03, 0x01, 0x00, 0x01};
+
+#define KEY_3072_BITS     3072
+
+uint8_t key_3072_m[] = {
+		0xb6, 0xf3, 0xbc, 0xc4, 0xfd, 0x1e, 0x79, 0xff, 0xbb, 0xcf, 0x2b, 0x11, 0x53, 0x97,
+		0xa0, 0xdd, 0xe2, 0x75, 0x06, 0xdb, 0x0c, 0x76, 0x79, 0x78, 0xe7, 0xf0, 0x04, 0x78,
+		0x2b, 0xba, 0xff, 0xbe, 0xf1, 0x0e, 0xcb, 0x2f, 0x29, 0xe7, 0x65, 0x36, 0x3b, 0x9c,
+		0x08, 0x2d, 0x34, 0xcf, 0x3f, 0x6c, 0x21, 0x97, 0xfe, 0xdf, 0xef, 0xb7, 0xdb, 0x33,
+		0x88, 0x80, 0x4f, 0xbc, 0x2b, 0xd4, 0x87, 0xed, 0x00, 0x3f, 0x68, 0xe5, 0x06, 0xfa,
+		0xc4, 0xca, 0xc2, 0x64, 0xa7, 0x00, 0x4d, 0x99, 0xf6, 0x42, 0x53, 0x15, 0xf0, 0xc0,
+		0xa2, 0xed, 0xf2, 0x9b, 0xf9, 0x21, 0xf1, 0x50, 0x41, 0x73, 0x92, 0x00, 0xcf, 0x4b,
+		0xbc, 0x7b, 0x7a, 0x3b, 0xbb, 0x6a, 0xc2, 0xbb, 0xf6, 0x93, 0x0e, 0x59, 0xb3, 0xb9,
+		0x3f, 0x92, 0x79, 0x6f, 0x10, 0xa1, 0x69, 0xd4, 0x00, 0xbd, 0xa9, 0x00, 0xba, 0xed,
+		0x8f, 0x88, 0x99, 0x09, 0xdb, 0x47, 0xe6, 0x9f, 0x95, 0xa1, 0xa8, 0xef, 0xe6, 0x8b,
+		0xfe, 0x5b, 0x1d, 0x6c, 0xcd, 0x63, 0x1f, 0xe1, 0x47, 0x90, 0xf5, 0x88, 0xfc, 0xbb,
+		0xe7, 0x29, 0xef, 0x4e, 0x4f, 0xc0, 0x26, 0x35, 0xb0, 0x80, 0x91, 0x87, 0xe9, 0x88,
+		0x33, 0x5b, 0x66, 0xe9, 0xa9, 0x5f, 0x3c, 0xa0, 0xad, 0xc5, 0x58, 0xeb, 0xe7, 0x98,
+		0xab, 0x4a, 0x73, 0xea, 0x73, 0x4f, 0xd7, 0xc6, 0x10, 0xca, 0x51, 0x80, 0x64, 0x05,
+		0x14, 0xf5, 0x22, 0xb4, 0xa9, 0xa5, 0x56, 0x6c, 0xea, 0x71, 0x8e, 0x31, 0x14, 0x9b,
+		0x76, 0x29, 0xca, 0x8b, 0x10, 0xa9, 0x8d, 0xc4, 0x32, 0x81, 0xbe, 0xbe, 0x17, 0xd9,
+		0x8e, 0x60, 0x1f, 0x3e, 0x54, 0xdd, 0x4f, 0xf8, 0x30, 0x33, 0x19, 0x08, 0x90, 0x2f,
+		0x1e, 0x0c, 0x33, 0x77, 0x1a, 0x53, 0xc7, 0xef, 0xa2, 0xd3, 0xcf, 0x6c, 0xe9, 0x83,
+		0x06, 0x52, 0x98, 0x17, 0x7c, 0x19, 0x18, 0x35, 0x5f, 0x02, 0x7d, 0x0d, 0x9e, 0xf4,
+		0x42, 0x9b, 0xbb, 0x1b, 0x65, 0xdd, 0xba, 0x98, 0x47, 0xda, 0xc3, 0x54, 0xbe, 0x11,
+		0x9e, 0x96, 0x2e, 0x77, 0x8e, 0x6c, 0xf4, 0x09, 0x54, 0x5f, 0xcc, 0xe0, 0xf2, 0x1c,
+		0xe3, 0x0a, 0x96, 0x2a, 0xf1, 0xeb, 0x38, 0xc5, 0xf4, 0x3f, 0x95, 0x26, 0x15, 0x96,
+		0x2c, 0xa5, 0xbc, 0xa7, 0xe3, 0x0e, 0xa6, 0xb4, 0xdc, 0xe9, 0x55, 0xd0, 0xca, 0x92,
+		0x4f, 0xa8, 0x54, 0x18, 0xed, 0x68, 0xd7, 0x8b, 0xf1, 0x17, 0xf7, 0x3a, 0xe2, 0x13,
+		0x30, 0x96, 0xad, 0x82, 0x66, 0xfb, 0xee, 0xad, 0x9b, 0x96, 0xde, 0x9e, 0x3e, 0xcd,
+		0xd0, 0x9e, 0x31, 0xf3, 0xc8, 0x09, 0x92, 0xbf, 0xfc, 0x15, 0x44, 0x91, 0x96, 0xe6,
+		0x49, 0x01, 0x26, 0x25, 0xf1, 0xff, 0x89, 0x8f, 0x5f, 0xa4, 0xb6, 0x6a, 0xba, 0xff,
+		0x62, 0xc6, 0xb9, 0x95, 0x58, 0x8f};
+
+uint8_t key_3072_pe[] = {
+		0x08, 0x89, 0xbe, 0x75, 0x09, 0x05, 0x0b, 0x97, 0x82, 0x39, 0xcc, 0x5e, 0x3e, 0x22,
+		0xf4, 0xe8, 0x76, 0x01, 0x95, 0x24, 0xd2, 0xe3, 0x92, 0x8e, 0xb0, 0x70, 0x54, 0x9d,
+		0x11, 0x19, 0x64, 0x87, 0x12, 0x33, 0xe9, 0x0a, 0x95, 0xef, 0x8d, 0x1b, 0x27, 0x54,
+		0x04, 0x53, 0xab, 0xc3, 0xc2, 0x47, 0x77, 0x17, 0xe3, 0x56, 0xab, 0x16, 0xce, 0xfd,
+		0x8c, 0x30, 0xc4, 0xc7, 0xd8, 0xd9, 0xcd, 0xd0, 0x23, 0x33, 0x52, 0x5f, 0x61, 0xe0,
+		0x81, 0x1f, 0x9f, 0x4b, 0xd8, 0x39, 0x5c, 0xe5, 0xc3, 0x06, 0xdc, 0x5e, 0xc9, 0x42,
+		0x0c, 0x38, 0x83, 0x9a, 0x80, 0xd9, 0x73, 0x2c, 0x16, 0x29, 0xe1, 0x15, 0xf5, 0x96,
+		0xa8, 0xc0, 0xb0, 0x77, 0x2a, 0x2b, 0x74, 0xd4, 0x15, 0xd1, 0x4e, 0x19, 0xa4, 0x98,
+		0x10, 0x1d, 0xf3, 0x59, 0xda, 0x12, 0x56, 0x60, 0x84, 0xfa, 0x54, 0xf1, 0x4a, 0x47,
+		0xfc, 0xeb, 0x58, 0x8d, 0x0b, 0xb5, 0x42, 0xcf, 0x8e, 0xc9, 0xa1, 0x1b, 0x35, 0x0c,
+		0xb2, 0x7d, 0xa9, 0x15, 0x63, 0x4e, 0x6d, 0x75, 0xf3, 0x83, 0x91, 0xd9, 0xe7, 0x45,
+		0x93, 0xa7, 0xb2, 0xd9, 0xda, 0x41, 0xf2, 0xe6, 0x8d, 0x8a, 0xaa, 0x80, 0x07, 0xc7,
+		0x89, 0xf2, 0x09, 0x8e, 0xfd, 0x0f, 0x0b, 0x42, 0xca, 0x69, 0x4b, 0xd9, 0x92, 0x90,
+		0xde, 0xe9, 0x96, 0x18, 0x4a, 0x72, 0x5e, 0xf5, 0x08, 0xe2, 0x7b, 0xd3, 0x6a, 0x96,
+		0xc8, 0x65, 0x17, 0x94, 0xa9, 0xe3, 0xe6, 0xf0, 0x07, 0x29, 0x90, 0x07, 0x22, 0x77,
+		0xf1, 0x62, 0x44, 0x29, 0x76, 0x3e, 0xd3, 0xab, 0x67, 0x30, 0x94, 0x24, 0x2a, 0x2a,
+		0x92, 0x23, 0xf2, 0xaa, 0x71, 0x40, 0x24, 0xc7, 0x5e, 0x0b, 0x24, 0x5a, 0x5f, 0x29,
+		0xf9, 0xd7, 0x23, 0xf9, 0xb5, 0x7a, 0xbb, 0x75, 0xd7, 0x94, 0x90, 0x16, 0xd6, 0xb5,
+		0x57, 0x6c, 0x40, 0x27, 0x15, 0xdc, 0xeb, 0xfb, 0x07, 0x1f, 0x38, 0xb3, 0xa0, 0x16,
+		0x87, 0x0b, 0x69, 0x5c, 0x2e, 0xb5, 0xdf, 0xa3, 0x4c, 0x7c, 0xc2, 0xaa, 0x9c, 0x0e,
+		0xa7, 0x5d, 0x58, 0x51, 0x89, 0xae, 0x61, 0x73, 0xac, 0x3e, 0x46, 0x9a, 0x6f, 0x32,
+		0x19, 0x9e, 0xde, 0x39, 0xc5, 0x24, 0xac, 0x14, 0x0f, 0x5c, 0x35, 0x70, 0x07, 0x97,
+		0xcc, 0x11, 0x8c, 0x26, 0xba, 0xbd, 0x16, 0x7a, 0x96, 0x57, 0x8c, 0x88, 0x17, 0xbf,
+		0x74, 0x74, 0xca, 0x60, 0x14, 0x5a, 0x46, 0x2c, 0x45, 0xba, 0x98, 0x35, 0x68, 0x76,
+		0xc6, 0xc3, 0xdb, 0xee, 0x05, 0x07, 0x46, 0xd6, 0x8e, 0xcd, 0x1d, 0xfd, 0xfe, 0x8e,
+		0xc8, 0xc5, 0xac, 0xe1, 0x8d, 0xf9, 0x00, 0xc9, 0xd6, 0x03, 0xff, 0x7b, 0x22, 0xd0,
+		0x7e, 0xe8, 0x66, 0x20, 0xb1, 0xa0, 0x7b, 0xc6, 0x0c, 0x4d, 0x96, 0x76, 0x0a, 0x91,
+		0xb9, 0x7b, 0x83, 0xb4, 0xdb, 0xd5};
+
+uint8_t key_3072_p1[] = {
+		0xfc, 0x84, 0xe2, 0xbc, 0xca, 0x6f, 0x0c, 0x35, 0x8a, 0x33, 0x8e, 0x8f, 0x44, 0x89,
+		0x44, 0x7b, 0x69, 0x92, 0xf3, 0x9c, 0xf3, 0xc8, 0xa2, 0x2d, 0x1e, 0xcc, 0x3c, 0x24,
+		0x05, 0xcf, 0x14, 0xb0, 0x57, 0x38, 0x99, 0xba, 0xfd, 0x3a, 0x84, 0x70, 0xee, 0x9d,
+		0x14, 0x86, 0x8b, 0x7e, 0x7c, 0xd6, 0xe1, 0x9e, 0x46, 0x8f, 0x84, 0x3d, 0x1c, 0xd5,
+		0x09, 0x78, 0x2d, 0xd4, 0x55, 0x9b, 0xbb, 0xcc, 0x42, 0x6a, 0xff, 0x46, 0x9e, 0xf0,
+		0x5e, 0xe9, 0xad, 0xfb, 0xa0, 0xab, 0xbd, 0x21, 0x1b, 0x6d, 0xd0, 0xd0, 0x8e, 0xcf,
+		0x7a, 0x4d, 0x82, 0x08, 0x71, 0xcb, 0x07, 0xf2, 0x90, 0x9b, 0xbd, 0x71, 0x74, 0xc8,
+		0xec, 0xe6, 0x9f, 0x37, 0xac, 0xac, 0xa0, 0x24, 0x25, 0x12, 0xee, 0x3d, 0xc4, 0xf9,
+		0x86, 0xbb, 0x4a, 0x76, 0x05, 0x32, 0xf7, 0xaa, 0x62, 0x07, 0x31, 0xd7, 0x0a, 0x18,
+		0xf5, 0xe9, 0x6a, 0xd6, 0x8d, 0x99, 0xdc, 0xed, 0x0e, 0xb9, 0xc7, 0x7c, 0xb2, 0xad,
+		0xc6, 0x45, 0xca, 0xf7, 0xbe, 0x0b, 0x84, 0xb3, 0x87, 0x6b, 0x78, 0x51, 0x62, 0x3a,
+		0x55, 0x9e, 0x30, 0xe7, 0x87, 0x14, 0xb0, 0x15, 0xd3, 0x1f, 0xc1, 0x96, 0x3a, 0x0f,
+		0x60, 0x19, 0xc7, 0x2d, 0x28, 0x90, 0xea, 0xf0, 0x1b, 0x24, 0x7c, 0xdb, 0xe5, 0x16,
+		0x90, 0x2d, 0x04, 0xf6, 0x75, 0xc0, 0x70, 0x2a, 0xc4, 0xc5};
+
+uint8_t key_3072_p2[] = {
+		0xb9, 0x79, 0x5b, 0x59, 0x5e, 0x14, 0x16, 0xc4, 0xa3, 0x9a, 0x63, 0xe4, 0x00, 0x41,
+		0x54, 0x7d, 0x96, 0xaf, 0xf7, 0x6b, 0xdb, 0x58, 0x0e, 0x1f, 0x32, 0x8f, 0x18, 0xba,
+		0x19, 0xcc, 0x20, 0x04, 0xa7, 0x7a, 0xd2, 0x06, 0x6c, 0xe3, 0x89, 0x11, 0x96, 0x55,
+		0x28, 0x6a, 0x1e, 0xc6, 0x8f, 0x1e, 0x7c, 0x16, 0x39, 0xcd, 0xa4, 0xde, 0x40, 0xfd,
+		0xd6, 0x9e, 0xea, 0x1f, 0x17, 0x08, 0x00, 0xa2, 0x45, 0xf1, 0x12, 0x48, 0x58, 0x02,
+		0x65, 0x8c, 0xe0, 0xd8, 0x90, 0x5d, 0x85, 0xe6, 0x88, 0x09, 0x59, 0xa1, 0xe1, 0x21,
+		0xc9, 0xba, 0xcb, 0xf0, 0x1c, 0xee, 0xaa, 0x91, 0x61, 0x17, 0xf8, 0xb1, 0x17, 0xcc,
+		0x8a, 0x4a, 0xc7, 0x07, 0x20, 0x70, 0xa3, 0xa7, 0x2e, 0xbc, 0xfc, 0x6b, 0x5a, 0xd1,
+		0x4f, 0x64, 0x22, 0xfc, 0x06, 0x05, 0xd0, 0x64, 0x6c, 0x7e, 0xeb, 0xf5, 0x66, 0x7e,
+		0x46, 0x3c, 0xcf, 0x38, 0x29, 0xa8, 0x72, 0xa9, 0x91, 0xe6, 0x78, 0x83, 0xc3, 0x98,
+		0x30, 0xb4, 0xc0, 0x60, 0x9b, 0x76, 0x4d, 0x2f, 0xb8, 0x13, 0x0c, 0x1d, 0x8f, 0xe4,
+		0xd1, 0x64, 0x73, 0x1c, 0xdf, 0xe8, 0xdf, 0x37, 0x67, 0x53, 0xf8, 0x59, 0x46, 0x53,
+		0x9b, 0xf8, 0xba, 0x73, 0xb8, 0x47, 0xf7, 0xd2, 0xb7, 0x3e, 0x5e, 0x8e, 0xe5, 0x18,
+		0x71, 0x84, 0xfa, 0xe6, 0x0f, 0x5d, 0x27, 0x1c, 0x05, 0x43};
+
+uint8_t key_3072_e1[] = {
+		0x21, 0x92, 0x65, 0x36, 0xa6, 0x4f, 0x37, 0x37, 0x53, 0x05, 0x61, 0xb9, 0xa8, 0x69,
+		0xfb, 0x81, 0xd0, 0xda, 0x69, 0xaa, 0xff, 0x3a, 0x38, 0x5d, 0x79, 0x4f, 0xbb, 0xdb,
+		0x2a, 0x2e, 0x8a, 0xd8, 0x9a, 0xef, 0xfa, 0x78, 0x42, 0xbc, 0x69, 0xe9, 0x3d, 0xc0,
+		0x02, 0x7f, 0x94, 0xc2, 0x1f, 0x44, 0xce, 0x40, 0x25, 0xaf, 0x64, 0xec, 0x5f, 0x0d,
+		0xef, 0xb1, 0x5b, 0x9e, 0x74, 0x37, 0x3d, 0x33, 0x7d, 0xcd, 0x0d, 0xdd, 0x4c, 0xba,
+		0x36, 0x54, 0x28, 0xfe, 0x60, 0x31, 0x14, 0xf6, 0xf6, 0xd7, 0x95, 0xc0, 0x74, 0x8c,
+		0x1e, 0xfd, 0x79, 0x01, 0x38, 0x67, 0xbe, 0xc9, 0xbf, 0xf2, 0x04, 0xb0, 0xb5, 0xcf,
+		0x14, 0xb7, 0xe0, 0x89, 0x1d, 0x5a, 0xe1, 0xfb, 0x8c, 0x36, 0x45, 0x18, 0x4f, 0x3c,
+		0xc1, 0x6d, 0xdb, 0x0b, 0x6f, 0xcb, 0x83, 0xe3, 0xd2, 0x1e, 0x94, 0xc0, 0xbb, 0x25,
+		0xf0, 0x63, 0xb5, 0x01, 0x8b, 0x57, 0xde, 0x68, 0x61, 0xe1, 0xcf, 0x24, 0xc3, 0xf8,
+		0x98, 0x78, 0xa4, 0xf0, 0x65, 0x02, 0xd1, 0x04, 0xb1, 0x47, 0x57, 0x7a, 0xb2, 0x6d,
+		0x80, 0xfe, 0x84, 0x0f, 0xf4, 0x04, 0x8b, 0x18, 0x8b, 0xb6, 0x18, 0x1d, 0xa9, 0xe0,
+		0x6b, 0x6d, 0x61, 0xee, 0x9e, 0x0b, 0x0e, 0x41, 0x17, 0xca, 0xb5, 0x12, 0xe3, 0x15,
+		0x29, 0xdb, 0xe2, 0x62, 0x05, 0xeb, 0xac, 0xbd, 0xf2, 0xe5};
+
+uint8_t key_3072_e2[] = {
+		0x91, 0xee, 0xaf, 0x76, 0x60, 0x74, 0x73, 0xf9, 0xa2, 0x34, 0x3e, 0xf6, 0x4d, 0x51,
+		0x19, 0xd6, 0x7a, 0xf2, 0xd7, 0x3d, 0x30, 0xe7, 0x56, 0xad, 0x2b, 0x4d, 0xb6, 0x09,
+		0xef, 0x74, 0x51, 0x98, 0xf7, 0xe1, 0xc6, 0x50, 0xb1, 0xea, 0x51, 0x95, 0xd9, 0xf0,
+		0x05, 0x0d, 0x82, 0x4b, 0x7e, 0x9e, 0x60, 0xc9, 0xe8, 0x0f, 0x2a, 0xf2, 0x88, 0xb6,
+		0x70, 0xe0, 0xb6, 0x9b, 0x61, 0xb6, 0xb5, 0x30, 0xf8, 0xd1, 0x16, 0x2e, 0x7f, 0xb8,
+		0xdb, 0x07, 0xfe, 0x7d, 0xc7, 0x11, 0x1e, 0xe2, 0xe5, 0x14, 0x5e, 0x46, 0xe5, 0x69,
+		0x7d, 0x5d, 0x11, 0x4b, 0x4a, 0xa8, 0x6a, 0xe2, 0x5a, 0x3f, 0xcf, 0x38, 0x1f, 0xde,
+		0x9a, 0xcc, 0xfd, 0x4e, 0x59, 0x32, 0xe7, 0x41, 0x0a, 0xa0, 0x3e, 0x07, 0x85, 0xfc,
+		0x7c, 0x77, 0xf0, 0xa2, 0xd5, 0x66, 0x4b, 0xb2, 0x48, 0x3f, 0x91, 0x0e, 0x93, 0xe7,
+		0x35, 0x02, 0x71, 0x94, 0xe2, 0x0a, 0x1c, 0xb5, 0xd9, 0x0b, 0x3a, 0xb5, 0x89, 0xf7,
+		0x3c, 0x13, 0x6b, 0xee, 0x57, 0x43, 0xbc, 0xb5, 0x98, 0x22, 0xbc, 0x7c, 0xa2, 0x14,
+		0x4a, 0xc0, 0xbb, 0x65, 0xf3, 0xb3, 0x39, 0xb6, 0x51, 0x01, 0x9b, 0xbd, 0x3a, 0x7d,
+		0x5c, 0x92, 0x56, 0xb9, 0xe8, 0x3c, 0x0f, 0xfc, 0xe6, 0x9b, 0x17, 0x31, 0x5d, 0x86,
+		0x5f, 0x03, 0x5f, 0x9a, 0x16, 0x6a, 0x97, 0xf4, 0x0f, 0x1b};
+
+uint8_t key_3072_c[] = {
+		0x5a, 0x6c, 0xb8, 0x26, 0x02, 0x2d, 0xc3, 0x63, 0x10, 0xc3, 0x1b, 0xdd, 0xd5, 0x6c,
+		0x0c, 0x5e, 0x44, 0xa3, 0x42, 0x6d, 0xb4, 0x9d, 0xd9, 0x6d, 0x9b, 0x64, 0x9d, 0x80,
+		0x94, 0x12, 0x5b, 0xd3, 0x35, 0x9e, 0x4d, 0x9c, 0xeb, 0xbe, 0xf6, 0x98, 0xc9, 0x25,
+		0xd6, 0xd9, 0x6d, 0x74, 0x23, 0xff, 0x5a, 0x68, 0xa9, 0x6e, 0xd3, 0x5b, 0xfa, 0xde,
+		0x72, 0x8f, 0x1f, 0x03, 0x92, 0xa6, 0x7c, 0x73, 0x47, 0xd7, 0x4d, 0xd8, 0x7f, 0xfb,
+		0xcd, 0xe7, 0xff, 0x5e, 0xc0, 0x90, 0xf6, 0x51, 0xcd, 0x4e, 0xdc, 0xe2, 0xdd, 0xb2,
+		0x86, 0x66, 0xc4, 0xdf, 0x26, 0x0d, 0x72, 0x6d, 0x51, 0x25, 0xca, 0xa7, 0x27, 0xeb,
+		0x1f, 0x36, 0x7e, 0x42, 0x13, 0x65, 0x61, 0xcb, 0xe1, 0xd7, 0xba, 0xf5, 0x9e, 0x87,
+		0xe0, 0x3e, 0xf0, 0xfb, 0x12, 0x43, 0xde, 0x9e, 0xc4, 0x03, 0xa9, 0xc2, 0xa4, 0x98,
+		0xb1, 0xb7, 0xe1, 0xea, 0x5d, 0x93, 0xbc, 0x6f, 0xdc, 0x49, 0x7d, 0xc6, 0xa3, 0x02,
+		0x3e, 0xa4, 0x7f, 0x4e, 0x9b, 0xd5, 0x3e, 0x92, 0xd5, 0xc6, 0x80, 0x72, 0x89, 0x8c,
+		0x43, 0x50, 0x65, 0xb5, 0x61, 0x08, 0x72, 0xf9, 0x49, 0x9e, 0x58, 0x6f, 0x3a, 0xb5,
+		0x9d, 0x55, 0x4e, 0x8d, 0xef, 0x7d, 0x1e, 0x64, 0x07, 0x2a, 0x2d, 0x0e, 0x40, 0xf3,
+		0x1e, 0x2d, 0x7e, 0xa9, 0x74, 0x0b, 0x43, 0xc7, 0x7e, 0xbc};
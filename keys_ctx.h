@@ -0,0 +1,14 @@
+/*****************************************************************************
+Filename    : keys_ctx.h
+Date        : 2026-10-19
+Description : Prepared contexts of the keys in keys.h, generated at build
+              time into keys_ctx.c
+*****************************************************************************/
+#ifndef __KEYS_CTX_H__
+#define __KEYS_CTX_H__
+
+#include "rsa.h"
+
+extern rsa_key_ctx_t key_ctx;               // key_m / key_pe, KEY_M_BITS, key_id 0
+
+#endif  // __KEYS_CTX_H__
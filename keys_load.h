@@ -0,0 +1,37 @@
+/*****************************************************************************
+Filename    : keys_load.h
+Date        : 2026-10-19
+Description : Loading the test keys of keys.h into rsa_pk_t / rsa_sk_t
+*****************************************************************************/
+#ifndef __KEYS_LOAD_H__
+#define __KEYS_LOAD_H__
+
+#include <string.h>
+
+#include "rsa.h"
+
+// Key k of keys.h is the set of arrays k##_m, k##_pe, k##_p1 ... (k = key,
+// key_2048, key_mp3, ...), all sharing key_e. Every field is big-endian and
+// right-aligned in its buffer; the rest of pk/sk is left untouched, so clear
+// them first. Multi-prime keys add their other_prime_info on top.
+#define KEY_LOAD_PK(pk, k, nbits)                                                                     \
+    do {                                                                                              \
+        (pk).bits = (nbits);                                                                          \
+        memcpy(&(pk).modulus         [RSA_MAX_MODULUS_LEN-sizeof(k##_m)],  k##_m,  sizeof(k##_m));    \
+        memcpy(&(pk).exponent        [RSA_MAX_MODULUS_LEN-sizeof(key_e)],  key_e,  sizeof(key_e));    \
+    } while(0)
+
+#define KEY_LOAD_SK(sk, k, nbits)                                                                     \
+    do {                                                                                              \
+        (sk).bits = (nbits);                                                                          \
+        memcpy(&(sk).modulus         [RSA_MAX_MODULUS_LEN-sizeof(k##_m)],  k##_m,  sizeof(k##_m));    \
+        memcpy(&(sk).public_exponet  [RSA_MAX_MODULUS_LEN-sizeof(key_e)],  key_e,  sizeof(key_e));    \
+        memcpy(&(sk).exponent        [RSA_MAX_MODULUS_LEN-sizeof(k##_pe)], k##_pe, sizeof(k##_pe));   \
+        memcpy(&(sk).prime1          [RSA_MAX_PRIME_LEN-sizeof(k##_p1)],   k##_p1, sizeof(k##_p1));   \
+        memcpy(&(sk).prime2          [RSA_MAX_PRIME_LEN-sizeof(k##_p2)],   k##_p2, sizeof(k##_p2));   \
+        memcpy(&(sk).prime_exponent1 [RSA_MAX_PRIME_LEN-sizeof(k##_e1)],   k##_e1, sizeof(k##_e1));   \
+        memcpy(&(sk).prime_exponent2 [RSA_MAX_PRIME_LEN-sizeof(k##_e2)],   k##_e2, sizeof(k##_e2));   \
+        memcpy(&(sk).coefficient     [RSA_MAX_PRIME_LEN-sizeof(k##_c)],    k##_c,  sizeof(k##_c));    \
+    } while(0)
+
+#endif  // __KEYS_LOAD_H__
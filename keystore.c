@@ -0,0 +1,278 @@
+/*****************************************************************************
+Filename    : keystore.c
+Date        : 2026-10-19
+Description : Memory-mappable store of prepared key contexts. Opening a
+              store maps it read-only; keys are used in place, with no
+              parsing or Montgomery precomputation at startup.
+*****************************************************************************/
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "keystore.h"
+
+static int cmp_ctx_id(const void *a, const void *b)
+{
+    uint32_t x = (*(rsa_key_ctx_t * const *)a)->key_id;
+    uint32_t y = (*(rsa_key_ctx_t * const *)b)->key_id;
+    return (x > y) - (x < y);
+}
+
+// The cheap part of rsa_key_ctx_check(): the record is in this build's layout
+static int ctx_hdr_ok(const rsa_key_ctx_t *ctx)
+{
+    return ctx->magic == RSA_KEY_CTX_MAGIC && ctx->version == RSA_KEY_CTX_VERSION && ctx->size == sizeof(*ctx);
+}
+
+static void fill_hdr(rsa_keystore_hdr_t *hdr, uint32_t count)
+{
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->magic = RSA_KEYSTORE_MAGIC;
+    hdr->version = RSA_KEYSTORE_VERSION;
+    hdr->ctx_size = sizeof(rsa_key_ctx_t);
+    hdr->count = count;
+    hdr->offset = RSA_KEYSTORE_ALIGN;
+}
+
+static int write_full(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    ssize_t r;
+
+    while(len) {
+        if((r = write(fd, p, len)) < 0)
+            return -1;
+        p += r;
+        len -= (size_t)r;
+    }
+    return 0;
+}
+
+int rsa_keystore_write(const char *path, rsa_key_ctx_t *ctx, uint32_t count)
+{
+    rsa_keystore_hdr_t hdr;
+    rsa_key_ctx_t **order;
+    uint8_t pad[RSA_KEYSTORE_ALIGN] = {0};
+    char tmp[4096];
+    uint32_t i;
+    int fd, status = 0;
+
+    if((order = malloc((count ? count : 1) * sizeof(*order))) == NULL)
+        return ERR_IO;
+    for(i=0; i<count; i++) {
+        if(!ctx_hdr_ok(&ctx[i])) {
+            free(order);
+            return ERR_WRONG_DATA;
+        }
+        order[i] = &ctx[i];
+    }
+    qsort(order, count, sizeof(*order), cmp_ctx_id);
+    for(i=1; i<count; i++) {
+        if(order[i]->key_id == order[i-1]->key_id) {
+            free(order);
+            return ERR_WRONG_DATA;
+        }
+    }
+
+    fill_hdr(&hdr, count);
+
+    // Write a temporary file and rename it, so readers never map a partial store
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    if((fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600)) < 0) {
+        free(order);
+        return ERR_IO;
+    }
+
+    if(write_full(fd, &hdr, sizeof(hdr)) != 0 || write_full(fd, pad, hdr.offset - sizeof(hdr)) != 0)
+        status = ERR_IO;
+    for(i=0; i<count && status == 0; i++) {
+        if(write_full(fd, order[i], sizeof(rsa_key_ctx_t)) != 0)
+            status = ERR_IO;
+    }
+    if(status == 0 && fsync(fd) != 0)
+        status = ERR_IO;
+    close(fd);
+
+    if(status == 0 && rename(tmp, path) != 0)
+        status = ERR_IO;
+    if(status != 0)
+        unlink(tmp);
+
+    free(order);
+    return status;
+}
+
+typedef struct {
+    uint32_t key_id, index;
+} shm_order_t;
+
+static int cmp_order_id(const void *a, const void *b)
+{
+    uint32_t x = ((const shm_order_t *)a)->key_id;
+    uint32_t y = ((const shm_order_t *)b)->key_id;
+    return (x > y) - (x < y);
+}
+
+// An anonymous segment: a sealable memfd, or an unlinked POSIX shm object
+// where memfd_create() is missing
+static int shm_segment(void)
+{
+#ifdef MFD_ALLOW_SEALING
+    return memfd_create("rsa_keystore", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#else
+    char name[64];
+    int fd;
+
+    snprintf(name, sizeof(name), "/rsa_keystore.%ld", (long)getpid());
+    if((fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600)) >= 0)
+        shm_unlink(name);
+    return fd;
+#endif
+}
+
+int rsa_keystore_shm_create(int *fd, rsa_sk_t *sk, const uint32_t *key_id, uint32_t count)
+{
+    shm_order_t *order;
+    rsa_key_ctx_t *keys;
+    size_t len;
+    uint32_t i;
+    void *map;
+    int status = 0;
+
+    *fd = -1;
+    if((order = malloc((count ? count : 1) * sizeof(*order))) == NULL)
+        return ERR_IO;
+    for(i=0; i<count; i++) {
+        order[i].key_id = key_id[i];
+        order[i].index = i;
+    }
+    qsort(order, count, sizeof(*order), cmp_order_id);
+    for(i=1; i<count; i++) {
+        if(order[i].key_id == order[i-1].key_id) {
+            free(order);
+            return ERR_WRONG_DATA;
+        }
+    }
+
+    len = RSA_KEYSTORE_ALIGN + (size_t)count * sizeof(rsa_key_ctx_t);
+    if((*fd = shm_segment()) < 0 || ftruncate(*fd, (off_t)len) != 0 ||
+       (map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, *fd, 0)) == MAP_FAILED) {
+        if(*fd >= 0)
+            close(*fd);
+        *fd = -1;
+        free(order);
+        return ERR_IO;
+    }
+
+    // Contexts are prepared in place; nothing is copied into the segment
+    fill_hdr(map, count);
+    keys = (rsa_key_ctx_t *)((uint8_t *)map + RSA_KEYSTORE_ALIGN);
+    for(i=0; i<count && status == 0; i++)
+        status = rsa_key_ctx_init(&keys[i], &sk[order[i].index], order[i].key_id);
+    munmap(map, len);
+
+#ifdef MFD_ALLOW_SEALING
+    // Without writable mappings left, the segment can be frozen for good
+    if(status == 0 && fcntl(*fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0)
+        status = ERR_IO;
+#endif
+    if(status != 0) {
+        close(*fd);
+        *fd = -1;
+    }
+
+    free(order);
+    return status;
+}
+
+int rsa_keystore_open(rsa_keystore_t *ks, const char *path)
+{
+    int fd, status;
+
+    memset(ks, 0, sizeof(*ks));
+    if((fd = open(path, O_RDONLY)) < 0)
+        return ERR_IO;
+    status = rsa_keystore_open_fd(ks, fd);
+    close(fd);
+
+    return status;
+}
+
+int rsa_keystore_open_fd(rsa_keystore_t *ks, int fd)
+{
+    rsa_keystore_hdr_t *hdr;
+    struct stat st;
+    uint32_t i;
+    void *map;
+
+    memset(ks, 0, sizeof(*ks));
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(rsa_keystore_hdr_t))
+        return ERR_IO;
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED)
+        return ERR_IO;
+
+    ks->map = map;
+    ks->map_len = (size_t)st.st_size;
+
+    hdr = map;
+    if(hdr->magic != RSA_KEYSTORE_MAGIC || hdr->version != RSA_KEYSTORE_VERSION ||
+       hdr->ctx_size != sizeof(rsa_key_ctx_t) || hdr->offset % RSA_KEYSTORE_ALIGN != 0 ||
+       hdr->offset + (uint64_t)hdr->count * sizeof(rsa_key_ctx_t) > ks->map_len) {
+        rsa_keystore_close(ks);
+        return ERR_WRONG_DATA;
+    }
+
+    ks->count = hdr->count;
+    ks->keys = (rsa_key_ctx_t *)((uint8_t *)map + hdr->offset);
+    if((ks->checked = calloc(ks->count ? ks->count : 1, 1)) == NULL) {
+        rsa_keystore_close(ks);
+        return ERR_IO;
+    }
+    for(i=0; i<ks->count; i++) {
+        if(!ctx_hdr_ok(&ks->keys[i]) || (i && ks->keys[i].key_id <= ks->keys[i-1].key_id)) {
+            rsa_keystore_close(ks);
+            return ERR_WRONG_DATA;
+        }
+    }
+
+    return 0;
+}
+
+rsa_key_ctx_t *rsa_keystore_find(rsa_keystore_t *ks, uint32_t key_id)
+{
+    uint32_t lo = 0, hi = ks->count, mid;
+    uint8_t state;
+
+    while(lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if(ks->keys[mid].key_id == key_id) {
+            // Threads that race on an unchecked record both check it and agree
+            if((state = __atomic_load_n(&ks->checked[mid], __ATOMIC_ACQUIRE)) == 0) {
+                state = rsa_key_ctx_check(&ks->keys[mid]) == 0 ? 1 : 2;
+                __atomic_store_n(&ks->checked[mid], state, __ATOMIC_RELEASE);
+            }
+            return state == 1 ? &ks->keys[mid] : NULL;
+        }
+        if(ks->keys[mid].key_id < key_id)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return NULL;
+}
+
+void rsa_keystore_close(rsa_keystore_t *ks)
+{
+    if(ks->map)
+        munmap(ks->map, ks->map_len);
+    free(ks->checked);
+    memset(ks, 0, sizeof(*ks));
+}
@@ -0,0 +1,60 @@
+/*****************************************************************************
+Filename    : keystore.h
+Date        : 2026-10-19
+Description : Memory-mappable store of prepared key contexts
+*****************************************************************************/
+#ifndef __KEYSTORE_H__
+#define __KEYSTORE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rsa.h"
+
+// File layout: one 64 byte header, then count rsa_key_ctx_t records sorted by
+// key_id, starting at a page-aligned offset. Records are stored exactly as
+// in memory (native limb order), so a mapped record is used in place.
+#define RSA_KEYSTORE_MAGIC                  0x52534B53      // "RSKS"
+#define RSA_KEYSTORE_VERSION                1
+#define RSA_KEYSTORE_ALIGN                  4096
+
+typedef struct {
+    uint32_t magic, version;
+    uint32_t ctx_size;                          // sizeof(rsa_key_ctx_t) of the writer
+    uint32_t count;
+    uint64_t offset;                            // file offset of the first record
+    uint8_t  reserved[40];
+} rsa_keystore_hdr_t;
+
+typedef struct {
+    void          *map;
+    size_t        map_len;
+    uint32_t      count;
+    rsa_key_ctx_t *keys;                        // count records, sorted by key_id
+    uint8_t       *checked;                     // per record: 0 not yet, 1 valid, 2 invalid
+} rsa_keystore_t;
+
+/*
+ * Opening checks the header and each record's magic, version, size and
+ * key_id order only, so startup does not grow with the number of keys.
+ * The full rsa_key_ctx_check() of a record runs on its first
+ * rsa_keystore_find(), which returns NULL for a record that fails it.
+ */
+int rsa_keystore_write(const char *path, rsa_key_ctx_t *ctx, uint32_t count);
+int rsa_keystore_open(rsa_keystore_t *ks, const char *path);
+
+/*
+ * The same layout in an anonymous shared memory segment, for pre-fork
+ * servers: the parent prepares count keys (sk[i] under key_id[i]) directly
+ * in a memfd and seals it against any further change. Workers forked
+ * afterwards, or handed the descriptor over a unix socket, map it read-only
+ * with rsa_keystore_open_fd(). Every process then shares the same physical
+ * pages, so memory per key does not grow with the worker count. fd is
+ * close-on-exec; clear that to pass it to exec'd workers.
+ */
+int rsa_keystore_shm_create(int *fd, rsa_sk_t *sk, const uint32_t *key_id, uint32_t count);
+int rsa_keystore_open_fd(rsa_keystore_t *ks, int fd);     // fd stays open, the mapping does not need it
+rsa_key_ctx_t *rsa_keystore_find(rsa_keystore_t *ks, uint32_t key_id);
+void rsa_keystore_close(rsa_keystore_t *ks);
+
+#endif  // __KEYSTORE_H__
@@ -16,9 +16,24 @@ Description : Rsa4096
 #include <string.h>
 #include <time.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include "rsa.h"
 #include "keys.h"
+#include "keys_load.h"
+#include "keys_ctx.h"
 #include "bignum.h"
+#include "bn_engine.h"
+#include "keystore.h"
+#include "keycache.h"
+#include "rsa_pool.h"
+#include "rsa_container.h"
+#include "rsa_hybrid.h"
+#include "sha256.h"
+#include "rsa_metrics.h"
+#include "rsa_der.h"
 void print_array(char *TAG, uint8_t *array, int len)
 {
 	int i;
@@ -44,6 +59,8 @@ void print_array32(char* TAG, uint32_t* array, int len)
 
 const int count=1;
 #define num_test 20
+// One block of the built-in 4096-bit keys, below RSA_MAX_MODULUS_LEN
+#define KEY_M_LEN ((KEY_M_BITS + 7) / 8)
 int private_enc_dec_test()
 {
 	uint8_t input[512*num_test]={0};
@@ -56,23 +73,8 @@ int private_enc_dec_test()
     int32_t inputLen = 0;
 	printf("RSA encryption decryption test is beginning!\n");
 	printf("\n");
-	pk.bits = KEY_M_BITS;
-	//pk.ninv = key_n_inv;
-	memcpy(&pk.modulus         [RSA_MAX_MODULUS_LEN-sizeof(key_m)],  key_m,  sizeof(key_m));
-	memcpy(&pk.exponent        [RSA_MAX_MODULUS_LEN-sizeof(key_e)],  key_e,  sizeof(key_e));
-	//memcpy(&pk.n_rr            [RSA_MAX_MODULUS_LEN - sizeof(key_n_rr)], key_n_rr, sizeof(key_n_rr));
-	sk.bits = KEY_M_BITS;
-	memcpy(&sk.modulus         [RSA_MAX_MODULUS_LEN-sizeof(key_m)],  key_m,  sizeof(key_m));
-	memcpy(&sk.public_exponet  [RSA_MAX_MODULUS_LEN-sizeof(key_e)],  key_e,  sizeof(key_e));
-	memcpy(&sk.exponent        [RSA_MAX_MODULUS_LEN-sizeof(key_pe)], key_pe, sizeof(key_pe));
-	memcpy(&sk.prime1          [RSA_MAX_PRIME_LEN-sizeof(key_p1)],   key_p1, sizeof(key_p1));
-	memcpy(&sk.prime2          [RSA_MAX_PRIME_LEN-sizeof(key_p2)],   key_p2, sizeof(key_p2));
-	memcpy(&sk.prime_exponent1 [RSA_MAX_PRIME_LEN-sizeof(key_e1)],   key_e1, sizeof(key_e1));
-	memcpy(&sk.prime_exponent2 [RSA_MAX_PRIME_LEN-sizeof(key_e2)],   key_e2, sizeof(key_e2));
-	memcpy(&sk.coefficient     [RSA_MAX_PRIME_LEN-sizeof(key_c)],    key_c,  sizeof(key_c));
-	sk.qinv = key_q_inv;
-	sk.p_inv = key_p_inv;
-	memcpy(&sk.q_rr            [(RSA_MAX_PRIME_LEN - sizeof(key_q_rr))], key_q_rr, sizeof(key_q_rr));
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+	KEY_LOAD_SK(sk, key, KEY_M_BITS);
 
 
 
@@ -122,6 +124,998 @@ int private_enc_dec_test()
 	}
 	return 0;
 }
+static void load_prime_info(rsa_prime_info_t *info, uint8_t *r, uint32_t r_len, uint8_t *d, uint32_t d_len, uint8_t *t, uint32_t t_len)
+{
+	memcpy(&info->prime       [RSA_MAX_PRIME_LEN-r_len], r, r_len);
+	memcpy(&info->exponent    [RSA_MAX_PRIME_LEN-d_len], d, d_len);
+	memcpy(&info->coefficient [RSA_MAX_PRIME_LEN-t_len], t, t_len);
+}
+
+// A key imported without CRT coefficients must prepare to the same context
+static int coefficients_derived(rsa_sk_t *sk)
+{
+	static rsa_key_ctx_t full, derived;
+	static rsa_sk_t bare;
+	uint32_t i;
+
+	bare = *sk;
+	memset(bare.coefficient, 0, sizeof(bare.coefficient));
+	for(i=0; i<bare.other_primes; i++)
+		memset(bare.other_prime_info[i].coefficient, 0, sizeof(bare.other_prime_info[i].coefficient));
+	if(rsa_key_ctx_init(&full, sk, 0) != 0 || rsa_key_ctx_init(&derived, &bare, 0) != 0)
+		return 1;
+	return memcmp(&full, &derived, sizeof(full)) != 0;
+}
+// Wall time of 20 private operations with a prepared context
+static double private_ctx_time(rsa_key_ctx_t *ctx)
+{
+	uint8_t input[100], output[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, i;
+	struct timespec start, end;
+
+	generate_rand(input, sizeof(input));
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i=0; i<20; i++)
+		rsa_private_encrypt_ctx(output, &outputLen, input, sizeof(input), ctx);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+static int multi_prime_round_trip(const char *name, rsa_pk_t *pk, rsa_sk_t *sk, double *t)
+{
+	static rsa_key_ctx_t ctx;
+	uint8_t input[(KEY_MP_BITS+7)/8-11], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, msg_len;
+	clock_t start, end;
+	int status;
+
+	generate_rand(input, sizeof(input));
+	status = rsa_public_encrypt(output, &outputLen, input, sizeof(input), pk);
+	if(status == 0) {
+		start = clock();
+		status = rsa_private_decrypt(msg, &msg_len, output, outputLen, sk);
+		end = clock();
+		printf("%u-prime rsa_private_decrypt time(s): %lf\n", sk->other_primes + 2, (double)(end-start)/CLOCKS_PER_SEC);
+	}
+	if(status != 0 || msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0) {
+		printf("%s public encrypt and private decrypt Error\n", name);
+		return 1;
+	}
+	if(coefficients_derived(sk) != 0) {
+		printf("%s derived CRT coefficients Error\n", name);
+		return 1;
+	}
+	if(rsa_key_ctx_init(&ctx, sk, 0) != 0)
+		return 1;
+	*t = private_ctx_time(&ctx);
+	return 0;
+}
+
+int multi_prime_test()
+{
+	rsa_pk_t pk = {0};
+	rsa_sk_t sk = {0};
+	double t2, t3 = 0, t4 = 0;
+	int status;
+
+	printf("Multi-prime RSA test is beginning!\n");
+	KEY_LOAD_PK(pk, key_mp3, KEY_MP_BITS);
+	KEY_LOAD_SK(sk, key_mp3, KEY_MP_BITS);
+	sk.other_primes = 1;
+	load_prime_info(&sk.other_prime_info[0], key_mp3_r3, sizeof(key_mp3_r3), key_mp3_d3, sizeof(key_mp3_d3), key_mp3_t3, sizeof(key_mp3_t3));
+	status = multi_prime_round_trip("3-prime", &pk, &sk, &t3);
+
+	memset(&pk, 0, sizeof(pk));
+	memset(&sk, 0, sizeof(sk));
+	KEY_LOAD_PK(pk, key_mp4, KEY_MP_BITS);
+	KEY_LOAD_SK(sk, key_mp4, KEY_MP_BITS);
+	sk.other_primes = 2;
+	load_prime_info(&sk.other_prime_info[0], key_mp4_r3, sizeof(key_mp4_r3), key_mp4_d3, sizeof(key_mp4_d3), key_mp4_t3, sizeof(key_mp4_t3));
+	load_prime_info(&sk.other_prime_info[1], key_mp4_r4, sizeof(key_mp4_r4), key_mp4_d4, sizeof(key_mp4_d4), key_mp4_t4, sizeof(key_mp4_t4));
+	status |= multi_prime_round_trip("4-prime", &pk, &sk, &t4);
+
+	// More, shorter primes are the point: a 3-prime key must not be slower
+	t2 = private_ctx_time(&key_ctx);
+	printf("20 rsa_private_encrypt_ctx time(s): 2-prime %f; 3-prime %f; 4-prime %f\n", t2, t3, t4);
+	if(status == 0 && t3 > t2) {
+		printf("3-prime private operation slower than 2-prime\n");
+		status = 1;
+	}
+
+	if(status == 0)
+		printf("Multi-prime public encrypt and private decrypt success!\n");
+	return status;
+}
+// 2048-, 3072- and 4096-bit keys served interleaved by one process
+int mixed_size_test()
+{
+	static rsa_pk_t pk[3];
+	static rsa_sk_t sk[3];
+	static uint8_t input[1000], cipher[2 * sizeof(input)], msg[sizeof(input)];
+	double t_pub[3] = {0}, t_priv[3] = {0};
+	uint32_t cipher_len, msg_len, len, k, i;
+	clock_t start;
+	int status = 0;
+
+	printf("Mixed key size test is beginning!\n");
+	KEY_LOAD_PK(pk[0], key_2048, KEY_2048_BITS);
+	KEY_LOAD_SK(sk[0], key_2048, KEY_2048_BITS);
+	KEY_LOAD_PK(pk[1], key_3072, KEY_3072_BITS);
+	KEY_LOAD_SK(sk[1], key_3072, KEY_3072_BITS);
+	KEY_LOAD_PK(pk[2], key, KEY_M_BITS);
+	KEY_LOAD_SK(sk[2], key, KEY_M_BITS);
+
+	for(i=0; i<num_test && status==0; i++) {
+		for(k=0; k<3 && status==0; k++) {
+			len = (sk[k].bits + 7) / 8 - 11;
+			generate_rand(input, len);
+			start = clock();
+			status = rsa_public_encrypt(cipher, &cipher_len, input, len, &pk[k]);
+			t_pub[k] += (double)(clock() - start) / CLOCKS_PER_SEC;
+			if(status == 0) {
+				start = clock();
+				status = rsa_private_decrypt(msg, &msg_len, cipher, cipher_len, &sk[k]);
+				t_priv[k] += (double)(clock() - start) / CLOCKS_PER_SEC;
+			}
+			if(status != 0 || cipher_len != (sk[k].bits + 7) / 8 || msg_len != len || memcmp(input, msg, len) != 0) {
+				printf("%u-bit public encrypt and private decrypt Error\n", sk[k].bits);
+				status = 1;
+			}
+		}
+	}
+
+	// Messages longer than one block are cut at each key's own block length
+	for(k=0; k<3 && status==0; k++) {
+		generate_rand(input, sizeof(input));
+		status = rsa_public_encrypt_any_len(cipher, &cipher_len, input, sizeof(input), &pk[k]);
+		if(status == 0)
+			status = rsa_private_decrypt_any_len(msg, &msg_len, cipher, cipher_len, &sk[k]);
+		if(status != 0 || msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0) {
+			printf("%u-bit any_len round trip Error\n", sk[k].bits);
+			status = 1;
+		}
+	}
+
+	for(k=0; k<3 && status==0; k++)
+		printf("%u-bit public encrypt time(s): %f; private decrypt time(s): %f\n", sk[k].bits, t_pub[k] / num_test, t_priv[k] / num_test);
+	if(status == 0)
+		printf("Mixed key size round trips success!\n");
+	return status;
+}
+int inversion_test()
+{
+	static rsa_pk_t pk[3];
+	static rsa_sk_t sk[3];
+	static bn_t b[64 * 128], a1[64 * 128], a2[64 * 128];
+	bn_t n[BN_MAX_DIGITS], e[BN_MAX_DIGITS], phi[2 * BN_MAX_DIGITS], p[BN_MAX_DIGITS], q[BN_MAX_DIGITS];
+	bn_t d[BN_MAX_DIGITS], dp[BN_MAX_DIGITS], x[2 * BN_MAX_DIGITS];
+	uint32_t digits = 128, pdigits, k, i;
+	clock_t start;
+	double t1, t2;
+
+	printf("Modular inversion test is beginning!\n");
+	KEY_LOAD_PK(pk[0], key_2048, KEY_2048_BITS);
+	KEY_LOAD_SK(sk[0], key_2048, KEY_2048_BITS);
+	KEY_LOAD_PK(pk[1], key_3072, KEY_3072_BITS);
+	KEY_LOAD_SK(sk[1], key_3072, KEY_3072_BITS);
+	KEY_LOAD_PK(pk[2], key, KEY_M_BITS);
+	KEY_LOAD_SK(sk[2], key, KEY_M_BITS);
+	for(k=0; k<3; k++) {
+		if(coefficients_derived(&sk[k]) != 0) {
+			printf("%u-bit qInv = q^-1 mod p Error\n", sk[k].bits);
+			return 1;
+		}
+	}
+
+	// Even modulus: d = e^-1 mod (p-1)(q-1) must reduce to dP mod p-1
+	pdigits = (KEY_2048_BITS / 2) / 32;
+	bn_decode(p, pdigits, sk[0].prime1, RSA_MAX_PRIME_LEN);
+	bn_decode(q, pdigits, sk[0].prime2, RSA_MAX_PRIME_LEN);
+	bn_decode(dp, pdigits, sk[0].prime_exponent1, RSA_MAX_PRIME_LEN);
+	bn_decode(e, 2 * pdigits, sk[0].public_exponet, RSA_MAX_MODULUS_LEN);
+	p[0] -= 1;
+	q[0] -= 1;
+	bn_mul(phi, p, q, pdigits);
+	if(bn_mod_inv(d, e, phi, 2 * pdigits) != 0) {
+		printf("Inverse mod phi Error\n");
+		return 1;
+	}
+	bn_mod(x, d, 2 * pdigits, p, pdigits);
+	if(memcmp(x, dp, pdigits * 4) != 0) {
+		printf("Inverse mod phi does not match dP\n");
+		return 1;
+	}
+
+	// 64 blinding-style values mod the 4096-bit n, one at a time and batched
+	bn_decode(n, digits, sk[2].modulus, RSA_MAX_MODULUS_LEN);
+	for(i=0; i<64; i++) {
+		generate_rand((uint8_t *)&b[i * digits], digits * 4);
+		b[i * digits + digits - 1] &= 0x7FFFFFFF;
+	}
+	start = clock();
+	for(i=0; i<64; i++) {
+		if(bn_mod_inv(&a1[i * digits], &b[i * digits], n, digits) != 0) {
+			printf("Inverse mod n Error\n");
+			return 1;
+		}
+	}
+	t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+	start = clock();
+	if(bn_mod_inv_batch(a2, b, 64, n, digits) != 0 || memcmp(a1, a2, sizeof(a1)) != 0) {
+		printf("Batched inversion Error\n");
+		return 1;
+	}
+	t2 = (double)(clock() - start) / CLOCKS_PER_SEC;
+	bn_mod_mul(x, a2, b, n, digits);
+	if(bn_digits(x, digits) != 1 || x[0] != 1) {
+		printf("b * b^-1 mod n Error\n");
+		return 1;
+	}
+	printf("64 inverses mod a 4096-bit n: one by one time(s): %f; batched time(s): %f\n", t1, t2);
+	printf("Modular inversion success!\n");
+	return 0;
+}
+int key_store_test()
+{
+	const char *path = "main_keystore.tmp";
+	rsa_key_ctx_t ctx[2];
+	rsa_keystore_t ks;
+	rsa_key_ctx_t *key;
+	rsa_pk_t pk = {0};
+	rsa_sk_t sk = {0};
+	uint8_t input[KEY_M_LEN-11], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, msg_len, i;
+	uint32_t ids[2] = {7, 3};
+	int status;
+
+	printf("Key store test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+	KEY_LOAD_SK(sk, key, KEY_M_BITS);
+
+	// The build-time context must equal one prepared at run time
+	if((status = rsa_key_ctx_init(&ctx[0], &sk, 0)) != 0)
+		return status;
+	if(memcmp(&ctx[0], &key_ctx, sizeof(key_ctx)) != 0) {
+		printf("Built-in key context differs from rsa_key_ctx_init\n");
+		return 1;
+	}
+
+	// The same key under two ids, written out of order
+	for(i=0; i<2; i++) {
+		ctx[i] = key_ctx;
+		ctx[i].key_id = ids[i];
+	}
+	if((status = rsa_keystore_write(path, ctx, 2)) != 0 || (status = rsa_keystore_open(&ks, path)) != 0) {
+		printf("Key store write/open Error Code:%x\n", status);
+		remove(path);
+		return 1;
+	}
+
+	generate_rand(input, sizeof(input));
+	status = rsa_public_encrypt(output, &outputLen, input, sizeof(input), &pk);
+	for(i=0; i<2 && status == 0; i++) {
+		if((key = rsa_keystore_find(&ks, ids[i])) == NULL)
+			status = 1;
+		else if((status = rsa_private_decrypt_ctx(msg, &msg_len, output, outputLen, key)) == 0)
+			status = msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0;
+	}
+	if(status == 0 && rsa_keystore_find(&ks, 5) != NULL)
+		status = 1;
+	rsa_keystore_close(&ks);
+
+	// A damaged record still opens, but is refused on its first lookup
+	ctx[1].prime[0].dwin[0] ^= 1;
+	if(status == 0 && (status = rsa_keystore_write(path, ctx, 2)) == 0 && (status = rsa_keystore_open(&ks, path)) == 0) {
+		status = rsa_keystore_find(&ks, ids[0]) == NULL || rsa_keystore_find(&ks, ids[1]) != NULL ||
+			rsa_keystore_find(&ks, ids[1]) != NULL;
+		rsa_keystore_close(&ks);
+	}
+	remove(path);
+	if(status != 0) {
+		printf("Key store private decrypt Error\n");
+		return 1;
+	}
+	printf("Key store private decrypt success!\n");
+	return 0;
+}
+int shared_key_store_test()
+{
+	rsa_keystore_t ks;
+	rsa_key_ctx_t *key;
+	rsa_pk_t pk = {0};
+	rsa_sk_t sk[2] = {0};
+	uint8_t input[KEY_M_LEN-11], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, msg_len, i;
+	uint32_t ids[2] = {7, 3};
+	pid_t pid[2];
+	int fd, wstatus, status;
+
+	printf("Shared key store test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+	for(i=0; i<2; i++) {
+		KEY_LOAD_SK(sk[i], key, KEY_M_BITS);
+	}
+	if((status = rsa_keystore_shm_create(&fd, sk, ids, 2)) != 0) {
+		printf("Shared key store create Error Code:%x\n", status);
+		return 1;
+	}
+	memset(sk, 0, sizeof(sk));
+
+	// The segment is sealed: nobody can map it writable any more
+	if(mmap(NULL, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED) {
+		printf("Shared key store is writable\n");
+		close(fd);
+		return 1;
+	}
+
+	generate_rand(input, sizeof(input));
+	if((status = rsa_public_encrypt(output, &outputLen, input, sizeof(input), &pk)) != 0) {
+		close(fd);
+		return 1;
+	}
+
+	// Pre-fork workers: each attaches the parent's segment and decrypts
+	for(i=0; i<2; i++) {
+		if((pid[i] = fork()) == 0) {
+			if((status = rsa_keystore_open_fd(&ks, fd)) == 0) {
+				if((key = rsa_keystore_find(&ks, ids[i])) == NULL)
+					status = 1;
+				else if((status = rsa_private_decrypt_ctx(msg, &msg_len, output, outputLen, key)) == 0)
+					status = msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0;
+				rsa_keystore_close(&ks);
+			}
+			_exit(status != 0);
+		}
+	}
+	for(i=0; i<2; i++) {
+		if(pid[i] < 0 || waitpid(pid[i], &wstatus, 0) != pid[i] || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+			status = 1;
+	}
+	close(fd);
+	if(status != 0) {
+		printf("Shared key store worker decrypt Error\n");
+		return 1;
+	}
+	printf("Shared key store worker decrypt success!\n");
+	return 0;
+}
+// DER import of the 2048-bit key, then a directory of copies loaded in parallel
+int der_test()
+{
+	const char *dir = "main_der.tmp";
+	const uint32_t nkeys = 1000;
+	static rsa_pk_t pk, ref_pk;
+	static rsa_sk_t sk, ref_sk;
+	static rsa_key_ctx_t ref;
+	rsa_key_ctx_t *ctx = NULL;
+	uint8_t input[256-11], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, msg_len, count = 0, i;
+	struct timespec start, end;
+	char path[64];
+	FILE *f;
+	int status;
+
+	printf("DER key loader test is beginning!\n");
+	KEY_LOAD_PK(ref_pk, key_2048, KEY_2048_BITS);
+	KEY_LOAD_SK(ref_sk, key_2048, KEY_2048_BITS);
+	if(rsa_der_parse_private(&sk, key_2048_pkcs8, sizeof(key_2048_pkcs8)) != 0 ||
+	   rsa_der_parse_public(&pk, key_2048_spki, sizeof(key_2048_spki)) != 0 ||
+	   memcmp(&sk, &ref_sk, sizeof(sk)) != 0 || memcmp(&pk, &ref_pk, sizeof(pk)) != 0) {
+		printf("DER key parse Error\n");
+		return 1;
+	}
+	// A truncated key must be refused
+	if(rsa_der_parse_private(&sk, key_2048_pkcs8, sizeof(key_2048_pkcs8) - 1) == 0) {
+		printf("Truncated DER key accepted\n");
+		return 1;
+	}
+
+	// Keys written in reverse order, plus a file the loader must skip
+	mkdir(dir, 0700);
+	status = 0;
+	for(i=0; i<nkeys && status==0; i++) {
+		snprintf(path, sizeof(path), "%s/%u.der", dir, nkeys - i);
+		if((f = fopen(path, "wb")) == NULL || fwrite(key_2048_pkcs8, sizeof(key_2048_pkcs8), 1, f) != 1)
+			status = 1;
+		if(f != NULL)
+			fclose(f);
+	}
+	snprintf(path, sizeof(path), "%s/notes.txt", dir);
+	if((f = fopen(path, "w")) != NULL)
+		fclose(f);
+
+	if(status == 0) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		status = rsa_der_load_dir(dir, 4, &ctx, &count);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		printf("DER loader: %u keys parsed and prepared in %lf s\n", count,
+			(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+	}
+	if(status == 0)
+		status = count != nkeys || rsa_key_ctx_init(&ref, &ref_sk, count) != 0 ||
+			memcmp(&ctx[count-1], &ref, sizeof(ref)) != 0;
+	for(i=0; i<count && status==0; i++)
+		status = ctx[i].key_id != i + 1;
+	if(status == 0) {
+		generate_rand(input, sizeof(input));
+		if((status = rsa_public_encrypt(output, &outputLen, input, sizeof(input), &pk)) == 0 &&
+		   (status = rsa_private_decrypt_ctx(msg, &msg_len, output, outputLen, &ctx[count/2])) == 0)
+			status = msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0;
+	}
+
+	free(ctx);
+	for(i=0; i<nkeys; i++) {
+		snprintf(path, sizeof(path), "%s/%u.der", dir, i + 1);
+		remove(path);
+	}
+	snprintf(path, sizeof(path), "%s/notes.txt", dir);
+	remove(path);
+	remove(dir);
+	if(status != 0) {
+		printf("DER key loader Error\n");
+		return 1;
+	}
+	printf("DER key loader success!\n");
+	return 0;
+}
+static int load_builtin_ctx(void *arg, uint32_t key_id, rsa_key_ctx_t *ctx)
+{
+	*ctx = *(rsa_key_ctx_t *)arg;
+	ctx->key_id = key_id;
+	return 0;
+}
+
+int key_cache_test()
+{
+	rsa_key_cache_t cache;
+	rsa_key_cache_stats_t stats;
+	rsa_key_ctx_t *key;
+	rsa_pk_t pk = {0};
+	uint8_t input[KEY_M_LEN-11], output[RSA_MAX_MODULUS_LEN], msg[RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, msg_len, i;
+	clock_t start, end;
+	int status;
+
+	printf("Key cache test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+
+	generate_rand(input, sizeof(input));
+	if((status = rsa_public_encrypt(output, &outputLen, input, sizeof(input), &pk)) != 0)
+		return status;
+
+	// 64 tenants sharing the same key material, cache sized for 32 of them
+	rsa_key_cache_init(&cache, 32, load_builtin_ctx, &key_ctx);
+	start = clock();
+	for(i=0; i<1000 && status == 0; i++) {
+		if((key = rsa_key_cache_get(&cache, (i * 7) % (i < 500 ? 16 : 64))) == NULL) {
+			status = 1;
+			break;
+		}
+		if(i % 100 == 0 && (status = rsa_private_decrypt_ctx(msg, &msg_len, output, outputLen, key)) == 0)
+			status = msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0;
+		rsa_key_cache_put(&cache, key);
+	}
+	end = clock();
+	rsa_key_cache_stats(&cache, &stats);
+	rsa_key_cache_destroy(&cache);
+	printf("key cache: %llu hits, %llu misses, %llu evictions, %u entries, time(s): %lf\n",
+		(unsigned long long)stats.hits, (unsigned long long)stats.misses,
+		(unsigned long long)stats.evictions, stats.entries, (double)(end-start)/CLOCKS_PER_SEC);
+
+	if(status != 0) {
+		printf("Key cache private decrypt Error\n");
+		return 1;
+	}
+	printf("Key cache private decrypt success!\n");
+	return 0;
+}
+int worker_pool_test()
+{
+	rsa_pool_t *pool;
+	rsa_batch_t batch[num_test];
+	rsa_pk_t pk = {0};
+	uint8_t input[KEY_M_LEN-11], cipher[num_test][RSA_MAX_MODULUS_LEN], msg[num_test][RSA_MAX_MODULUS_LEN];
+	uint32_t outputLen, key, i;
+	struct timespec start, end;
+	int status;
+
+	printf("Worker pool test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+
+	generate_rand(input, sizeof(input));
+	for(i=0; i<num_test; i++) {
+		if((status = rsa_public_encrypt(cipher[i], &outputLen, input, sizeof(input), &pk)) != 0)
+			return status;
+		batch[i].in = cipher[i];
+		batch[i].in_len = outputLen;
+		batch[i].out = msg[i];
+	}
+
+	if((pool = rsa_pool_create(4, 0)) == NULL)
+		return 1;
+	status = rsa_pool_add_key(pool, &key_ctx, &key);
+	if(status == 0) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		status = rsa_pool_run(pool, key, RSA_POOL_OP_DECRYPT, batch, num_test);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		printf("worker pool: %u node(s), %u worker(s), %d decrypts in %lf s\n", rsa_pool_nodes(pool), rsa_pool_workers(pool),
+			num_test, (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+	}
+	for(i=0; i<num_test && status == 0; i++)
+		status = batch[i].out_len != sizeof(input) || memcmp(batch[i].out, input, sizeof(input)) != 0;
+	rsa_pool_destroy(pool);
+
+	if(status != 0) {
+		printf("Worker pool private decrypt Error\n");
+		return 1;
+	}
+	printf("Worker pool private decrypt success!\n");
+	return 0;
+}
+// Cuts buf into segments of the given sizes, the last one taking the rest
+static uint32_t split_iov(struct iovec *iov, uint8_t *buf, size_t len, const uint32_t *sizes, uint32_t n)
+{
+	uint32_t i;
+
+	for(i=0; i<n-1 && sizes[i]<len; i++) {
+		iov[i].iov_base = buf;
+		iov[i].iov_len = sizes[i];
+		buf += sizes[i];
+		len -= sizes[i];
+	}
+	iov[i].iov_base = buf;
+	iov[i].iov_len = len;
+	return i + 1;
+}
+// Scatter/gather entry points against the contiguous ones
+int iov_test()
+{
+	static const uint32_t in_sizes[] = {7, 0, 600, 1, 1200}, out_sizes[] = {512, 100, 1500, 3};
+	static uint8_t input[3 * (KEY_M_LEN-11) + 17], cipher[4 * KEY_M_LEN], ref[KEY_M_LEN], msg[sizeof(input)];
+	static rsa_key_ctx_t bad;
+	struct iovec in_iov[5], out_iov[5], back_iov[5];
+	rsa_pk_t pk = {0};
+	uint32_t in_cnt, out_cnt, back_cnt, cipher_len, msg_len, ref_len, len, i;
+	int status;
+
+	printf("Scatter/gather test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+	generate_rand(input, sizeof(input));
+	in_cnt = split_iov(in_iov, input, sizeof(input), in_sizes, 5);
+	out_cnt = split_iov(out_iov, cipher, sizeof(cipher), out_sizes, 4);
+	back_cnt = split_iov(back_iov, msg, sizeof(msg), out_sizes, 4);
+
+	// Private encryption is deterministic: block by block it must match the contiguous call
+	status = rsa_private_encrypt_iov_ctx(out_iov, out_cnt, &cipher_len, in_iov, in_cnt, &key_ctx);
+	for(i=0; i<4 && status==0; i++) {
+		len = i < 3 ? KEY_M_LEN-11 : 17;
+		if((status = rsa_private_encrypt_ctx(ref, &ref_len, input + i * (KEY_M_LEN-11), len, &key_ctx)) == 0)
+			status = cipher_len != sizeof(cipher) || memcmp(ref, cipher + i * KEY_M_LEN, KEY_M_LEN) != 0;
+	}
+
+	// Public encryption, then decryption into scattered output
+	if(status == 0 && (status = rsa_public_encrypt_iov(out_iov, out_cnt, &cipher_len, in_iov, in_cnt, &pk)) == 0 &&
+	   (status = rsa_private_decrypt_iov_ctx(back_iov, back_cnt, &msg_len, out_iov, out_cnt, &key_ctx)) == 0)
+		status = msg_len != sizeof(input) || memcmp(msg, input, sizeof(input)) != 0;
+
+	// In place: the messages overwrite the ciphertext they came from
+	if(status == 0 && (status = rsa_private_decrypt_iov_ctx(out_iov, out_cnt, &msg_len, out_iov, out_cnt, &key_ctx)) == 0)
+		status = msg_len != sizeof(input) || memcmp(cipher, input, sizeof(input)) != 0;
+
+	// Too little room for the output is refused
+	out_iov[out_cnt-1].iov_len--;
+	if(status == 0 && rsa_public_encrypt_iov(out_iov, out_cnt, &cipher_len, in_iov, in_cnt, &pk) != ERR_WRONG_LEN)
+		status = 1;
+
+	// So is a context without a modulus length
+	bad = key_ctx;
+	bad.bits = 0;
+	if(status == 0 && rsa_private_decrypt_iov_ctx(back_iov, back_cnt, &msg_len, in_iov, in_cnt, &bad) != ERR_WRONG_LEN)
+		status = 1;
+
+	if(status != 0) {
+		printf("Scatter/gather Error\n");
+		return 1;
+	}
+	printf("Scatter/gather encrypt and decrypt success!\n");
+	return 0;
+}
+int container_test()
+{
+	static uint8_t input[20000], plain[sizeof(input)], box[30000];
+	rsa_pk_t pk = {0};
+	rsa_sk_t sk = {0};
+	rsa_key_ctx_t ctx;
+	rsa_container_t c;
+	rsa_pool_t *pool;
+	uint64_t box_len;
+	uint32_t key;
+	clock_t start;
+	struct timespec wall_start, wall_end;
+	double t_all, t_pool = 0, t_record;
+	int status;
+
+	printf("Chunked container test is beginning!\n");
+	KEY_LOAD_PK(pk, key_2048, KEY_2048_BITS);
+	KEY_LOAD_SK(sk, key_2048, KEY_2048_BITS);
+	if(rsa_container_len(KEY_2048_BITS, sizeof(input)) > sizeof(box) || rsa_key_ctx_init(&ctx, &sk, 7) != 0)
+		return 1;
+
+	generate_rand(input, sizeof(input));
+	status = rsa_container_encrypt(box, &box_len, input, sizeof(input), 7, &pk);
+	if(status == 0)
+		status = rsa_container_open(&c, box, box_len);
+	if(status == 0) {
+		start = clock();
+		status = rsa_container_decrypt_blocks(&c, 0, c.blocks, plain, &ctx);
+		t_all = (double)(clock() - start) / CLOCKS_PER_SEC;
+		status |= memcmp(plain, input, sizeof(input)) != 0;
+	}
+	if(status == 0 && (pool = rsa_pool_create(1, 0)) != NULL) {
+		memset(plain, 0, sizeof(plain));
+		status = rsa_pool_add_key(pool, &ctx, &key);
+		// Wall time: clock() would add up the CPU time of all workers
+		clock_gettime(CLOCK_MONOTONIC, &wall_start);
+		if(status == 0)
+			status = rsa_container_decrypt_blocks_pool(&c, 0, c.blocks, plain, pool, key);
+		clock_gettime(CLOCK_MONOTONIC, &wall_end);
+		t_pool = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+		status |= memcmp(plain, input, sizeof(input)) != 0;
+		rsa_pool_destroy(pool);
+	}
+	if(status == 0) {
+		// One 100 byte record straddling a block boundary
+		start = clock();
+		status = rsa_container_decrypt_range(&c, 12300, 100, plain, &ctx);
+		t_record = (double)(clock() - start) / CLOCKS_PER_SEC;
+		status |= memcmp(plain, input + 12300, 100) != 0;
+	}
+	if(status == 0) {
+		ctx.key_id = 8;
+		status = rsa_container_decrypt_blocks(&c, 0, 1, plain, &ctx) != ERR_WRONG_DATA;
+	}
+	memset(&ctx, 0, sizeof(ctx));
+
+	if(status != 0) {
+		printf("Chunked container Error\n");
+		return 1;
+	}
+	printf("%u blocks: all time(s): %f; pool time(s): %f; one record time(s): %f\n", c.blocks, t_all, t_pool, t_record);
+	printf("Chunked container decrypt success!\n");
+	return 0;
+}
+int mulx_kernel_test()
+{
+	bn_t m[BN_MAX_DIGITS], a[BN_MAX_DIGITS], b[BN_MAX_DIGITS], c1[BN_MAX_DIGITS], c2[BN_MAX_DIGITS];
+	uint32_t digits, i, k;
+	bn_t n0inv;
+
+	printf("MULX Montgomery kernel test is beginning!\n");
+	if(!bn_mulx_supported()) {
+		printf("MULX Montgomery kernel skipped, no BMI2/ADX\n");
+		return 0;
+	}
+	for(digits=32; digits<=96; digits+=16) {
+		for(k=0; k<1000; k++) {
+			generate_rand((uint8_t *)m, digits * 4);
+			generate_rand((uint8_t *)a, digits * 4);
+			generate_rand((uint8_t *)b, digits * 4);
+			m[0] |= 1;
+			m[digits-1] |= 0x80000000;
+			a[digits-1] &= 0x7FFFFFFF;
+			b[digits-1] &= 0x7FFFFFFF;
+			n0inv = bn_mont_n0inv(m[0]);
+			for(i=0; i<4; i++) {
+				montMulComba(c1, a, b, m, digits, n0inv);
+				montMulMulx(c2, a, b, m, digits, n0inv);
+				if(memcmp(c1, c2, digits * 4) != 0) {
+					printf("MULX Montgomery kernel Error at %u digits\n", digits);
+					return 1;
+				}
+				bn_assign(a, c1, digits);
+			}
+		}
+	}
+	printf("MULX Montgomery kernel matches the C reference!\n");
+	return 0;
+}
+// Wall time since start
+static double elapsed(struct timespec *start)
+{
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+// comba's dual-lane pair against two single exponentiations; times are the
+// best of 10 pairs per size, so one slow run does not decide the comparison
+int dual_lane_test()
+{
+	static const uint32_t sizes[] = { 32, 43, 48, 64 };
+	bn_t m[2][BN_MAX_DIGITS], b[2][BN_MAX_DIGITS], d[2][BN_MAX_DIGITS], rr[2][BN_MAX_DIGITS], one[2][BN_MAX_DIGITS];
+	bn_t a1[2][BN_MAX_DIGITS], a2[2][BN_MAX_DIGITS];
+	const bn_engine_t *engine = bn_engine_find("comba");
+	bn_modulus_t mod[2];
+	bn_exp_lane_t lane[2];
+	struct timespec start;
+	double t1, t2, dt;
+	uint32_t digits, s, k, l;
+
+	printf("Dual-lane CRT exponentiation test is beginning!\n");
+	for(s=0; s<sizeof(sizes)/sizeof(sizes[0]); s++) {
+		digits = sizes[s];
+		t1 = t2 = 0;
+		for(k=0; k<10; k++) {
+			for(l=0; l<2; l++) {
+				generate_rand((uint8_t *)m[l], digits * 4);
+				generate_rand((uint8_t *)b[l], digits * 4);
+				generate_rand((uint8_t *)d[l], digits * 4);
+				m[l][0] |= 1;
+				m[l][digits-1] |= 0x80000000;
+				b[l][digits-1] &= 0x7FFFFFFF;
+				d[l][digits-1] >>= l * 7;
+				mod[l].m = m[l];
+				mod[l].digits = digits;
+				mod[l].n0inv = bn_mont_n0inv(m[l][0]);
+				mod[l].cutoff = BN_KARATSUBA_CUTOFF;
+				bn_mont_setup(rr[l], one[l], m[l], digits);
+				lane[l] = (bn_exp_lane_t){ a2[l], b[l], d[l], digits, &mod[l], rr[l], one[l], NULL, 0 };
+			}
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for(l=0; l<2; l++)
+				bn_engine_exp(engine, BN_EXP_WINDOW_BITS, a1[l], b[l], d[l], digits, &mod[l], rr[l], one[l]);
+			dt = elapsed(&start);
+			t1 = k == 0 || dt < t1 ? dt : t1;
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			bn_engine_exp2(engine, BN_EXP_WINDOW_BITS, lane);
+			dt = elapsed(&start);
+			t2 = k == 0 || dt < t2 ? dt : t2;
+			if(memcmp(a1[0], a2[0], digits * 4) != 0 || memcmp(a1[1], a2[1], digits * 4) != 0) {
+				printf("Dual-lane exponentiation Error at %u digits\n", digits);
+				return 1;
+			}
+		}
+		printf("%u digits: comba sequential pair time(s): %f; dual-lane time(s): %f (%.0f%% faster)\n",
+			digits, t1, t2, 100 * (t1 / t2 - 1));
+	}
+	printf("Dual-lane exponentiation matches sequential!\n");
+	return 0;
+}
+// Every engine against comba: the CRT-half sizes of 2048- to 4096-bit keys
+// (odd ones with short top limbs, as for 1365-bit primes) at every window,
+// with the tuned width, then the long moduli
+int long_modulus_test()
+{
+	static const uint32_t sizes[] = { 32, 43, 48, 64, 128, 256, 512 };
+	static bn_t m[BN_MAX_DIGITS], b[BN_MAX_DIGITS], d[4], rr[BN_MAX_DIGITS], one[BN_MAX_DIGITS];
+	static bn_t a0[BN_MAX_DIGITS], a1[BN_MAX_DIGITS], p0[2*BN_MAX_DIGITS], p1[2*BN_MAX_DIGITS];
+	static bn_t wm[BN_MAX_DIGITS], wrr[BN_MAX_DIGITS], wone[BN_MAX_DIGITS];
+	static const char *names[] = { "mulx", "sos", "amm", "cios", "redc", "classic" };
+	const bn_engine_t *comba = bn_engine_find("comba"), *engine;
+	bn_modulus_t mod, wide;
+	bn_tune_t tune;
+	clock_t start;
+	double t0, t1;
+	uint32_t digits, window, s, i;
+
+	printf("Long modulus test is beginning!\n");
+	for(s=0; s<sizeof(sizes)/sizeof(sizes[0]) && sizes[s]<BN_MAX_DIGITS; s++) {
+		digits = sizes[s];
+		generate_rand((uint8_t *)m, digits * 4);
+		generate_rand((uint8_t *)b, digits * 4);
+		generate_rand((uint8_t *)d, sizeof(d));
+		m[0] |= 1;
+		m[digits-1] |= 0x80000000;
+		if(digits & 1)
+			m[digits-1] >>= 11;
+		b[digits-1] = m[digits-1] >> 1;
+		bn_mul_comba(p0, b, m, digits);
+		bn_mul_fast(p1, b, m, digits, BN_KARATSUBA_CUTOFF);
+		if(memcmp(p0, p1, digits * 8) != 0) {
+			printf("Long modulus product Error at %u digits\n", digits);
+			return 1;
+		}
+		mod.m = m;
+		mod.digits = digits;
+		mod.n0inv = bn_mont_n0inv(m[0]);
+		mod.cutoff = BN_KARATSUBA_CUTOFF;
+		mod.ninv = NULL;
+		bn_mont_setup(rr, one, m, digits);
+		for(window=1; window<=BN_ENGINE_MAX_WINDOW_BITS; window++) {
+			// Long moduli only at the default window, they are slow
+			if(digits >= 128 && window != BN_EXP_WINDOW_BITS)
+				continue;
+			start = clock();
+			bn_engine_exp(comba, window, a0, b, d, 4, &mod, rr, one);
+			t0 = (double)(clock() - start) / CLOCKS_PER_SEC;
+			for(i=0; i<sizeof(names)/sizeof(names[0]); i++) {
+				engine = bn_engine_find(names[i]);
+				if(!bn_engine_supports(engine, digits))
+					continue;
+				start = clock();
+				bn_engine_exp(engine, window, a1, b, d, 4, &mod, rr, one);
+				t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+				if(memcmp(a0, a1, digits * 4) != 0) {
+					printf("Long modulus %s Error at %u digits, window %u\n", names[i], digits, window);
+					return 1;
+				}
+				if(digits >= 128)
+					printf("%u-bit modulus, 128-bit exponent: comba time(s): %f; %s time(s): %f\n", digits * 32, t0, names[i], t1);
+			}
+
+			// The default engine at its width, zero-extended as for a prime
+			bn_tune_lookup(digits, &tune);
+			wide = mod;
+			wide.cutoff = tune.cutoff;
+			bn_assign(wrr, rr, digits);
+			bn_assign(wone, one, digits);
+			if(tune.width > digits) {
+				bn_engine_widen(&wide, wm, wrr, wone, &mod, rr, one, tune.width);
+				bn_assign_zero(&b[digits], tune.width - digits);
+			}
+			bn_engine_exp(tune.engine, window, a1, b, d, 4, &wide, wrr, wone);
+			if(memcmp(a0, a1, digits * 4) != 0) {
+				printf("Long modulus %s at width %u Error at %u digits\n", tune.engine->name, tune.width, digits);
+				return 1;
+			}
+		}
+	}
+	printf("Long modulus engines match comba!\n");
+	return 0;
+}
+// Known answers: SHA-256("abc") (FIPS 180-2), AES-256-GCM test case 16 of the
+// GCM specification on both paths, and the KEM's KDF2-SHA256 for z = 1
+int known_answer_test()
+{
+	static const uint8_t gcm_key[] = {
+		0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+		0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+	};
+	static const uint8_t gcm_iv[] = {
+		0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+	};
+	static const uint8_t gcm_aad[] = {
+		0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+		0xab, 0xad, 0xda, 0xd2
+	};
+	static const uint8_t gcm_plain[] = {
+		0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+		0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+		0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+		0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+	};
+	static const uint8_t gcm_cipher[] = {
+		0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+		0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+		0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+		0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62
+	};
+	static const uint8_t gcm_tag[] = {
+		0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b
+	};
+	static const uint8_t sha_abc[] = {
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+	};
+	static const uint8_t kdf_z1[] = {
+		0x08, 0x19, 0x99, 0xb2, 0xb4, 0x4d, 0x88, 0x9e, 0xeb, 0xf5, 0xe1, 0x2c, 0x60, 0x5d, 0x0a, 0xfc,
+		0x80, 0x29, 0x88, 0x1d, 0x54, 0xa1, 0xb3, 0x15, 0x0b, 0x45, 0x13, 0xd2, 0x9f, 0x62, 0x44, 0x6e,
+		0x0f, 0x38, 0x1b, 0xad, 0xea, 0x2d, 0xcc, 0x0a, 0x97, 0x2a, 0x52, 0xf8
+	};
+	uint8_t digest[SHA256_DIGEST_LEN], out[sizeof(gcm_plain)], tag[AES_GCM_TAG_LEN], z[KEY_M_LEN] = {0}, key[sizeof(kdf_z1)];
+	aes_gcm_t ctx;
+	int ni, status = 0;
+
+	printf("Known answer test is beginning!\n");
+	sha256(digest, (const uint8_t *)"abc", 3);
+	if(memcmp(digest, sha_abc, sizeof(sha_abc)) != 0) {
+		printf("SHA-256 known answer Error\n");
+		status = 1;
+	}
+
+	// ni = 1 only where AES-NI is present; ni = 0 forces the portable path
+	for(ni=aes_gcm_ni_supported(); ni>=0; ni--) {
+		aes_gcm_init(&ctx, gcm_key, gcm_iv, gcm_aad, sizeof(gcm_aad));
+		ctx.ni = ni;
+		aes_gcm_encrypt(&ctx, out, gcm_plain, sizeof(gcm_plain));
+		aes_gcm_tag(&ctx, tag);
+		if(memcmp(out, gcm_cipher, sizeof(gcm_cipher)) != 0 || memcmp(tag, gcm_tag, sizeof(gcm_tag)) != 0) {
+			printf("AES-256-GCM known answer Error (%s)\n", ni ? "AES-NI" : "portable");
+			status = 1;
+		}
+		aes_gcm_init(&ctx, gcm_key, gcm_iv, gcm_aad, sizeof(gcm_aad));
+		ctx.ni = ni;
+		aes_gcm_decrypt(&ctx, out, gcm_cipher, sizeof(gcm_cipher));
+		if(aes_gcm_check(&ctx, gcm_tag) != 0 || memcmp(out, gcm_plain, sizeof(gcm_plain)) != 0) {
+			printf("AES-256-GCM known answer decrypt Error (%s)\n", ni ? "AES-NI" : "portable");
+			status = 1;
+		}
+	}
+
+	// 1^d = 1, so decapsulating the block 1 derives the key from z = 1
+	z[KEY_M_LEN-1] = 1;
+	if(rsa_kem_decapsulate_ctx(key, sizeof(key), z, sizeof(z), &key_ctx) != 0 || memcmp(key, kdf_z1, sizeof(kdf_z1)) != 0) {
+		printf("KDF2-SHA256 known answer Error\n");
+		status = 1;
+	}
+
+	if(status == 0)
+		printf("SHA-256, AES-256-GCM and KDF2 known answers match!\n");
+	return status;
+}
+int hybrid_test()
+{
+	static uint8_t input[1 << 20], output[(1 << 20) + RSA_HYBRID_OVERHEAD(RSA_MAX_MODULUS_BITS)], msg[1 << 20];
+	rsa_hybrid_t h;
+	rsa_pk_t pk = {0};
+	rsa_sk_t sk = {0};
+	uint32_t outputLen, msg_len, header_len, i, n;
+	clock_t start;
+	int status;
+
+	printf("Hybrid RSA-KEM + AES-GCM test is beginning!\n");
+	KEY_LOAD_PK(pk, key, KEY_M_BITS);
+	KEY_LOAD_SK(sk, key, KEY_M_BITS);
+	generate_rand(input, sizeof(input));
+
+	// Stream the payload in odd-sized pieces, then open it in one call
+	start = clock();
+	if((status = rsa_hybrid_encrypt_init(&h, output, &header_len, &pk)) != 0) {
+		printf("rsa_hybrid_encrypt_init Error Code:%x\n", status);
+		return status;
+	}
+	for(i=0; i<sizeof(input); i+=n) {
+		n = sizeof(input) - i < 4093 ? sizeof(input) - i : 4093;
+		rsa_hybrid_encrypt_update(&h, output + header_len + i, input + i, n);
+	}
+	rsa_hybrid_encrypt_final(&h, output + header_len + sizeof(input));
+	outputLen = header_len + sizeof(input) + AES_GCM_TAG_LEN;
+	status = rsa_hybrid_decrypt_ctx(msg, &msg_len, output, outputLen, &key_ctx);
+	printf("hybrid 1 MiB encrypt + decrypt time(s): %f (AES-NI %s)\n",
+		(double)(clock() - start) / CLOCKS_PER_SEC, aes_gcm_ni_supported() ? "on" : "off");
+	if(status != 0 || msg_len != sizeof(input) || memcmp(input, msg, sizeof(input)) != 0) {
+		printf("Hybrid decrypt Error Code:%x\n", status);
+		return 1;
+	}
+
+	// One-shot path, and a flipped ciphertext bit must be rejected
+	if((status = rsa_hybrid_encrypt(output, &outputLen, input, 1000, &pk)) != 0 ||
+	   (status = rsa_hybrid_decrypt(msg, &msg_len, output, outputLen, &sk)) != 0 ||
+	   msg_len != 1000 || memcmp(input, msg, 1000) != 0) {
+		printf("Hybrid one-shot Error Code:%x\n", status);
+		return 1;
+	}
+	output[outputLen - AES_GCM_TAG_LEN - 1] ^= 1;
+	if(rsa_hybrid_decrypt_ctx(msg, &msg_len, output, outputLen, &key_ctx) != ERR_WRONG_DATA || msg_len != 0) {
+		printf("Hybrid decrypt accepted a modified message\n");
+		return 1;
+	}
+	printf("Hybrid encrypt and decrypt success!\n");
+	return 0;
+}
+static void print_metrics_line(void *arg, const char *line, uint32_t len)
+{
+	fwrite(line, 1, len, (FILE *)arg);
+}
+int metrics_test()
+{
+	rsa_histogram_t hist;
+	int op;
+
+	// Everything above has been recorded; show the tails, then the export
+	printf("Latency metrics of the tests above:\n");
+	for(op=0; op<RSA_OP_COUNT; op++) {
+		if(rsa_metrics_snapshot(op, KEY_M_BITS, &hist) != 0)
+			continue;
+		printf("%-24s %6llu calls  p50 %9.3f ms  p99 %9.3f ms  p999 %9.3f ms\n", rsa_metrics_op_name(op),
+			(unsigned long long)hist.count, rsa_metrics_percentile(&hist, 0.5) / 1e6,
+			rsa_metrics_percentile(&hist, 0.99) / 1e6, rsa_metrics_percentile(&hist, 0.999) / 1e6);
+	}
+	if(rsa_metrics_snapshot(RSA_OP_PRIVATE_DECRYPT_BATCH, KEY_M_BITS, &hist) != 0) {
+		printf("Metrics missing the worker pool batches\n");
+		return 1;
+	}
+	return rsa_metrics_export(print_metrics_line, stdout);
+}
 /*void test() {
 	rsa_pk_t pk = { 0 };
 	rsa_sk_t sk = { 0 };
@@ -162,6 +1156,22 @@ int private_enc_dec_test()
 int main(int argc, char const *argv[])
 {
 	private_enc_dec_test();
+	multi_prime_test();
+	mixed_size_test();
+	inversion_test();
+	key_store_test();
+	shared_key_store_test();
+	der_test();
+	key_cache_test();
+	worker_pool_test();
+	iov_test();
+	container_test();
+	mulx_kernel_test();
+	dual_lane_test();
+	long_modulus_test();
+	known_answer_test();
+	hybrid_test();
+	metrics_test();
 	// public_enc_dec();
 	//public_block_operation();
 	//test();
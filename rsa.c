@@ -8,20 +8,30 @@ Description :
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
+#include <sys/random.h>
 
 #include "rsa.h"
 #include "bignum.h"
+#include "bn_engine.h"
+#include "sha256.h"
+#include "rsa_metrics.h"
 
-static int private_block_operation(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+static int private_ctx_block(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx);
 
+// The context layout relies on the bignum limb size
+typedef char rsa_ctx_digits_check[(RSA_MAX_MODULUS_DIGITS == BN_MAX_DIGITS) ? 1 : -1];
+
+// Chunks follow the key's own modulus length, not RSA_MAX_MODULUS_LEN
 int rsa_private_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk){
 	int status=0;
 	int len=0;
 	uint8_t *tmp_o=out;
+	uint32_t chunk=(sk->bits+7)/8-11;
+	uint64_t start=rsa_metrics_begin();
 	*out_len=0;
-	for(int i=0;i<in_len && status==0;i+=(RSA_MAX_MODULUS_LEN-11)){
-		if((in_len-i)>(RSA_MAX_MODULUS_LEN-11)){
-			status=rsa_private_encrypt(tmp_o,&len,in+i,RSA_MAX_MODULUS_LEN-11,sk);
+	for(int i=0;i<in_len && status==0;i+=chunk){
+		if((in_len-i)>chunk){
+			status=rsa_private_encrypt(tmp_o,&len,in+i,chunk,sk);
 		}
 		else{
 			status=rsa_private_encrypt(tmp_o,&len,in+i,in_len-i,sk);
@@ -32,6 +42,7 @@ int rsa_private_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, ui
 	}
 	tmp_o=NULL;
 	free(tmp_o);
+	rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT_ANY_LEN,sk->bits,start);
 	return status;
 }
 
@@ -39,10 +50,12 @@ int rsa_public_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uin
 	int status=0;
 	int len=0;
 	uint8_t *tmp_o=out;
+	uint32_t chunk=(pk->bits+7)/8-11;
+	uint64_t start=rsa_metrics_begin();
 	*out_len=0;
-	for(int i=0;i<in_len && status==0;i+=(RSA_MAX_MODULUS_LEN-11)){
-		if((in_len-i)>(RSA_MAX_MODULUS_LEN-11)){
-			status=rsa_public_encrypt(tmp_o,&len,in+i,RSA_MAX_MODULUS_LEN-11,pk);
+	for(int i=0;i<in_len && status==0;i+=chunk){
+		if((in_len-i)>chunk){
+			status=rsa_public_encrypt(tmp_o,&len,in+i,chunk,pk);
 			tmp_o=tmp_o+len;
 			*out_len+=len;
 		}
@@ -55,6 +68,7 @@ int rsa_public_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uin
 	tmp_o=NULL;
 	free(tmp_o);
 	// *out_len=len;
+	rsa_metrics_end(RSA_OP_PUBLIC_ENCRYPT_ANY_LEN,pk->bits,start);
 	return status;
 }
 
@@ -64,10 +78,12 @@ int rsa_private_decrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, ui
 	int len=0;
 	uint8_t *tmp_o=out;
 	int i=0;
+	uint32_t chunk=(sk->bits+7)/8;
+	uint64_t start=rsa_metrics_begin();
 	*out_len=0;
-	for(i=0;i<in_len && status==0;i+=RSA_MAX_MODULUS_LEN){
-		if((in_len-i)>RSA_MAX_MODULUS_LEN){
-			status=rsa_private_decrypt(tmp_o,&len,in+i,RSA_MAX_MODULUS_LEN,sk);
+	for(i=0;i<in_len && status==0;i+=chunk){
+		if((in_len-i)>chunk){
+			status=rsa_private_decrypt(tmp_o,&len,in+i,chunk,sk);
 			tmp_o=tmp_o+len;
 			*out_len+=len;
 		}
@@ -80,153 +96,484 @@ int rsa_private_decrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, ui
 	}
 	tmp_o=NULL;
 	free(tmp_o);
+	rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT_ANY_LEN,sk->bits,start);
 	return status;
 }
 
+// Padding only: the msg_len message bytes go at block + modulus_len - msg_len
+static void pkcs1_pad_block(uint8_t *block, uint32_t modulus_len, uint32_t msg_len)
+{
+    uint32_t i;
+
+    block[0] = 0;
+    block[1] = 1;
+    for(i=2; i<modulus_len-msg_len-1; i++) {
+        block[i] = 0xFF;
+    }
+
+    block[i] = 0;
+}
+
+// Type 2 padding, nonzero random bytes, laid out as above
+static void pkcs1_pad_block_random(uint8_t *block, uint32_t modulus_len, uint32_t msg_len)
+{
+    uint8_t byte;
+    uint32_t i;
+
+    block[0] = 0;
+    block[1] = 2;
+    for(i=2; i<modulus_len-msg_len-1; i++) {
+        do {
+            generate_rand(&byte, 1);
+        } while(byte == 0);
+        block[i] = byte;
+    }
+    block[i] = 0;
+
+    // Clear potentially sensitive information
+    byte = 0;
+}
+
+// Offset of the message in a decrypted block
+static uint32_t pkcs1_unpad_offset(uint8_t *block, uint32_t modulus_len)
+{
+    uint32_t i;
+
+    /*if((block[0] != 0) || (block[1] != 2))
+        return ERR_WRONG_DATA;*/
+
+    for(i=2; i<modulus_len-1; i++) {
+        if(block[i] == 0)  break;
+    }
+
+    /*if(i + 1 >= modulus_len)
+        return ERR_WRONG_DATA;*/
+    return i + 1;
+}
+
+static void pkcs1_unpad_block(uint8_t *out, uint32_t *out_len, uint8_t *block, uint32_t modulus_len)
+{
+    uint32_t i = pkcs1_unpad_offset(block, modulus_len);
+
+    *out_len = modulus_len - i;
+    /*if(*out_len + 11 > modulus_len)
+        return ERR_WRONG_DATA;*/
+    memcpy((uint8_t *)out, (uint8_t *)&block[i], *out_len);
+}
+
 int rsa_private_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
 {
     int status;
-    uint8_t pkcs_block[RSA_MAX_MODULUS_LEN];
-    uint32_t i, modulus_len;
+    rsa_key_ctx_t ctx;
+    uint64_t start = rsa_metrics_begin();
 
-    modulus_len = (sk->bits + 7) / 8;
-    if(in_len + 11 > modulus_len)
-        return ERR_WRONG_LEN;
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) == 0)
+        status = rsa_private_encrypt_ctx(out, out_len, in, in_len, &ctx);
 
-    pkcs_block[0] = 0;
-    pkcs_block[1] = 1;
-    for(i=2; i<modulus_len-in_len-1; i++) {
-        pkcs_block[i] = 0xFF;
-    }
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT, sk->bits, start);
+    return status;
+}
+
+int rsa_private_decrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
+{
+    int status;
+    rsa_key_ctx_t ctx;
+    uint64_t start = rsa_metrics_begin();
 
-    pkcs_block[i++] = 0;
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) == 0)
+        status = rsa_private_decrypt_ctx(out, out_len, in, in_len, &ctx);
 
-    memcpy((uint8_t *)&pkcs_block[i], (uint8_t *)in, in_len);
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT, sk->bits, start);
+    return status;
+}
+
+int rsa_private_encrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx)
+{
+    int status;
+    uint8_t pkcs_block[RSA_MAX_MODULUS_LEN];
+    uint32_t modulus_len;
+    uint64_t start = rsa_metrics_begin();
 
-    status = private_block_operation(out, out_len, pkcs_block, modulus_len, sk);
+    modulus_len = (ctx->bits + 7) / 8;
+    if(in_len + 11 > modulus_len) {
+        status = ERR_WRONG_LEN;
+    } else {
+        pkcs1_pad_block(pkcs_block, modulus_len, in_len);
+        memcpy(&pkcs_block[modulus_len - in_len], in, in_len);
+        status = private_ctx_block(out, out_len, pkcs_block, modulus_len, ctx);
+    }
 
     // Clear potentially sensitive information
     memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
 
+    rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT_CTX, ctx->bits, start);
     return status;
 }
 
-int rsa_private_decrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
+int rsa_private_decrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx)
 {
     int status;
     uint8_t pkcs_block[RSA_MAX_MODULUS_LEN];
-    uint32_t i, modulus_len, pkcs_block_len;
+    uint32_t modulus_len, pkcs_block_len;
+    uint64_t start = rsa_metrics_begin();
 
-    modulus_len = (sk->bits + 7) / 8;
+    modulus_len = (ctx->bits + 7) / 8;
     /*if(in_len > modulus_len)
         return ERR_WRONG_LEN;*/
 
-    status = private_block_operation(pkcs_block, &pkcs_block_len, in, in_len, sk);
-    /*if(status != 0)
-        return status;*/
+    status = private_ctx_block(pkcs_block, &pkcs_block_len, in, in_len, ctx);
+    if(status == 0 && pkcs_block_len != modulus_len)
+        status = ERR_WRONG_LEN;
+    if(status == 0)
+        pkcs1_unpad_block(out, out_len, pkcs_block, modulus_len);
 
-    if(pkcs_block_len != modulus_len)
-        return ERR_WRONG_LEN;
+    // Clear potentially sensitive information
+    memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
 
-    /*if((pkcs_block[0] != 0) || (pkcs_block[1] != 2))
-        return ERR_WRONG_DATA;*/
+    rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT_CTX, ctx->bits, start);
+    return status;
+}
 
-    for(i=2; i<modulus_len-1; i++) {
-        if(pkcs_block[i] == 0)  break;
+int rsa_private_encrypt_batch_ctx(rsa_batch_t *batch, uint32_t count, rsa_key_ctx_t *ctx)
+{
+    int status = 0;
+    uint32_t i;
+    uint64_t start = rsa_metrics_begin();
+
+    for(i=0; i<count; i++) {
+        batch[i].status = rsa_private_encrypt_ctx(batch[i].out, &batch[i].out_len, batch[i].in, batch[i].in_len, ctx);
+        if(status == 0)
+            status = batch[i].status;
+    }
+
+    rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT_BATCH, ctx->bits, start);
+    return status;
+}
+
+int rsa_private_decrypt_batch_ctx(rsa_batch_t *batch, uint32_t count, rsa_key_ctx_t *ctx)
+{
+    int status = 0;
+    uint32_t i;
+    uint64_t start = rsa_metrics_begin();
+
+    for(i=0; i<count; i++) {
+        batch[i].status = rsa_private_decrypt_ctx(batch[i].out, &batch[i].out_len, batch[i].in, batch[i].in_len, ctx);
+        if(status == 0)
+            status = batch[i].status;
+    }
+
+    rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT_BATCH, ctx->bits, start);
+    return status;
+}
+
+int rsa_private_encrypt_batch(rsa_batch_t *batch, uint32_t count, rsa_sk_t *sk)
+{
+    int status;
+    rsa_key_ctx_t ctx;
+    uint32_t i;
+    uint64_t start = rsa_metrics_begin();
+
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) != 0) {
+        for(i=0; i<count; i++)
+            batch[i].status = status;
+    } else {
+        status = rsa_private_encrypt_batch_ctx(batch, count, &ctx);
     }
 
-    i++;
-    /*if(i >= modulus_len)
-        return ERR_WRONG_DATA;
-    *out_len = modulus_len - i;
-    if(*out_len + 11 > modulus_len)
-        return ERR_WRONG_DATA;*/
-    memcpy((uint8_t *)out, (uint8_t *)&pkcs_block[i], *out_len);
     // Clear potentially sensitive information
-    memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
 
+    rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT_BATCH, sk->bits, start);
     return status;
 }
 
-static int private_block_operation(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
+int rsa_private_decrypt_batch(rsa_batch_t *batch, uint32_t count, rsa_sk_t *sk)
 {
-    uint32_t cdigits, ndigits, pdigits,qq_inv,p_inv;
-    bn_t c[BN_MAX_DIGITS], cp[BN_MAX_DIGITS], cq[BN_MAX_DIGITS];
-    bn_t dp[BN_MAX_DIGITS], dq[BN_MAX_DIGITS], mp[BN_MAX_DIGITS], mq[BN_MAX_DIGITS];
-    bn_t n[BN_MAX_DIGITS], p[BN_MAX_DIGITS], q[BN_MAX_DIGITS], q_inv[BN_MAX_DIGITS], t[BN_MAX_DIGITS],q_rr[BN_MAX_DIGITS];
+    int status;
+    rsa_key_ctx_t ctx;
+    uint32_t i;
+    uint64_t start = rsa_metrics_begin();
 
-    bn_decode(c, BN_MAX_DIGITS, in, in_len);
-    bn_decode(n, BN_MAX_DIGITS, sk->modulus, RSA_MAX_MODULUS_LEN);
-    bn_decode(p, BN_MAX_DIGITS, sk->prime1, RSA_MAX_PRIME_LEN);
-    bn_decode(q, BN_MAX_DIGITS, sk->prime2, RSA_MAX_PRIME_LEN);
-    bn_decode(dp, BN_MAX_DIGITS, sk->prime_exponent1, RSA_MAX_PRIME_LEN);
-    bn_decode(dq, BN_MAX_DIGITS, sk->prime_exponent2, RSA_MAX_PRIME_LEN);
-    bn_decode(q_inv, BN_MAX_DIGITS, sk->coefficient, RSA_MAX_PRIME_LEN);
-    bn_decode(q_rr, BN_MAX_DIGITS, sk->q_rr, RSA_MAX_PRIME_LEN);
-    
-
-    /*print_array("p", p, sizeof(sk->prime1));
-    print_array("q", q, sizeof(sk->prime2));
-    print_array("q_rr", q_rr, sizeof(sk->q_rr));*/
-
-    p_inv = sk->p_inv;
-    cdigits = bn_digits(c, BN_MAX_DIGITS);
-    ndigits = bn_digits(n, BN_MAX_DIGITS);
-    pdigits = bn_digits(p, BN_MAX_DIGITS);
-    qq_inv = sk->qinv;
-    //printf("%x", qq_inv);
-    if(bn_cmp(c, n, ndigits) >= 0)
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) != 0) {
+        for(i=0; i<count; i++)
+            batch[i].status = status;
+    } else {
+        status = rsa_private_decrypt_batch_ctx(batch, count, &ctx);
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT_BATCH, sk->bits, start);
+    return status;
+}
+
+/*
+ * CRT coefficient of prime i for keys imported without one: qInv = q^-1 mod p
+ * for p, t_i = (r_1 * ... * r_(i-1))^-1 mod r_i for the others.
+ */
+static int derive_coefficient(rsa_key_ctx_t *ctx, uint32_t i)
+{
+    rsa_prime_ctx_t *pc = &ctx->prime[i], *pj;
+    bn_t x[BN_MAX_DIGITS], y[BN_MAX_DIGITS], t[BN_MAX_DIGITS];
+    uint32_t j, digits;
+    int status;
+
+    bn_assign_one(x, pc->digits);
+    for(j = i == 0 ? 1 : 0; j < (i == 0 ? 2 : i); j++) {
+        pj = &ctx->prime[j];
+        digits = pj->digits > pc->digits ? pj->digits : pc->digits;
+        bn_assign_zero(t, digits);
+        bn_assign(t, pj->m, pj->digits);
+        bn_mod(y, t, digits, pc->m, pc->digits);
+        bn_mod_mul(x, x, y, pc->m, pc->digits);
+    }
+    status = bn_mod_inv(pc->t, x, pc->m, pc->digits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)x, 0, sizeof(x));
+    memset((uint8_t *)y, 0, sizeof(y));
+    memset((uint8_t *)t, 0, sizeof(t));
+
+    return status;
+}
+
+int rsa_key_ctx_init(rsa_key_ctx_t *ctx, rsa_sk_t *sk, uint32_t key_id)
+{
+    rsa_prime_ctx_t *pc;
+    uint8_t *prime, *exponent, *coefficient;
+    uint32_t i;
+
+    if(sk->other_primes > RSA_MAX_PRIMES - 2 || sk->bits > RSA_MAX_MODULUS_BITS)
         return ERR_WRONG_DATA;
 
-    bn_mod(cp, c, cdigits, p, pdigits);
-    bn_mod(cq, c, cdigits, q, pdigits);
-    bn_mod_exp(mp, cp, dp, pdigits, p, pdigits);
-   
-    bn_assign_zero(mq, ndigits);
+    memset((uint8_t *)ctx, 0, sizeof(*ctx));
+    ctx->magic = RSA_KEY_CTX_MAGIC;
+    ctx->version = RSA_KEY_CTX_VERSION;
+    ctx->size = sizeof(*ctx);
+    ctx->key_id = key_id;
+    ctx->bits = sk->bits;
+    ctx->primes = 2 + sk->other_primes;
+
+    bn_decode(ctx->n, RSA_MAX_MODULUS_DIGITS, sk->modulus, RSA_MAX_MODULUS_LEN);
+    bn_decode(ctx->e, RSA_MAX_MODULUS_DIGITS, sk->public_exponet, RSA_MAX_MODULUS_LEN);
+    ctx->ndigits = bn_digits(ctx->n, RSA_MAX_MODULUS_DIGITS);
+    ctx->edigits = bn_digits(ctx->e, RSA_MAX_MODULUS_DIGITS);
+
+    for(i=0; i<ctx->primes; i++) {
+        if(i == 0) {
+            prime = sk->prime1;
+            exponent = sk->prime_exponent1;
+            coefficient = sk->coefficient;
+        } else if(i == 1) {
+            prime = sk->prime2;
+            exponent = sk->prime_exponent2;
+            coefficient = NULL;
+        } else {
+            prime = sk->other_prime_info[i-2].prime;
+            exponent = sk->other_prime_info[i-2].exponent;
+            coefficient = sk->other_prime_info[i-2].coefficient;
+        }
+
+        pc = &ctx->prime[i];
+        bn_decode(pc->m, RSA_MAX_PRIME_DIGITS, prime, RSA_MAX_PRIME_LEN);
+        bn_decode(pc->d, RSA_MAX_PRIME_DIGITS, exponent, RSA_MAX_PRIME_LEN);
+        if(coefficient)
+            bn_decode(pc->t, RSA_MAX_PRIME_DIGITS, coefficient, RSA_MAX_PRIME_LEN);
+
+        pc->digits = bn_digits(pc->m, RSA_MAX_PRIME_DIGITS);
+        pc->ddigits = bn_digits(pc->d, RSA_MAX_PRIME_DIGITS);
+        // The exponent never changes: choose its window and recode it once
+        pc->window = bn_exp_window(pc->d, pc->ddigits, pc->digits);
+        pc->windows = bn_exp_recode(pc->dwin, sizeof(pc->dwin), pc->d, pc->ddigits, pc->window);
+        if(pc->digits == 0 || (pc->m[0] & 1) == 0 || pc->windows == 0) {
+            memset((uint8_t *)ctx, 0, sizeof(*ctx));
+            return ERR_WRONG_DATA;
+        }
+
+        pc->n0inv = bn_mont_n0inv(pc->m[0]);
+        bn_mont_setup(pc->rr, pc->one, pc->m, pc->digits);
+    }
 
+    for(i=0; i<ctx->primes; i++) {
+        if(i != 1 && bn_digits(ctx->prime[i].t, RSA_MAX_PRIME_DIGITS) == 0 && derive_coefficient(ctx, i) != 0) {
+            memset((uint8_t *)ctx, 0, sizeof(*ctx));
+            return ERR_WRONG_DATA;
+        }
+    }
 
-    bn_t one[128] = { 0 };
-    bn_assign_one(one, 128);
-    uint32_t a[128] = { 12,0,3432,34243,423432,0,12312 }, modulus[512] = { 0 }, e[512] = { 0 }, d[128] = { 0 };
-    montMul(e, cq, q_rr, q, 128, qq_inv); 
-    montMul(d, e, one, q, 128, qq_inv);
+    return 0;
+}
 
+// Validate a context that did not come from rsa_key_ctx_init() in this process
+int rsa_key_ctx_check(rsa_key_ctx_t *ctx)
+{
+    rsa_prime_ctx_t *pc;
+    uint8_t dwin[RSA_MAX_PRIME_BITS / 2];
+    uint32_t i;
+    int status = 0;
 
-    //
+    if(ctx->magic != RSA_KEY_CTX_MAGIC || ctx->version != RSA_KEY_CTX_VERSION || ctx->size != sizeof(*ctx))
+        return ERR_WRONG_DATA;
+    if(ctx->primes < 2 || ctx->primes > RSA_MAX_PRIMES || ctx->bits > RSA_MAX_MODULUS_BITS)
+        return ERR_WRONG_DATA;
+    if(ctx->ndigits > RSA_MAX_MODULUS_DIGITS - 1)
+        return ERR_WRONG_DATA;
+    for(i=0; i<ctx->primes && status==0; i++) {
+        pc = &ctx->prime[i];
+        if(pc->digits == 0 || pc->digits > RSA_MAX_PRIME_DIGITS - 1 || pc->ddigits > RSA_MAX_PRIME_DIGITS - 1 ||
+           pc->window < 2 || pc->window > BN_ENGINE_MAX_WINDOW_BITS)
+            status = ERR_WRONG_DATA;
+        // Window values index the table, so they must be d's own
+        else if(pc->windows != bn_exp_recode(dwin, sizeof(dwin), pc->d, pc->ddigits, pc->window) || pc->windows == 0 ||
+           memcmp(dwin, pc->dwin, pc->windows) != 0)
+            status = ERR_WRONG_DATA;
+    }
+
+    // Clear potentially sensitive information
+    memset(dwin, 0, sizeof(dwin));
 
-    bn_mod_exp(mq, cq, dq, pdigits, q, pdigits);
-    //Bn_mod_exp(mq,cq,dq,pdigits,q,pdigits,qq_inv,q_rr);
+    return status;
+}
 
+/*
+ * One Garner step: fold m_i = m mod r_i into m, where m is currently known
+ * modulo R. m = m + R * ((m_i - m) * t_i mod r_i), after which m is known
+ * modulo R * r_i.
+ */
+static void garner_step(bn_t *m, bn_t *R, uint32_t Rdigits, bn_t *mi, bn_t *ri, bn_t *ti, uint32_t rdigits)
+{
+    bn_t h[BN_MAX_DIGITS], x[BN_MAX_DIGITS], t[2 * BN_MAX_DIGITS];
+    uint32_t digits;
 
-    if(bn_cmp(mp, mq, pdigits) >= 0) {
-        bn_sub(t, mp, mq, pdigits);
+    bn_mod(x, m, Rdigits, ri, rdigits);
+    if(bn_cmp(mi, x, rdigits) >= 0) {
+        bn_sub(h, mi, x, rdigits);
     } else {
-        bn_sub(t, mq, mp, pdigits);
-        bn_sub(t, p, t, pdigits);
+        bn_sub(h, x, mi, rdigits);
+        bn_sub(h, ri, h, rdigits);
+    }
+    bn_mod_mul(h, h, ti, ri, rdigits);
+
+    digits = Rdigits > rdigits ? Rdigits : rdigits;
+    bn_assign_zero(&h[rdigits], digits - rdigits);
+    bn_mul(t, R, h, digits);
+    bn_add(m, m, t, Rdigits + rdigits);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)h, 0, sizeof(h));
+    memset((uint8_t *)x, 0, sizeof(x));
+    memset((uint8_t *)t, 0, sizeof(t));
+}
+
+/*
+ * Prime pc as the tuned engine runs it: its own limbs and constants, or
+ * zero-extended to tune->width (e.g. 43-limb primes on the 48-limb mulx)
+ * with R^2 and R recomputed into wm, wrr and wone. x, x mod pc, is extended
+ * to match.
+ */
+static void prime_modulus(bn_modulus_t *mod, bn_t **rr, bn_t **one, bn_t *wm, bn_t *wrr, bn_t *wone,
+                          bn_t *x, rsa_prime_ctx_t *pc, const bn_tune_t *tune)
+{
+    mod->m = pc->m;
+    mod->digits = pc->digits;
+    mod->n0inv = pc->n0inv;
+    mod->cutoff = tune->cutoff;
+    mod->ninv = NULL;
+    *rr = pc->rr;
+    *one = pc->one;
+    if(tune->width > pc->digits) {
+        bn_engine_widen(mod, wm, wrr, wone, mod, pc->rr, pc->one, tune->width);
+        bn_assign_zero(&x[pc->digits], tune->width - pc->digits);
+        *rr = wrr;
+        *one = wone;
+    }
+}
+
+static int private_ctx_block(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx)
+{
+    rsa_prime_ctx_t *pc;
+    bn_modulus_t mod[2];
+    bn_exp_lane_t lane[2];
+    bn_tune_t tune;
+    uint32_t cdigits, ndigits, rdigits, Rdigits, i;
+    bn_t c[BN_MAX_DIGITS], cr[BN_MAX_DIGITS], cq[BN_MAX_DIGITS], m[RSA_MAX_PRIMES][BN_MAX_DIGITS];
+    bn_t R[2 * BN_MAX_DIGITS], t[2 * BN_MAX_DIGITS];
+    bn_t wm[2][BN_MAX_DIGITS], wrr[2][BN_MAX_DIGITS], wone[2][BN_MAX_DIGITS], *rr[2], *one[2];
+
+    ndigits = ctx->ndigits;
+
+    if(in_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_LEN;
+    bn_decode(c, BN_MAX_DIGITS, in, in_len);
+    cdigits = bn_digits(c, BN_MAX_DIGITS);
+    if(cdigits > ndigits || bn_cmp(c, ctx->n, ndigits) >= 0)
+        return ERR_WRONG_DATA;
+
+    for(i=0; i<ctx->primes; i++) {
+        pc = &ctx->prime[i];
+        bn_tune_lookup(pc->digits, &tune);
+        bn_mod(cr, c, cdigits, pc->m, pc->digits);
+        prime_modulus(&mod[0], &rr[0], &one[0], wm[0], wrr[0], wone[0], cr, pc, &tune);
+
+        // p and q of equal length run interleaved when the engine can
+        if(i == 0 && tune.engine->mul2 != NULL && ctx->prime[1].digits == pc->digits &&
+           ctx->prime[1].window == pc->window) {
+            bn_mod(cq, c, cdigits, ctx->prime[1].m, pc->digits);
+            prime_modulus(&mod[1], &rr[1], &one[1], wm[1], wrr[1], wone[1], cq, &ctx->prime[1], &tune);
+            lane[0] = (bn_exp_lane_t){ m[0], cr, pc->d, pc->ddigits, &mod[0], rr[0], one[0],
+                                       pc->dwin, pc->windows };
+            lane[1] = (bn_exp_lane_t){ m[1], cq, ctx->prime[1].d, ctx->prime[1].ddigits, &mod[1],
+                                       rr[1], one[1], ctx->prime[1].dwin, ctx->prime[1].windows };
+            bn_engine_exp2(tune.engine, pc->window, lane);
+            i++;
+            continue;
+        }
+
+        bn_engine_exp_win(tune.engine, pc->window, m[i], cr, pc->dwin, pc->windows, &mod[0], rr[0], one[0]);
     }
 
-    bn_mod_mul(t, t, q_inv, p, pdigits);
-    //print_array("t", t, sizeof(sk->prime1));
-   // montMul(mp, t, q_inv, p, pdigits, p_inv);
-    //print_array("mp", mp, sizeof(sk->prime1));
-    bn_mul(t, t, q, pdigits);
-    bn_add(t, t, mq, ndigits);
+    // Garner recombination (RFC 8017 5.1.2): start from m_2 mod q, fold in p
+    // with qInv, then each r_i with t_i
+    bn_assign_zero(t, 2 * BN_MAX_DIGITS);
+    bn_assign_zero(R, 2 * BN_MAX_DIGITS);
+    Rdigits = ctx->prime[1].digits;
+    bn_assign(t, m[1], Rdigits);
+    bn_assign(R, ctx->prime[1].m, Rdigits);
+
+    for(i=0; i<ctx->primes; i++) {
+        if(i == 1)
+            continue;
+        pc = &ctx->prime[i];
+        rdigits = pc->digits;
+        garner_step(t, R, Rdigits, m[i], pc->m, pc->t, rdigits);
+        if(i + 1 < ctx->primes) {
+            bn_assign_zero(cr, BN_MAX_DIGITS);
+            bn_assign(cr, pc->m, rdigits);
+            bn_mul(R, R, cr, Rdigits > rdigits ? Rdigits : rdigits);
+            Rdigits = bn_digits(R, ndigits);
+        }
+    }
 
-    *out_len = (sk->bits + 7) / 8;
+    *out_len = (ctx->bits + 7) / 8;
     bn_encode(out, *out_len, t, ndigits);
 
     // Clear potentially sensitive information
     memset((uint8_t *)c, 0, sizeof(c));
-    memset((uint8_t *)cp, 0, sizeof(cp));
+    memset((uint8_t *)cr, 0, sizeof(cr));
     memset((uint8_t *)cq, 0, sizeof(cq));
-    memset((uint8_t *)dp, 0, sizeof(dp));
-    memset((uint8_t *)dq, 0, sizeof(dq));
-    memset((uint8_t *)mp, 0, sizeof(mp));
-    memset((uint8_t *)mq, 0, sizeof(mq));
-    memset((uint8_t *)p, 0, sizeof(p));
-    memset((uint8_t *)q, 0, sizeof(q));
-    memset((uint8_t *)q_inv, 0, sizeof(q_inv));
+    memset((uint8_t *)m, 0, sizeof(m));
+    memset((uint8_t *)R, 0, sizeof(R));
     memset((uint8_t *)t, 0, sizeof(t));
+    memset((uint8_t *)wm, 0, sizeof(wm));
+    memset((uint8_t *)wrr, 0, sizeof(wrr));
+    memset((uint8_t *)wone, 0, sizeof(wone));
 
     return 0;
 }
@@ -271,30 +618,299 @@ void generate_rand(uint8_t *block, uint32_t block_len)
 int rsa_public_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk)
 {
     int status;
-    uint8_t byte, pkcs_block[RSA_MAX_MODULUS_LEN];
-    uint32_t i, modulus_len;
+    uint8_t pkcs_block[RSA_MAX_MODULUS_LEN];
+    uint32_t modulus_len;
+    uint64_t start;
 
     modulus_len = (pk->bits + 7) / 8;
     if(in_len + 11 > modulus_len) {//padding len
         return ERR_WRONG_LEN;
     }
 
-    pkcs_block[0] = 0;
-    pkcs_block[1] = 2;
-    for(i=2; i<modulus_len-in_len-1; i++) {
-        do {
-            generate_rand(&byte, 1);
-        } while(byte == 0);
-        pkcs_block[i] = byte;
-    }
-    pkcs_block[i++] = 0;
+    start = rsa_metrics_begin();
 
-    memcpy((uint8_t *)&pkcs_block[i], (uint8_t *)in, in_len);
+    pkcs1_pad_block_random(pkcs_block, modulus_len, in_len);
+    memcpy(&pkcs_block[modulus_len - in_len], in, in_len);
     status = public_block_operation(out, out_len, pkcs_block, modulus_len, pk);
     // Clear potentially sensitive information
-    byte = 0;
     memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
 
+    rsa_metrics_end(RSA_OP_PUBLIC_ENCRYPT, pk->bits, start);
+    return status;
+}
+
+// Position in a scatter/gather list, read or written as one byte stream
+typedef struct {
+    const struct iovec *iov;
+    uint32_t           cnt, i;
+    size_t             off;
+} iov_cursor_t;
+
+static size_t iov_total(const struct iovec *iov, uint32_t cnt)
+{
+    size_t total = 0;
+    uint32_t i;
+
+    for(i=0; i<cnt; i++)
+        total += iov[i].iov_len;
+    return total;
+}
+
+// The next len bytes in place when one segment holds all of them, else NULL
+static uint8_t *iov_span(iov_cursor_t *c, size_t len)
+{
+    uint8_t *p;
+
+    while(c->i < c->cnt && c->off == c->iov[c->i].iov_len) {
+        c->i++;
+        c->off = 0;
+    }
+    if(c->i == c->cnt || c->iov[c->i].iov_len - c->off < len)
+        return NULL;
+    p = (uint8_t *)c->iov[c->i].iov_base + c->off;
+    c->off += len;
+    return p;
+}
+
+// Gathers len bytes into buf, or scatters them from buf when to_iov is set
+static void iov_copy(iov_cursor_t *c, uint8_t *buf, size_t len, int to_iov)
+{
+    uint8_t *p;
+    size_t n;
+
+    while(len > 0) {
+        while(c->off == c->iov[c->i].iov_len) {
+            c->i++;
+            c->off = 0;
+        }
+        n = c->iov[c->i].iov_len - c->off;
+        if(n > len)
+            n = len;
+        p = (uint8_t *)c->iov[c->i].iov_base + c->off;
+        if(to_iov)
+            memcpy(p, buf, n);
+        else
+            memcpy(buf, p, n);
+        c->off += n;
+        buf += n;
+        len -= n;
+    }
+}
+
+/*
+ * Encryption for both key types: each chunk is gathered straight into its
+ * slot behind the padding, and the result is written in place when the
+ * output segment has room for the whole block.
+ */
+static int encrypt_iov(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len, const struct iovec *in, uint32_t in_cnt,
+                       uint32_t bits, rsa_key_ctx_t *ctx, rsa_pk_t *pk)
+{
+    iov_cursor_t src = { in, in_cnt, 0, 0 }, dst = { out, out_cnt, 0, 0 };
+    uint8_t pkcs_block[RSA_MAX_MODULUS_LEN], cipher[RSA_MAX_MODULUS_LEN], *c;
+    uint32_t modulus_len, chunk, len, block_len;
+    size_t left, blocks;
+    int status = 0;
+
+    *out_len = 0;
+    modulus_len = (bits + 7) / 8;
+    if(modulus_len < 12 || modulus_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_DATA;
+    chunk = modulus_len - 11;
+    left = iov_total(in, in_cnt);
+    blocks = (left + chunk - 1) / chunk;
+    if(blocks > UINT32_MAX / modulus_len || blocks * modulus_len > iov_total(out, out_cnt))
+        return ERR_WRONG_LEN;
+
+    for(; left > 0 && status == 0; left -= len) {
+        len = left > chunk ? chunk : (uint32_t)left;
+        if(ctx != NULL)
+            pkcs1_pad_block(pkcs_block, modulus_len, len);
+        else
+            pkcs1_pad_block_random(pkcs_block, modulus_len, len);
+        iov_copy(&src, &pkcs_block[modulus_len - len], len, 0);
+
+        c = iov_span(&dst, modulus_len);
+        if(ctx != NULL)
+            status = private_ctx_block(c != NULL ? c : cipher, &block_len, pkcs_block, modulus_len, ctx);
+        else
+            status = public_block_operation(c != NULL ? c : cipher, &block_len, pkcs_block, modulus_len, pk);
+        if(status == 0 && c == NULL)
+            iov_copy(&dst, cipher, modulus_len, 1);
+        if(status == 0)
+            *out_len += modulus_len;
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
+
+    return status;
+}
+
+int rsa_private_encrypt_iov_ctx(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                                const struct iovec *in, uint32_t in_cnt, rsa_key_ctx_t *ctx)
+{
+    int status;
+    uint64_t start = rsa_metrics_begin();
+
+    status = encrypt_iov(out, out_cnt, out_len, in, in_cnt, ctx->bits, ctx, NULL);
+
+    rsa_metrics_end(RSA_OP_PRIVATE_ENCRYPT_IOV, ctx->bits, start);
+    return status;
+}
+
+int rsa_public_encrypt_iov(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                           const struct iovec *in, uint32_t in_cnt, rsa_pk_t *pk)
+{
+    int status;
+    uint64_t start = rsa_metrics_begin();
+
+    status = encrypt_iov(out, out_cnt, out_len, in, in_cnt, pk->bits, NULL, pk);
+
+    rsa_metrics_end(RSA_OP_PUBLIC_ENCRYPT_IOV, pk->bits, start);
+    return status;
+}
+
+/*
+ * Ciphertext blocks contiguous in one segment are read in place. The message
+ * is scattered from its offset in the decrypted block. Block k's message
+ * never reaches past the start of block k + 1, so out may alias in.
+ */
+int rsa_private_decrypt_iov_ctx(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                                const struct iovec *in, uint32_t in_cnt, rsa_key_ctx_t *ctx)
+{
+    iov_cursor_t src = { in, in_cnt, 0, 0 }, dst = { out, out_cnt, 0, 0 };
+    uint8_t pkcs_block[RSA_MAX_MODULUS_LEN], cipher[RSA_MAX_MODULUS_LEN], *c;
+    uint32_t modulus_len, block_len, i;
+    size_t left, room;
+    int status = 0;
+    uint64_t start = rsa_metrics_begin();
+
+    *out_len = 0;
+    modulus_len = (ctx->bits + 7) / 8;
+    left = iov_total(in, in_cnt);
+    room = iov_total(out, out_cnt);
+    if(modulus_len == 0 || modulus_len > RSA_MAX_MODULUS_LEN || left % modulus_len != 0)
+        status = ERR_WRONG_LEN;
+
+    for(; left > 0 && status == 0; left -= modulus_len) {
+        if((c = iov_span(&src, modulus_len)) == NULL) {
+            iov_copy(&src, cipher, modulus_len, 0);
+            c = cipher;
+        }
+        if((status = private_ctx_block(pkcs_block, &block_len, c, modulus_len, ctx)) != 0)
+            break;
+        i = pkcs1_unpad_offset(pkcs_block, modulus_len);
+        if(modulus_len - i > room - *out_len || modulus_len - i > UINT32_MAX - *out_len) {
+            status = ERR_WRONG_LEN;
+            break;
+        }
+        iov_copy(&dst, &pkcs_block[i], modulus_len - i, 1);
+        *out_len += modulus_len - i;
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)pkcs_block, 0, sizeof(pkcs_block));
+
+    rsa_metrics_end(RSA_OP_PRIVATE_DECRYPT_IOV, ctx->bits, start);
+    return status;
+}
+
+// KDF2 (ISO/IEC 18033-2) with SHA-256: key = H(z || 1) || H(z || 2) || ...
+static void kem_kdf(uint8_t *key, uint32_t key_len, uint8_t *z, uint32_t z_len)
+{
+    sha256_t sha;
+    uint8_t counter[4], digest[SHA256_DIGEST_LEN];
+    uint32_t i, n;
+
+    for(i=1; key_len>0; i++) {
+        counter[0] = (uint8_t)(i >> 24);
+        counter[1] = (uint8_t)(i >> 16);
+        counter[2] = (uint8_t)(i >> 8);
+        counter[3] = (uint8_t)i;
+        sha256_init(&sha);
+        sha256_update(&sha, z, z_len);
+        sha256_update(&sha, counter, sizeof(counter));
+        sha256_final(&sha, digest);
+        n = key_len < SHA256_DIGEST_LEN ? key_len : SHA256_DIGEST_LEN;
+        memcpy(key, digest, n);
+        key += n;
+        key_len -= n;
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)digest, 0, sizeof(digest));
+}
+
+int rsa_kem_encapsulate(uint8_t *key, uint32_t key_len, uint8_t *out, uint32_t *out_len, rsa_pk_t *pk)
+{
+    int status = 0;
+    uint8_t z[RSA_MAX_MODULUS_LEN];
+    uint32_t modulus_len, done;
+    uint64_t start;
+    ssize_t n;
+
+    modulus_len = (pk->bits + 7) / 8;
+    if(modulus_len < 2 || modulus_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_LEN;
+
+    start = rsa_metrics_begin();
+
+    // z below n: a zero leading byte, the rest from the kernel CSPRNG
+    z[0] = 0;
+    for(done=1; done<modulus_len; done+=n) {
+        if((n = getrandom(z + done, modulus_len - done, 0)) <= 0) {
+            status = ERR_IO;
+            break;
+        }
+    }
+
+    if(status == 0)
+        status = public_block_operation(out, out_len, z, modulus_len, pk);
+    if(status == 0)
+        kem_kdf(key, key_len, z, modulus_len);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)z, 0, sizeof(z));
+
+    rsa_metrics_end(RSA_OP_KEM_ENCAPSULATE, pk->bits, start);
+    return status;
+}
+
+int rsa_kem_decapsulate_ctx(uint8_t *key, uint32_t key_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx)
+{
+    int status;
+    uint8_t z[RSA_MAX_MODULUS_LEN];
+    uint32_t z_len;
+    uint64_t start;
+
+    if(in_len != (ctx->bits + 7) / 8)
+        return ERR_WRONG_LEN;
+
+    start = rsa_metrics_begin();
+    status = private_ctx_block(z, &z_len, in, in_len, ctx);
+    if(status == 0)
+        kem_kdf(key, key_len, z, z_len);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)z, 0, sizeof(z));
+
+    rsa_metrics_end(RSA_OP_KEM_DECAPSULATE, ctx->bits, start);
+    return status;
+}
+
+int rsa_kem_decapsulate(uint8_t *key, uint32_t key_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
+{
+    int status;
+    rsa_key_ctx_t ctx;
+    uint64_t start = rsa_metrics_begin();
+
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) == 0)
+        status = rsa_kem_decapsulate_ctx(key, key_len, in, in_len, &ctx);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    rsa_metrics_end(RSA_OP_KEM_DECAPSULATE, sk->bits, start);
     return status;
 }
 
@@ -338,32 +954,35 @@ int rsa_public_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in
 
 static int public_block_operation(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk)
 {
-    uint32_t edigits, ndigits,inv;
-    bn_t c[BN_MAX_DIGITS], e[BN_MAX_DIGITS], m[BN_MAX_DIGITS], n[BN_MAX_DIGITS],rr[BN_MAX_DIGITS];
+    uint32_t edigits, ndigits;
+    bn_t c[BN_MAX_DIGITS], e[BN_MAX_DIGITS], m[BN_MAX_DIGITS], n[BN_MAX_DIGITS], rr[BN_MAX_DIGITS], one[BN_MAX_DIGITS];
+    bn_modulus_t mod;
+    bn_tune_t tune;
 
+    if(in_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_LEN;
     bn_decode(m, BN_MAX_DIGITS, in, in_len);
     bn_decode(n, BN_MAX_DIGITS, pk->modulus, RSA_MAX_MODULUS_LEN);
     bn_decode(e, BN_MAX_DIGITS, pk->exponent, RSA_MAX_MODULUS_LEN);
-    bn_decode(rr, BN_MAX_DIGITS, pk->n_rr, RSA_MAX_MODULUS_LEN);
-    
-    inv = pk->ninv;
+
     ndigits = bn_digits(n, BN_MAX_DIGITS);
     edigits = bn_digits(e, BN_MAX_DIGITS);
 
-    if(bn_cmp(m, n, ndigits) >= 0) {
+    if(ndigits == 0 || (n[0] & 1) == 0 || bn_cmp(m, n, ndigits) >= 0) {
         return ERR_WRONG_DATA;
     }
 
-    bn_t c_real[BN_MAX_DIGITS];
-    bn_decode(c_real, BN_MAX_DIGITS, c, RSA_MAX_MODULUS_LEN);
-    int si;
-    bn_mod_exp(c, m, e, edigits, n, ndigits);
-
-
-    //Bn_mod_exp(c_real,m,e,edigits,n,ndigits,inv,rr);
-
-    si = bn_cmp(c, c_real, BN_MAX_DIGITS);
-    printf("");
+    // Same per-size dispatch as the private side: a 2048-bit key runs the
+    // 64-digit kernel even when the process also serves longer keys; n and m
+    // are already zero-extended to the tuned width
+    bn_tune_lookup(ndigits, &tune);
+    mod.m = n;
+    mod.digits = tune.width;
+    mod.n0inv = bn_mont_n0inv(n[0]);
+    mod.cutoff = tune.cutoff;
+    mod.ninv = NULL;
+    bn_mont_setup(rr, one, n, tune.width);
+    bn_engine_exp_public(tune.engine, c, m, e, edigits, &mod, rr, one);
 
     *out_len = (pk->bits + 7) / 8;
     bn_encode(out, *out_len, c, ndigits);
@@ -10,16 +10,26 @@
 #define __RSA_H__
 
 #include <stdint.h>
+#include <sys/uio.h>
 
-// RSA key lengths
+// RSA key lengths; longer moduli (up to 16384 bits) need a build with a
+// larger maximum, e.g. make MAX_BITS=16384, as every context is sized by it
+#ifndef RSA_MAX_MODULUS_BITS
 #define RSA_MAX_MODULUS_BITS                4096
+#endif
 #define RSA_MAX_MODULUS_LEN                 ((RSA_MAX_MODULUS_BITS + 7) / 8)
 #define RSA_MAX_PRIME_BITS                  ((RSA_MAX_MODULUS_BITS + 1) / 2)
 #define RSA_MAX_PRIME_LEN                   ((RSA_MAX_PRIME_BITS + 7) / 8)
+#define RSA_MAX_PRIMES                      4       // multi-prime keys: u <= 4
+
+// Limb counts of the prepared key context (32-bit limbs, one spare)
+#define RSA_MAX_MODULUS_DIGITS              (RSA_MAX_MODULUS_LEN / 4 + 1)
+#define RSA_MAX_PRIME_DIGITS                (RSA_MAX_PRIME_LEN / 4 + 1)
 
 // Error codes
 #define ERR_WRONG_DATA                      0x1001
 #define ERR_WRONG_LEN                       0x1002
+#define ERR_IO                              0x1003
 
 typedef uint64_t dbn_t;
 typedef uint32_t bn_t;
@@ -31,6 +41,14 @@ typedef struct {
     uint8_t  n_rr[RSA_MAX_MODULUS_LEN];
 } rsa_pk_t;
 
+// otherPrimeInfos entry (RFC 8017 A.1.2) for the third and later primes:
+// prime r_i, exponent d_i = d mod (r_i - 1), coefficient t_i = (r_1 * ... * r_(i-1))^-1 mod r_i
+typedef struct {
+    uint8_t  prime[RSA_MAX_PRIME_LEN];
+    uint8_t  exponent[RSA_MAX_PRIME_LEN];
+    uint8_t  coefficient[RSA_MAX_PRIME_LEN];
+} rsa_prime_info_t;
+
 typedef struct {
     uint32_t bits,qinv,p_inv;
     uint8_t  modulus[RSA_MAX_MODULUS_LEN];
@@ -42,14 +60,91 @@ typedef struct {
     uint8_t  prime_exponent2[RSA_MAX_PRIME_LEN];
     uint8_t  coefficient[RSA_MAX_PRIME_LEN];
     uint8_t  q_rr[RSA_MAX_PRIME_LEN];//QRR
+    uint32_t other_primes;                                      // u - 2, 0 for two-prime keys
+    rsa_prime_info_t other_prime_info[RSA_MAX_PRIMES - 2];
 } rsa_sk_t;
 
+// Prepared key context: decoded limbs (least significant first) and all
+// Montgomery constants. It holds no pointers, so it can be written to disk,
+// memory-mapped or shared as is; magic/version/size identify the layout.
+#define RSA_KEY_CTX_MAGIC                   0x5253434B      // "RSCK"
+#define RSA_KEY_CTX_VERSION                 3
+
+typedef struct {
+    uint32_t digits, ddigits;                   // significant limbs of m and d
+    uint32_t n0inv;                             // -m^-1 mod 2^32
+    uint32_t window, windows;                   // recoding of d: window width (>= 2) and count
+    bn_t     m[RSA_MAX_PRIME_DIGITS];           // prime
+    bn_t     rr[RSA_MAX_PRIME_DIGITS];          // R^2 mod m, R = 2^(32 * digits)
+    bn_t     one[RSA_MAX_PRIME_DIGITS];         // R mod m, window table entry 0
+    bn_t     d[RSA_MAX_PRIME_DIGITS];           // CRT exponent
+    bn_t     t[RSA_MAX_PRIME_DIGITS];           // Garner coefficient (qInv for p, t_i for r_i)
+    uint8_t  dwin[RSA_MAX_PRIME_BITS / 2];      // window values of d, most significant first
+} rsa_prime_ctx_t;
+
+typedef struct {
+    uint32_t magic, version, size;              // RSA_KEY_CTX_MAGIC, RSA_KEY_CTX_VERSION, sizeof(rsa_key_ctx_t)
+    uint32_t key_id;
+    uint32_t bits, primes, ndigits, edigits;
+    bn_t     n[RSA_MAX_MODULUS_DIGITS];
+    bn_t     e[RSA_MAX_MODULUS_DIGITS];
+    rsa_prime_ctx_t prime[RSA_MAX_PRIMES];      // p, q, r_3 .. r_u
+} __attribute__((aligned(64))) rsa_key_ctx_t;
+
+// One block of a batch; status and out_len are filled in per item
+typedef struct {
+    uint8_t  *in;
+    uint32_t  in_len;
+    uint8_t  *out;
+    uint32_t  out_len;
+    int       status;
+} rsa_batch_t;
+
 int rsa_private_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
 int rsa_private_decrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+int rsa_private_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+int rsa_private_decrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+
+// Prepared contexts: rsa_key_ctx_init() does all per-key work up front
+int rsa_key_ctx_init(rsa_key_ctx_t *ctx, rsa_sk_t *sk, uint32_t key_id);
+int rsa_key_ctx_check(rsa_key_ctx_t *ctx);
+int rsa_private_encrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx);
+int rsa_private_decrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx);
+
+// Batched private operations: the key is decoded once for all count blocks.
+// Returns 0 when every item succeeded, otherwise the first failing status.
+int rsa_private_encrypt_batch(rsa_batch_t *batch, uint32_t count, rsa_sk_t *sk);
+int rsa_private_decrypt_batch(rsa_batch_t *batch, uint32_t count, rsa_sk_t *sk);
+int rsa_private_encrypt_batch_ctx(rsa_batch_t *batch, uint32_t count, rsa_key_ctx_t *ctx);
+int rsa_private_decrypt_batch_ctx(rsa_batch_t *batch, uint32_t count, rsa_key_ctx_t *ctx);
+
+/*
+ * Scatter/gather forms of the *_any_len operations. in and out are iovec
+ * arrays, as given to readv()/writev(), each read as one byte stream; blocks
+ * may straddle segments. Encryption chunks the input like *_any_len and needs
+ * room for every output block up front. Decryption takes whole ciphertext
+ * blocks and may run in place (out the same vector as in); encryption may
+ * not, since its output outgrows the input. *out_len receives the bytes
+ * written, which on failure cover the blocks completed before it.
+ */
+int rsa_private_encrypt_iov_ctx(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                                const struct iovec *in, uint32_t in_cnt, rsa_key_ctx_t *ctx);
+int rsa_private_decrypt_iov_ctx(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                                const struct iovec *in, uint32_t in_cnt, rsa_key_ctx_t *ctx);
+int rsa_public_encrypt_iov(const struct iovec *out, uint32_t out_cnt, uint32_t *out_len,
+                           const struct iovec *in, uint32_t in_cnt, rsa_pk_t *pk);
 
 void generate_rand(uint8_t *block, uint32_t block_len);
 
 int rsa_public_encrypt (uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk);
 int rsa_public_decrypt (uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk);
+int rsa_public_encrypt_any_len(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk);
+
+// RSA-KEM (ISO/IEC 18033-2): encapsulate encrypts a random z < n without
+// padding into out (modulus length) and derives key = KDF2-SHA256(z);
+// decapsulate recovers the same key_len bytes from that block
+int rsa_kem_encapsulate(uint8_t *key, uint32_t key_len, uint8_t *out, uint32_t *out_len, rsa_pk_t *pk);
+int rsa_kem_decapsulate(uint8_t *key, uint32_t key_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+int rsa_kem_decapsulate_ctx(uint8_t *key, uint32_t key_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx);
 
 #endif  // __RSA_H__
@@ -0,0 +1,229 @@
+/*****************************************************************************
+Filename    : rsa_container.c
+Date        : 2026-10-19
+Description : Indexed container of RSA-encrypted chunks: header, block index
+              and independent PKCS#1 blocks
+*****************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "rsa_container.h"
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void put64(uint8_t *p, uint64_t v)
+{
+    put32(p, (uint32_t)(v >> 32));
+    put32(p + 4, (uint32_t)v);
+}
+
+static uint64_t get64(const uint8_t *p)
+{
+    return ((uint64_t)get32(p) << 32) | get32(p + 4);
+}
+
+uint64_t rsa_container_len(uint32_t bits, uint64_t plain_len)
+{
+    uint32_t modulus_len = (bits + 7) / 8;
+    uint64_t blocks = (plain_len + modulus_len - 12) / (modulus_len - 11);
+
+    return RSA_CONTAINER_HDR_LEN + blocks * (RSA_CONTAINER_ENTRY_LEN + modulus_len);
+}
+
+int rsa_container_encrypt(uint8_t *out, uint64_t *out_len, uint8_t *in, uint64_t in_len, uint32_t key_id, rsa_pk_t *pk)
+{
+    uint8_t *index, *data;
+    uint32_t modulus_len, chunk, len, block_len, i;
+    uint64_t blocks, offset;
+    int status = 0;
+
+    modulus_len = (pk->bits + 7) / 8;
+    if(modulus_len < 12 || modulus_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_DATA;
+    chunk = modulus_len - 11;
+    blocks = (in_len + chunk - 1) / chunk;
+    if(blocks > UINT32_MAX)
+        return ERR_WRONG_LEN;
+
+    put32(out, RSA_CONTAINER_MAGIC);
+    put32(out + 4, RSA_CONTAINER_VERSION);
+    put32(out + 8, key_id);
+    put32(out + 12, pk->bits);
+    put32(out + 16, RSA_CONTAINER_PAD_PKCS1);
+    put32(out + 20, (uint32_t)blocks);
+    put64(out + 24, in_len);
+
+    index = out + RSA_CONTAINER_HDR_LEN;
+    data = index + blocks * RSA_CONTAINER_ENTRY_LEN;
+    for(i=0, offset=0; i<blocks && status==0; i++, offset+=len) {
+        len = in_len - offset > chunk ? chunk : (uint32_t)(in_len - offset);
+        put64(index + (uint64_t)i * RSA_CONTAINER_ENTRY_LEN, offset);
+        put32(index + (uint64_t)i * RSA_CONTAINER_ENTRY_LEN + 8, len);
+        status = rsa_public_encrypt(data + (uint64_t)i * modulus_len, &block_len, in + offset, len, pk);
+    }
+
+    *out_len = rsa_container_len(pk->bits, in_len);
+    return status;
+}
+
+int rsa_container_open(rsa_container_t *c, const uint8_t *buf, uint64_t len)
+{
+    uint32_t modulus_len, block_len, i;
+    uint64_t offset;
+
+    if(len < RSA_CONTAINER_HDR_LEN)
+        return ERR_WRONG_LEN;
+    if(get32(buf) != RSA_CONTAINER_MAGIC || get32(buf + 4) != RSA_CONTAINER_VERSION)
+        return ERR_WRONG_DATA;
+
+    c->key_id = get32(buf + 8);
+    c->bits = get32(buf + 12);
+    c->padding = get32(buf + 16);
+    c->blocks = get32(buf + 20);
+    c->plain_len = get64(buf + 24);
+    modulus_len = (c->bits + 7) / 8;
+    if(c->padding != RSA_CONTAINER_PAD_PKCS1 || modulus_len < 12 || modulus_len > RSA_MAX_MODULUS_LEN)
+        return ERR_WRONG_DATA;
+    if(len != RSA_CONTAINER_HDR_LEN + (uint64_t)c->blocks * (RSA_CONTAINER_ENTRY_LEN + modulus_len))
+        return ERR_WRONG_LEN;
+
+    c->index = buf + RSA_CONTAINER_HDR_LEN;
+    c->data = c->index + (uint64_t)c->blocks * RSA_CONTAINER_ENTRY_LEN;
+
+    for(i=0, offset=0; i<c->blocks; i++, offset+=block_len) {
+        block_len = get32(c->index + (uint64_t)i * RSA_CONTAINER_ENTRY_LEN + 8);
+        if(get64(c->index + (uint64_t)i * RSA_CONTAINER_ENTRY_LEN) != offset || block_len == 0 || block_len > modulus_len - 11)
+            return ERR_WRONG_DATA;
+    }
+    if(offset != c->plain_len)
+        return ERR_WRONG_DATA;
+
+    return 0;
+}
+
+void rsa_container_block(const rsa_container_t *c, uint32_t block, uint64_t *offset, uint32_t *len)
+{
+    *offset = get64(c->index + (uint64_t)block * RSA_CONTAINER_ENTRY_LEN);
+    *len = get32(c->index + (uint64_t)block * RSA_CONTAINER_ENTRY_LEN + 8);
+}
+
+// Binary search for the last block starting at or before offset
+uint32_t rsa_container_find(const rsa_container_t *c, uint64_t offset)
+{
+    uint32_t lo = 0, hi = c->blocks, mid;
+
+    while(hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if(get64(c->index + (uint64_t)mid * RSA_CONTAINER_ENTRY_LEN) <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Each block is decrypted into its own modulus-length slot first, since a
+// corrupted block may unpad to more bytes than its index entry allows
+static int decrypt_blocks(const rsa_container_t *c, uint32_t first, uint32_t count, uint8_t *out,
+                          rsa_key_ctx_t *ctx, rsa_pool_t *pool, uint32_t key)
+{
+    rsa_batch_t *batch;
+    uint8_t *plain;
+    uint32_t modulus_len = (c->bits + 7) / 8, len, i;
+    uint64_t base, offset;
+    int status;
+
+    if(first > c->blocks || count > c->blocks - first)
+        return ERR_WRONG_LEN;
+    if(count == 0)
+        return 0;
+
+    batch = malloc(count * sizeof(*batch));
+    plain = malloc((size_t)count * modulus_len);
+    if(batch == NULL || plain == NULL) {
+        free(batch);
+        free(plain);
+        return ERR_IO;
+    }
+    for(i=0; i<count; i++) {
+        batch[i].in = (uint8_t *)c->data + (uint64_t)(first + i) * modulus_len;
+        batch[i].in_len = modulus_len;
+        batch[i].out = plain + (size_t)i * modulus_len;
+    }
+
+    if(pool != NULL)
+        status = rsa_pool_run(pool, key, RSA_POOL_OP_DECRYPT, batch, count);
+    else
+        status = rsa_private_decrypt_batch_ctx(batch, count, ctx);
+
+    rsa_container_block(c, first, &base, &len);
+    for(i=0; i<count && status==0; i++) {
+        rsa_container_block(c, first + i, &offset, &len);
+        if(batch[i].out_len != len)
+            status = ERR_WRONG_DATA;
+        else
+            memcpy(out + (offset - base), batch[i].out, len);
+    }
+
+    // Clear potentially sensitive information
+    memset(plain, 0, (size_t)count * modulus_len);
+    free(plain);
+    free(batch);
+
+    return status;
+}
+
+int rsa_container_decrypt_blocks(const rsa_container_t *c, uint32_t first, uint32_t count, uint8_t *out, rsa_key_ctx_t *ctx)
+{
+    if(ctx->key_id != c->key_id || ctx->bits != c->bits)
+        return ERR_WRONG_DATA;
+    return decrypt_blocks(c, first, count, out, ctx, NULL, 0);
+}
+
+int rsa_container_decrypt_blocks_pool(const rsa_container_t *c, uint32_t first, uint32_t count, uint8_t *out,
+                                      rsa_pool_t *pool, uint32_t key)
+{
+    return decrypt_blocks(c, first, count, out, NULL, pool, key);
+}
+
+int rsa_container_decrypt_range(const rsa_container_t *c, uint64_t offset, uint64_t len, uint8_t *out, rsa_key_ctx_t *ctx)
+{
+    uint8_t *plain;
+    uint32_t first, last, last_len;
+    uint64_t base, last_offset, plain_len;
+    int status;
+
+    if(offset > c->plain_len || len > c->plain_len - offset)
+        return ERR_WRONG_LEN;
+    if(len == 0)
+        return 0;
+
+    first = rsa_container_find(c, offset);
+    last = rsa_container_find(c, offset + len - 1);
+    rsa_container_block(c, first, &base, &last_len);
+    rsa_container_block(c, last, &last_offset, &last_len);
+    plain_len = last_offset + last_len - base;
+    if((plain = malloc(plain_len)) == NULL)
+        return ERR_IO;
+
+    status = rsa_container_decrypt_blocks(c, first, last - first + 1, plain, ctx);
+    if(status == 0)
+        memcpy(out, plain + (offset - base), len);
+
+    // Clear potentially sensitive information
+    memset(plain, 0, plain_len);
+    free(plain);
+
+    return status;
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************
+Filename    : rsa_container.h
+Date        : 2026-10-19
+Description : Indexed container of RSA-encrypted chunks for parallel and
+              random-access decryption
+*****************************************************************************/
+#ifndef __RSA_CONTAINER_H__
+#define __RSA_CONTAINER_H__
+
+#include <stdint.h>
+
+#include "rsa.h"
+#include "rsa_pool.h"
+
+// Layout: a fixed 32 byte header, blocks index entries of 12 bytes, then
+// blocks ciphertexts of the modulus length each. All fields are big-endian.
+//
+//   header: magic[4] version[4] key_id[4] bits[4] padding[4] blocks[4] plain_len[8]
+//   entry : offset[8] len[4]           plaintext bytes [offset, offset + len) of the block
+//
+// Entries are contiguous: the first starts at 0 and together they cover
+// plain_len. Block i is thus found without decrypting blocks 0 .. i-1.
+#define RSA_CONTAINER_MAGIC                 0x52534354      // "RSCT"
+#define RSA_CONTAINER_VERSION               1
+#define RSA_CONTAINER_HDR_LEN               32
+#define RSA_CONTAINER_ENTRY_LEN             12
+
+// Padding modes
+#define RSA_CONTAINER_PAD_PKCS1             1               // PKCS#1 v1.5 type 2, rsa_public_encrypt
+
+// View of a container in memory, e.g. a mapped file; nothing is copied
+typedef struct {
+    uint32_t      key_id, bits, padding, blocks;
+    uint64_t      plain_len;
+    const uint8_t *index;                       // blocks entries
+    const uint8_t *data;                        // blocks ciphertexts
+} rsa_container_t;
+
+// Bytes rsa_container_encrypt() writes for plain_len bytes under a bits-bit key
+uint64_t rsa_container_len(uint32_t bits, uint64_t plain_len);
+
+// Chunks of the key's maximum PKCS#1 payload; key_id is recorded for readers
+int rsa_container_encrypt(uint8_t *out, uint64_t *out_len, uint8_t *in, uint64_t in_len, uint32_t key_id, rsa_pk_t *pk);
+
+// Checks the header and the whole index, so later lookups can trust them
+int rsa_container_open(rsa_container_t *c, const uint8_t *buf, uint64_t len);
+void rsa_container_block(const rsa_container_t *c, uint32_t block, uint64_t *offset, uint32_t *len);
+uint32_t rsa_container_find(const rsa_container_t *c, uint64_t offset);    // block holding plaintext byte offset
+
+/*
+ * Blocks first .. first+count-1 to out, which receives their plaintext,
+ * i.e. bytes [offset(first), offset(first + count)). ctx must be the key of
+ * c->key_id. The pool variant splits the range over the pool's workers;
+ * key is the pool handle of that key. A block whose plaintext length does
+ * not match its index entry fails with ERR_WRONG_DATA.
+ */
+int rsa_container_decrypt_blocks(const rsa_container_t *c, uint32_t first, uint32_t count, uint8_t *out, rsa_key_ctx_t *ctx);
+int rsa_container_decrypt_blocks_pool(const rsa_container_t *c, uint32_t first, uint32_t count, uint8_t *out,
+                                      rsa_pool_t *pool, uint32_t key);
+
+// Plaintext bytes [offset, offset + len), decrypting only the blocks that hold them
+int rsa_container_decrypt_range(const rsa_container_t *c, uint64_t offset, uint64_t len, uint8_t *out, rsa_key_ctx_t *ctx);
+
+#endif  // __RSA_CONTAINER_H__
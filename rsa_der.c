@@ -0,0 +1,364 @@
+/*****************************************************************************
+Filename    : rsa_der.c
+Date        : 2026-10-19
+Description : DER key import without allocation, and a loader that parses
+              and prepares a directory of keys on several threads
+*****************************************************************************/
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rsa_der.h"
+
+#define DER_INTEGER                         0x02
+#define DER_BIT_STRING                      0x03
+#define DER_OCTET_STRING                    0x04
+#define DER_NULL                            0x05
+#define DER_OID                             0x06
+#define DER_SEQUENCE                        0x30
+
+#define DER_NAME_LEN                        32      // "<key_id>.der" file names, with room to spare
+
+// rsaEncryption, 1.2.840.113549.1.1.1
+static const uint8_t oid_rsa[] = { 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01 };
+
+// Unread part of a DER buffer
+typedef struct {
+    const uint8_t *p, *end;
+} der_t;
+
+// Next element, which must have the given tag; body receives its contents
+static int der_next(der_t *d, uint8_t tag, der_t *body)
+{
+    uint32_t len, n, i;
+
+    if(d->end - d->p < 2 || d->p[0] != tag)
+        return ERR_WRONG_DATA;
+    len = d->p[1];
+    d->p += 2;
+    if(len & 0x80) {
+        n = len & 0x7f;
+        if(n == 0 || n > 4 || (uint32_t)(d->end - d->p) < n || d->p[0] == 0)
+            return ERR_WRONG_DATA;
+        for(i=0, len=0; i<n; i++)
+            len = (len << 8) | *d->p++;
+        if(len < 0x80)                          // DER uses the long form only when needed
+            return ERR_WRONG_DATA;
+    }
+    if((uint32_t)(d->end - d->p) < len)
+        return ERR_WRONG_DATA;
+    body->p = d->p;
+    body->end = d->p + len;
+    d->p += len;
+    return 0;
+}
+
+static int der_peek(const der_t *d, uint8_t tag)
+{
+    return d->p < d->end && d->p[0] == tag;
+}
+
+// Non-negative INTEGER, right-aligned into out[size] like the keys.h arrays
+static int der_uint(der_t *d, uint8_t *out, uint32_t size)
+{
+    der_t v;
+    uint32_t len;
+
+    if(der_next(d, DER_INTEGER, &v) != 0 || v.p == v.end || (v.p[0] & 0x80))
+        return ERR_WRONG_DATA;
+    if(v.end - v.p > 1 && v.p[0] == 0) {
+        if((v.p[1] & 0x80) == 0)
+            return ERR_WRONG_DATA;
+        v.p++;
+    }
+    len = (uint32_t)(v.end - v.p);
+    if(len > size)
+        return ERR_WRONG_DATA;
+    memset(out, 0, size - len);
+    memcpy(out + size - len, v.p, len);
+    return 0;
+}
+
+static int der_version(der_t *d, uint32_t *version)
+{
+    der_t v;
+
+    if(der_next(d, DER_INTEGER, &v) != 0 || v.end - v.p != 1 || (v.p[0] & 0x80))
+        return ERR_WRONG_DATA;
+    *version = v.p[0];
+    return 0;
+}
+
+// AlgorithmIdentifier of rsaEncryption; its NULL parameters may be left out
+static int der_rsa_algorithm(der_t *d)
+{
+    der_t alg, oid, null;
+
+    if(der_next(d, DER_SEQUENCE, &alg) != 0 || der_next(&alg, DER_OID, &oid) != 0 ||
+       oid.end - oid.p != sizeof(oid_rsa) || memcmp(oid.p, oid_rsa, sizeof(oid_rsa)) != 0)
+        return ERR_WRONG_DATA;
+    if(der_peek(&alg, DER_NULL) && (der_next(&alg, DER_NULL, &null) != 0 || null.p != null.end))
+        return ERR_WRONG_DATA;
+    return alg.p == alg.end ? 0 : ERR_WRONG_DATA;
+}
+
+static uint32_t modulus_bits(const uint8_t *m, uint32_t size)
+{
+    uint32_t i, bits;
+    uint8_t top;
+
+    for(i=0; i<size && m[i]==0; i++)
+        ;
+    if(i == size)
+        return 0;
+    bits = (size - i) * 8;
+    for(top = m[i]; (top & 0x80) == 0; top <<= 1)
+        bits--;
+    return bits;
+}
+
+// RSAPrivateKey after its version: 0 for two primes, 1 with otherPrimeInfos
+static int parse_pkcs1_private(rsa_sk_t *sk, der_t *d, uint32_t version)
+{
+    rsa_prime_info_t *pi;
+    der_t others, info;
+
+    if(version > 1)
+        return ERR_WRONG_DATA;
+    if(der_uint(d, sk->modulus, RSA_MAX_MODULUS_LEN) || der_uint(d, sk->public_exponet, RSA_MAX_MODULUS_LEN) ||
+       der_uint(d, sk->exponent, RSA_MAX_MODULUS_LEN) || der_uint(d, sk->prime1, RSA_MAX_PRIME_LEN) ||
+       der_uint(d, sk->prime2, RSA_MAX_PRIME_LEN) || der_uint(d, sk->prime_exponent1, RSA_MAX_PRIME_LEN) ||
+       der_uint(d, sk->prime_exponent2, RSA_MAX_PRIME_LEN) || der_uint(d, sk->coefficient, RSA_MAX_PRIME_LEN))
+        return ERR_WRONG_DATA;
+
+    if(version == 1) {
+        if(der_next(d, DER_SEQUENCE, &others) != 0)
+            return ERR_WRONG_DATA;
+        while(others.p != others.end) {
+            if(sk->other_primes == RSA_MAX_PRIMES - 2)
+                return ERR_WRONG_DATA;
+            pi = &sk->other_prime_info[sk->other_primes++];
+            if(der_next(&others, DER_SEQUENCE, &info) || der_uint(&info, pi->prime, RSA_MAX_PRIME_LEN) ||
+               der_uint(&info, pi->exponent, RSA_MAX_PRIME_LEN) || der_uint(&info, pi->coefficient, RSA_MAX_PRIME_LEN) ||
+               info.p != info.end)
+                return ERR_WRONG_DATA;
+        }
+        if(sk->other_primes == 0)
+            return ERR_WRONG_DATA;
+    }
+
+    if(d->p != d->end || (sk->bits = modulus_bits(sk->modulus, RSA_MAX_MODULUS_LEN)) == 0)
+        return ERR_WRONG_DATA;
+    return 0;
+}
+
+int rsa_der_parse_private(rsa_sk_t *sk, const uint8_t *der, uint32_t len)
+{
+    der_t d = { der, der + len }, key, wrapped, pkcs1;
+    uint32_t version;
+    int status;
+
+    memset(sk, 0, sizeof(*sk));
+    if(der_next(&d, DER_SEQUENCE, &key) != 0 || d.p != d.end || der_version(&key, &version) != 0)
+        return ERR_WRONG_DATA;
+
+    if(der_peek(&key, DER_SEQUENCE)) {
+        // PKCS#8 (v1, or v2 OneAsymmetricKey): the RSAPrivateKey is in an
+        // OCTET STRING; the optional attributes and public key are ignored
+        if(version > 1 || der_rsa_algorithm(&key) != 0 || der_next(&key, DER_OCTET_STRING, &wrapped) != 0 ||
+           der_next(&wrapped, DER_SEQUENCE, &pkcs1) != 0 || wrapped.p != wrapped.end ||
+           der_version(&pkcs1, &version) != 0)
+            status = ERR_WRONG_DATA;
+        else
+            status = parse_pkcs1_private(sk, &pkcs1, version);
+    } else {
+        status = parse_pkcs1_private(sk, &key, version);
+    }
+
+    // Clear potentially sensitive information
+    if(status != 0)
+        memset(sk, 0, sizeof(*sk));
+
+    return status;
+}
+
+int rsa_der_parse_public(rsa_pk_t *pk, const uint8_t *der, uint32_t len)
+{
+    der_t d = { der, der + len }, key, bits, pkcs1;
+
+    memset(pk, 0, sizeof(*pk));
+    if(der_next(&d, DER_SEQUENCE, &key) != 0 || d.p != d.end)
+        return ERR_WRONG_DATA;
+
+    if(der_peek(&key, DER_SEQUENCE)) {
+        // SubjectPublicKeyInfo: the RSAPublicKey is in a BIT STRING without unused bits
+        if(der_rsa_algorithm(&key) != 0 || der_next(&key, DER_BIT_STRING, &bits) != 0 || key.p != key.end ||
+           bits.p == bits.end || *bits.p++ != 0 || der_next(&bits, DER_SEQUENCE, &pkcs1) != 0 || bits.p != bits.end)
+            return ERR_WRONG_DATA;
+        key = pkcs1;
+    }
+
+    if(der_uint(&key, pk->modulus, RSA_MAX_MODULUS_LEN) != 0 || der_uint(&key, pk->exponent, RSA_MAX_MODULUS_LEN) != 0 ||
+       key.p != key.end || (pk->bits = modulus_bits(pk->modulus, RSA_MAX_MODULUS_LEN)) == 0) {
+        memset(pk, 0, sizeof(*pk));
+        return ERR_WRONG_DATA;
+    }
+    return 0;
+}
+
+typedef struct {
+    uint32_t key_id;
+    char     name[DER_NAME_LEN];
+} der_file_t;
+
+typedef struct {
+    int           dir;                          // directory fd for openat()
+    der_file_t    *files;
+    rsa_key_ctx_t *ctx;
+    uint32_t      count;
+    uint32_t      next;                         // next file to load, taken atomically
+    int           status;                       // first failure
+} der_job_t;
+
+static int cmp_file_id(const void *a, const void *b)
+{
+    uint32_t x = ((const der_file_t *)a)->key_id;
+    uint32_t y = ((const der_file_t *)b)->key_id;
+    return (x > y) - (x < y);
+}
+
+// Key id of a "<key_id>.der" name, or -1 for any other name
+static int64_t der_file_id(const char *name)
+{
+    uint64_t id = 0;
+    uint32_t i;
+
+    for(i=0; name[i] >= '0' && name[i] <= '9'; i++) {
+        if((id = id * 10 + (uint64_t)(name[i] - '0')) > UINT32_MAX)
+            return -1;
+    }
+    if(i == 0 || strcmp(name + i, ".der") != 0 || strlen(name) >= DER_NAME_LEN)
+        return -1;
+    return (int64_t)id;
+}
+
+static int load_file(der_job_t *job, uint32_t i)
+{
+    rsa_sk_t sk;
+    struct stat st;
+    void *map;
+    int fd, status;
+
+    if((fd = openat(job->dir, job->files[i].name, O_RDONLY)) < 0)
+        return ERR_IO;
+    if(fstat(fd, &st) != 0 || st.st_size == 0 || st.st_size > UINT32_MAX ||
+       (map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+        close(fd);
+        return ERR_IO;
+    }
+    close(fd);
+
+    status = rsa_der_parse_private(&sk, map, (uint32_t)st.st_size);
+    munmap(map, (size_t)st.st_size);
+    if(status == 0)
+        status = rsa_key_ctx_init(&job->ctx[i], &sk, job->files[i].key_id);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&sk, 0, sizeof(sk));
+
+    return status;
+}
+
+static void *load_worker(void *arg)
+{
+    der_job_t *job = arg;
+    uint32_t i;
+    int status, none = 0;
+
+    while((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->count) {
+        if((status = load_file(job, i)) != 0) {
+            __atomic_compare_exchange_n(&job->status, &none, status, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+    return NULL;
+}
+
+int rsa_der_load_dir(const char *dir, uint32_t threads, rsa_key_ctx_t **ctx, uint32_t *count)
+{
+    der_job_t job;
+    der_file_t *grown;
+    pthread_t *workers;
+    struct dirent *de;
+    DIR *d;
+    uint32_t cap = 0, started, i;
+    int64_t id;
+
+    *ctx = NULL;
+    *count = 0;
+    memset(&job, 0, sizeof(job));
+    if((d = opendir(dir)) == NULL)
+        return ERR_IO;
+
+    while((de = readdir(d)) != NULL) {
+        if((id = der_file_id(de->d_name)) < 0)
+            continue;
+        if(job.count == cap) {
+            cap = cap ? 2 * cap : 64;
+            if((grown = realloc(job.files, cap * sizeof(*grown))) == NULL) {
+                free(job.files);
+                closedir(d);
+                return ERR_IO;
+            }
+            job.files = grown;
+        }
+        job.files[job.count].key_id = (uint32_t)id;
+        strcpy(job.files[job.count].name, de->d_name);
+        job.count++;
+    }
+
+    qsort(job.files, job.count, sizeof(*job.files), cmp_file_id);
+    for(i=1; i<job.count; i++) {
+        if(job.files[i].key_id == job.files[i-1].key_id)
+            job.status = ERR_WRONG_DATA;
+    }
+    if(job.status == 0 && job.count != 0 &&
+       posix_memalign((void **)&job.ctx, 64, (size_t)job.count * sizeof(rsa_key_ctx_t)) != 0)
+        job.status = ERR_IO;
+    if(job.status != 0 || job.count == 0) {
+        free(job.files);
+        closedir(d);
+        return job.status;
+    }
+
+    // The calling thread is one of the workers
+    job.dir = dirfd(d);
+    threads = threads == 0 ? 1 : threads > job.count ? job.count : threads;
+    workers = malloc(threads * sizeof(*workers));
+    for(started=0; workers != NULL && started+1<threads; started++) {
+        if(pthread_create(&workers[started], NULL, load_worker, &job) != 0)
+            break;
+    }
+    load_worker(&job);
+    for(i=0; i<started; i++)
+        pthread_join(workers[i], NULL);
+    free(workers);
+    free(job.files);
+    closedir(d);
+
+    if(job.status != 0) {
+        // Clear potentially sensitive information
+        memset((uint8_t *)job.ctx, 0, (size_t)job.count * sizeof(rsa_key_ctx_t));
+        free(job.ctx);
+        return job.status;
+    }
+
+    *ctx = job.ctx;
+    *count = job.count;
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*****************************************************************************
+Filename    : rsa_der.h
+Date        : 2026-10-19
+Description : DER key import: PKCS#1 and PKCS#8 private keys, PKCS#1 and
+              X.509 public keys, and a parallel loader for key directories
+*****************************************************************************/
+#ifndef __RSA_DER_H__
+#define __RSA_DER_H__
+
+#include <stdint.h>
+
+#include "rsa.h"
+
+/*
+ * Parse a DER key straight into the key structure. Nothing is allocated,
+ * and der is only read, so it can be a mapped file.
+ *
+ * Private keys are PKCS#1 RSAPrivateKey (RFC 8017 A.1.2), including
+ * multi-prime keys of up to RSA_MAX_PRIMES primes, or that structure
+ * wrapped in a PKCS#8 PrivateKeyInfo for rsaEncryption. Public keys are
+ * PKCS#1 RSAPublicKey or X.509 SubjectPublicKeyInfo. The format is detected.
+ * Trailing bytes, non-minimal lengths and negative or oversized integers
+ * fail with ERR_WRONG_DATA.
+ */
+int rsa_der_parse_private(rsa_sk_t *sk, const uint8_t *der, uint32_t len);
+int rsa_der_parse_public(rsa_pk_t *pk, const uint8_t *der, uint32_t len);
+
+/*
+ * Every "<key_id>.der" private key in dir, parsed and prepared by
+ * rsa_key_ctx_init() on threads threads. *ctx receives *count contexts sorted
+ * by key id, in one allocation to release with free(). Other file names are
+ * skipped; a key that fails to parse, or a duplicate id, fails the whole call.
+ */
+int rsa_der_load_dir(const char *dir, uint32_t threads, rsa_key_ctx_t **ctx, uint32_t *count);
+
+#endif  // __RSA_DER_H__
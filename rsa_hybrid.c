@@ -0,0 +1,134 @@
+/*****************************************************************************
+Filename    : rsa_hybrid.c
+Date        : 2026-10-19
+Description : RSA-KEM + AES-256-GCM: one RSA operation per message instead
+              of one per 501 byte chunk
+*****************************************************************************/
+#include <string.h>
+
+#include "rsa_hybrid.h"
+
+// KDF output: GCM key, then IV
+#define HYBRID_SECRET_LEN                   (AES_GCM_KEY_LEN + AES_GCM_IV_LEN)
+
+int rsa_hybrid_encrypt_init(rsa_hybrid_t *h, uint8_t *header, uint32_t *header_len, rsa_pk_t *pk)
+{
+    int status;
+    uint8_t secret[HYBRID_SECRET_LEN];
+
+    status = rsa_kem_encapsulate(secret, sizeof(secret), header, header_len, pk);
+    if(status == 0)
+        aes_gcm_init(&h->gcm, secret, secret + AES_GCM_KEY_LEN, header, *header_len);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)secret, 0, sizeof(secret));
+
+    return status;
+}
+
+void rsa_hybrid_encrypt_update(rsa_hybrid_t *h, uint8_t *out, uint8_t *in, uint32_t len)
+{
+    aes_gcm_encrypt(&h->gcm, out, in, len);
+}
+
+void rsa_hybrid_encrypt_final(rsa_hybrid_t *h, uint8_t tag[AES_GCM_TAG_LEN])
+{
+    aes_gcm_tag(&h->gcm, tag);
+}
+
+int rsa_hybrid_decrypt_init_ctx(rsa_hybrid_t *h, uint8_t *header, uint32_t header_len, rsa_key_ctx_t *ctx)
+{
+    int status;
+    uint8_t secret[HYBRID_SECRET_LEN];
+
+    status = rsa_kem_decapsulate_ctx(secret, sizeof(secret), header, header_len, ctx);
+    if(status == 0)
+        aes_gcm_init(&h->gcm, secret, secret + AES_GCM_KEY_LEN, header, header_len);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)secret, 0, sizeof(secret));
+
+    return status;
+}
+
+int rsa_hybrid_decrypt_init(rsa_hybrid_t *h, uint8_t *header, uint32_t header_len, rsa_sk_t *sk)
+{
+    int status;
+    rsa_key_ctx_t ctx;
+
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) == 0)
+        status = rsa_hybrid_decrypt_init_ctx(h, header, header_len, &ctx);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    return status;
+}
+
+void rsa_hybrid_decrypt_update(rsa_hybrid_t *h, uint8_t *out, uint8_t *in, uint32_t len)
+{
+    aes_gcm_decrypt(&h->gcm, out, in, len);
+}
+
+int rsa_hybrid_decrypt_final(rsa_hybrid_t *h, uint8_t tag[AES_GCM_TAG_LEN])
+{
+    return aes_gcm_check(&h->gcm, tag) == 0 ? 0 : ERR_WRONG_DATA;
+}
+
+int rsa_hybrid_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk)
+{
+    int status;
+    rsa_hybrid_t h;
+    uint32_t header_len;
+
+    if(in_len > UINT32_MAX - RSA_HYBRID_OVERHEAD(pk->bits))
+        return ERR_WRONG_LEN;
+
+    status = rsa_hybrid_encrypt_init(&h, out, &header_len, pk);
+    if(status != 0)
+        return status;
+    rsa_hybrid_encrypt_update(&h, out + header_len, in, in_len);
+    rsa_hybrid_encrypt_final(&h, out + header_len + in_len);
+    *out_len = header_len + in_len + AES_GCM_TAG_LEN;
+
+    return 0;
+}
+
+int rsa_hybrid_decrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx)
+{
+    int status;
+    rsa_hybrid_t h;
+    uint32_t header_len, len;
+
+    header_len = (ctx->bits + 7) / 8;
+    if(in_len < header_len + AES_GCM_TAG_LEN)
+        return ERR_WRONG_LEN;
+    len = in_len - header_len - AES_GCM_TAG_LEN;
+
+    status = rsa_hybrid_decrypt_init_ctx(&h, in, header_len, ctx);
+    if(status != 0)
+        return status;
+    rsa_hybrid_decrypt_update(&h, out, in + header_len, len);
+    status = rsa_hybrid_decrypt_final(&h, in + header_len + len);
+    if(status != 0) {
+        memset(out, 0, len);
+        len = 0;
+    }
+    *out_len = len;
+
+    return status;
+}
+
+int rsa_hybrid_decrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk)
+{
+    int status;
+    rsa_key_ctx_t ctx;
+
+    if((status = rsa_key_ctx_init(&ctx, sk, 0)) == 0)
+        status = rsa_hybrid_decrypt_ctx(out, out_len, in, in_len, &ctx);
+
+    // Clear potentially sensitive information
+    memset((uint8_t *)&ctx, 0, sizeof(ctx));
+
+    return status;
+}
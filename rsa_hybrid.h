@@ -0,0 +1,43 @@
+/*****************************************************************************
+Filename    : rsa_hybrid.h
+Date        : 2026-10-19
+Description : Hybrid encryption of bulk payloads: RSA-KEM + AES-256-GCM
+*****************************************************************************/
+#ifndef __RSA_HYBRID_H__
+#define __RSA_HYBRID_H__
+
+#include <stdint.h>
+
+#include "rsa.h"
+#include "aes_gcm.h"
+
+/*
+ * Message layout: header (the RSA-KEM block, modulus length) || payload
+ * encrypted with AES-256-GCM || 16 byte tag. Key and IV are both derived
+ * from the KEM secret, which is fresh for every message; the header is the
+ * GCM additional data.
+ */
+#define RSA_HYBRID_OVERHEAD(bits)           (((bits) + 7) / 8 + AES_GCM_TAG_LEN)
+
+typedef struct {
+    aes_gcm_t gcm;
+} rsa_hybrid_t;
+
+// Streaming: init writes/reads the header, update may be called any number
+// of times, final writes/checks the tag. Decrypted output is unauthenticated
+// until rsa_hybrid_decrypt_final() returns 0.
+int rsa_hybrid_encrypt_init(rsa_hybrid_t *h, uint8_t *header, uint32_t *header_len, rsa_pk_t *pk);
+void rsa_hybrid_encrypt_update(rsa_hybrid_t *h, uint8_t *out, uint8_t *in, uint32_t len);
+void rsa_hybrid_encrypt_final(rsa_hybrid_t *h, uint8_t tag[AES_GCM_TAG_LEN]);
+int rsa_hybrid_decrypt_init(rsa_hybrid_t *h, uint8_t *header, uint32_t header_len, rsa_sk_t *sk);
+int rsa_hybrid_decrypt_init_ctx(rsa_hybrid_t *h, uint8_t *header, uint32_t header_len, rsa_key_ctx_t *ctx);
+void rsa_hybrid_decrypt_update(rsa_hybrid_t *h, uint8_t *out, uint8_t *in, uint32_t len);
+int rsa_hybrid_decrypt_final(rsa_hybrid_t *h, uint8_t tag[AES_GCM_TAG_LEN]);
+
+// One shot; out holds in_len + RSA_HYBRID_OVERHEAD(bits) bytes when encrypting.
+// On a bad tag, decrypt wipes out and returns ERR_WRONG_DATA.
+int rsa_hybrid_encrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_pk_t *pk);
+int rsa_hybrid_decrypt(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_sk_t *sk);
+int rsa_hybrid_decrypt_ctx(uint8_t *out, uint32_t *out_len, uint8_t *in, uint32_t in_len, rsa_key_ctx_t *ctx);
+
+#endif  // __RSA_HYBRID_H__
@@ -0,0 +1,347 @@
+/*****************************************************************************
+Filename    : rsa_metrics.c
+Date        : 2026-10-19
+Description : Per-thread latency histograms of the public RSA entry points
+*****************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rsa_metrics.h"
+
+typedef struct rsa_metrics_thread {
+    struct rsa_metrics_thread *next;
+    int                       in_use;           // owned by a live thread
+    rsa_histogram_t           *hist[RSA_OP_COUNT][RSA_METRICS_MAX_SIZES];
+} rsa_metrics_thread_t;
+
+static const char *op_names[RSA_OP_COUNT] = {
+    "private_encrypt", "private_decrypt",
+    "private_encrypt_ctx", "private_decrypt_ctx",
+    "private_encrypt_any_len", "private_decrypt_any_len",
+    "private_encrypt_batch", "private_decrypt_batch",
+    "private_encrypt_iov", "private_decrypt_iov",
+    "public_encrypt", "public_encrypt_any_len", "public_encrypt_iov",
+    "kem_encapsulate", "kem_decapsulate",
+};
+
+static int enabled = 1;
+static uint32_t size_bits[RSA_METRICS_MAX_SIZES];               // 0 = free slot
+static rsa_metrics_thread_t *threads;
+
+static pthread_once_t key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+
+static __thread rsa_metrics_thread_t *self;
+static __thread uint32_t depth;
+
+void rsa_metrics_enable(int on)
+{
+    __atomic_store_n(&enabled, on != 0, __ATOMIC_RELAXED);
+}
+
+int rsa_metrics_enabled(void)
+{
+    return __atomic_load_n(&enabled, __ATOMIC_RELAXED);
+}
+
+const char *rsa_metrics_op_name(int op)
+{
+    return (op >= 0 && op < RSA_OP_COUNT) ? op_names[op] : "unknown";
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t rsa_metrics_begin(void)
+{
+    uint64_t t;
+
+    if(++depth > 1 || !rsa_metrics_enabled())
+        return 0;
+    t = now_ns();
+    return t ? t : 1;
+}
+
+static uint32_t bucket_index(uint64_t ns)
+{
+    uint32_t e;
+
+    if(ns < RSA_METRICS_LINEAR)
+        return (uint32_t)ns;
+    e = 63 - (uint32_t)__builtin_clzll(ns);
+    if(e >= RSA_METRICS_MAX_EXP)
+        return RSA_METRICS_BUCKETS - 1;
+    return RSA_METRICS_LINEAR + (e - RSA_METRICS_SUB_BITS - 1) * (1u << RSA_METRICS_SUB_BITS)
+         + (uint32_t)((ns >> (e - RSA_METRICS_SUB_BITS)) & ((1u << RSA_METRICS_SUB_BITS) - 1));
+}
+
+// Highest value that falls into bucket i
+static uint64_t bucket_limit(uint32_t i)
+{
+    uint32_t k, e, sub;
+
+    if(i < RSA_METRICS_LINEAR)
+        return i;
+    k = i - RSA_METRICS_LINEAR;
+    e = RSA_METRICS_SUB_BITS + 1 + (k >> RSA_METRICS_SUB_BITS);
+    sub = k & ((1u << RSA_METRICS_SUB_BITS) - 1);
+    return ((uint64_t)((1u << RSA_METRICS_SUB_BITS) + sub + 1) << (e - RSA_METRICS_SUB_BITS)) - 1;
+}
+
+// Slot of a key size in every thread's table, claimed on first use
+static int size_slot(uint32_t bits)
+{
+    uint32_t i, cur;
+
+    for(i=0; i<RSA_METRICS_MAX_SIZES; i++) {
+        cur = __atomic_load_n(&size_bits[i], __ATOMIC_ACQUIRE);
+        if(cur == 0) {
+            if(__atomic_compare_exchange_n(&size_bits[i], &cur, bits, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                return (int)i;
+        }
+        if(cur == bits)
+            return (int)i;
+    }
+
+    return -1;
+}
+
+static void thread_exit(void *arg)
+{
+    rsa_metrics_thread_t *t = arg;
+
+    __atomic_store_n(&t->in_use, 0, __ATOMIC_RELEASE);
+}
+
+static void key_create(void)
+{
+    pthread_key_create(&key, thread_exit);
+}
+
+// Adopts the histograms of an exited thread, or registers new ones
+static rsa_metrics_thread_t *thread_attach(void)
+{
+    rsa_metrics_thread_t *t;
+    int idle;
+
+    pthread_once(&key_once, key_create);
+
+    for(t=__atomic_load_n(&threads, __ATOMIC_ACQUIRE); t; t=t->next) {
+        idle = 0;
+        if(__atomic_compare_exchange_n(&t->in_use, &idle, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+            break;
+    }
+    if(t == NULL) {
+        if((t = calloc(1, sizeof(*t))) == NULL)
+            return NULL;
+        t->in_use = 1;
+        t->next = __atomic_load_n(&threads, __ATOMIC_RELAXED);
+        while(!__atomic_compare_exchange_n(&threads, &t->next, t, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+            ;
+    }
+    pthread_setspecific(key, t);
+
+    return t;
+}
+
+void rsa_metrics_end(int op, uint32_t bits, uint64_t start)
+{
+    rsa_histogram_t *h;
+    uint64_t ns;
+    uint32_t b;
+    int slot;
+
+    depth--;
+    if(start == 0 || op < 0 || op >= RSA_OP_COUNT)
+        return;
+    ns = now_ns() - start;
+
+    if(self == NULL && (self = thread_attach()) == NULL)
+        return;
+    if((slot = size_slot(bits)) < 0)
+        return;
+    if((h = self->hist[op][slot]) == NULL) {
+        if((h = calloc(1, sizeof(*h))) == NULL)
+            return;
+        __atomic_store_n(&self->hist[op][slot], h, __ATOMIC_RELEASE);
+    }
+
+    // Single writer: plain read-modify-write, atomic only for the readers
+    b = bucket_index(ns);
+    __atomic_store_n(&h->bucket[b], h->bucket[b] + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->sum_ns, h->sum_ns + ns, __ATOMIC_RELAXED);
+    if(ns > h->max_ns)
+        __atomic_store_n(&h->max_ns, ns, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->count, h->count + 1, __ATOMIC_RELAXED);
+}
+
+int rsa_metrics_snapshot(int op, uint32_t bits, rsa_histogram_t *hist)
+{
+    rsa_metrics_thread_t *t;
+    rsa_histogram_t *h;
+    uint64_t v;
+    uint32_t i, slot;
+
+    memset(hist, 0, sizeof(*hist));
+    if(op < 0 || op >= RSA_OP_COUNT)
+        return -1;
+    for(slot=0; slot<RSA_METRICS_MAX_SIZES; slot++) {
+        if(__atomic_load_n(&size_bits[slot], __ATOMIC_ACQUIRE) == bits)
+            break;
+    }
+    if(slot == RSA_METRICS_MAX_SIZES)
+        return -1;
+
+    for(t=__atomic_load_n(&threads, __ATOMIC_ACQUIRE); t; t=t->next) {
+        if((h = __atomic_load_n(&t->hist[op][slot], __ATOMIC_ACQUIRE)) == NULL)
+            continue;
+        for(i=0; i<RSA_METRICS_BUCKETS; i++)
+            hist->bucket[i] += __atomic_load_n(&h->bucket[i], __ATOMIC_RELAXED);
+        hist->sum_ns += __atomic_load_n(&h->sum_ns, __ATOMIC_RELAXED);
+        if((v = __atomic_load_n(&h->max_ns, __ATOMIC_RELAXED)) > hist->max_ns)
+            hist->max_ns = v;
+    }
+
+    // Count from the buckets so percentiles stay consistent with it
+    for(i=0; i<RSA_METRICS_BUCKETS; i++)
+        hist->count += hist->bucket[i];
+
+    return hist->count ? 0 : -1;
+}
+
+uint64_t rsa_metrics_percentile(const rsa_histogram_t *hist, double q)
+{
+    uint64_t rank, seen = 0;
+    uint32_t i;
+
+    if(hist->count == 0)
+        return 0;
+    if(q <= 0)
+        rank = 1;
+    else if(q >= 1)
+        rank = hist->count;
+    else
+        rank = (uint64_t)(q * (double)hist->count + 0.999999);
+    if(rank == 0)
+        rank = 1;
+
+    for(i=0; i<RSA_METRICS_BUCKETS; i++) {
+        seen += hist->bucket[i];
+        if(seen >= rank)
+            break;
+    }
+    if(i == RSA_METRICS_BUCKETS)
+        return hist->max_ns;
+
+    // The bucket limit may overshoot the largest sample actually seen
+    return bucket_limit(i) < hist->max_ns ? bucket_limit(i) : hist->max_ns;
+}
+
+void rsa_metrics_reset(void)
+{
+    rsa_metrics_thread_t *t;
+    rsa_histogram_t *h;
+    uint32_t op, slot;
+
+    for(t=__atomic_load_n(&threads, __ATOMIC_ACQUIRE); t; t=t->next) {
+        for(op=0; op<RSA_OP_COUNT; op++) {
+            for(slot=0; slot<RSA_METRICS_MAX_SIZES; slot++) {
+                if((h = __atomic_load_n(&t->hist[op][slot], __ATOMIC_ACQUIRE)) != NULL)
+                    memset(h, 0, sizeof(*h));
+            }
+        }
+    }
+}
+
+static const struct {
+    double     q;
+    const char *label;
+} quantiles[] = {
+    { 0.5, "0.5" }, { 0.9, "0.9" }, { 0.99, "0.99" }, { 0.999, "0.999" },
+};
+
+#define EMIT(...) do { \
+        len = snprintf(line, sizeof(line), __VA_ARGS__); \
+        emit(arg, line, (uint32_t)len); \
+    } while(0)
+
+int rsa_metrics_export(rsa_metrics_emit_t emit, void *arg)
+{
+    rsa_histogram_t *hist;
+    char line[256];
+    uint32_t slot, bits, i;
+    int op, len;
+
+    if((hist = malloc(sizeof(*hist))) == NULL)
+        return -1;
+
+    EMIT("# HELP rsa_op_latency_seconds Latency of RSA library entry points\n");
+    EMIT("# TYPE rsa_op_latency_seconds summary\n");
+    for(op=0; op<RSA_OP_COUNT; op++) {
+        for(slot=0; slot<RSA_METRICS_MAX_SIZES; slot++) {
+            if((bits = __atomic_load_n(&size_bits[slot], __ATOMIC_ACQUIRE)) == 0)
+                break;
+            if(rsa_metrics_snapshot(op, bits, hist) != 0)
+                continue;
+            for(i=0; i<sizeof(quantiles)/sizeof(quantiles[0]); i++) {
+                EMIT("rsa_op_latency_seconds{op=\"%s\",bits=\"%u\",quantile=\"%s\"} %.9f\n",
+                     op_names[op], bits, quantiles[i].label, rsa_metrics_percentile(hist, quantiles[i].q) / 1e9);
+            }
+            EMIT("rsa_op_latency_seconds_sum{op=\"%s\",bits=\"%u\"} %.9f\n", op_names[op], bits, hist->sum_ns / 1e9);
+            EMIT("rsa_op_latency_seconds_count{op=\"%s\",bits=\"%u\"} %llu\n", op_names[op], bits, (unsigned long long)hist->count);
+        }
+    }
+
+    EMIT("# HELP rsa_op_latency_max_seconds Slowest call of each RSA library entry point\n");
+    EMIT("# TYPE rsa_op_latency_max_seconds gauge\n");
+    for(op=0; op<RSA_OP_COUNT; op++) {
+        for(slot=0; slot<RSA_METRICS_MAX_SIZES; slot++) {
+            if((bits = __atomic_load_n(&size_bits[slot], __ATOMIC_ACQUIRE)) == 0)
+                break;
+            if(rsa_metrics_snapshot(op, bits, hist) != 0)
+                continue;
+            EMIT("rsa_op_latency_max_seconds{op=\"%s\",bits=\"%u\"} %.9f\n", op_names[op], bits, hist->max_ns / 1e9);
+        }
+    }
+
+    free(hist);
+
+    return 0;
+}
+
+static void write_line(void *arg, const char *line, uint32_t len)
+{
+    fwrite(line, 1, len, (FILE *)arg);
+}
+
+int rsa_metrics_write(const char *path)
+{
+    char tmp[4096];
+    FILE *fp;
+    int status;
+
+    if(snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp))
+        return -1;
+    if((fp = fopen(tmp, "w")) == NULL)
+        return -1;
+
+    status = rsa_metrics_export(write_line, fp);
+    if(ferror(fp))
+        status = -1;
+    if(fclose(fp) != 0)
+        status = -1;
+    if(status == 0 && rename(tmp, path) != 0)
+        status = -1;
+    if(status != 0)
+        remove(tmp);
+
+    return status;
+}
@@ -0,0 +1,84 @@
+/*****************************************************************************
+Filename    : rsa_metrics.h
+Date        : 2026-10-19
+Description : Per-thread latency histograms of the public RSA entry points
+*****************************************************************************/
+#ifndef __RSA_METRICS_H__
+#define __RSA_METRICS_H__
+
+#include <stdint.h>
+
+// Operations; every public entry point of rsa.c records under one of these
+enum {
+    RSA_OP_PRIVATE_ENCRYPT,
+    RSA_OP_PRIVATE_DECRYPT,
+    RSA_OP_PRIVATE_ENCRYPT_CTX,
+    RSA_OP_PRIVATE_DECRYPT_CTX,
+    RSA_OP_PRIVATE_ENCRYPT_ANY_LEN,
+    RSA_OP_PRIVATE_DECRYPT_ANY_LEN,
+    RSA_OP_PRIVATE_ENCRYPT_BATCH,
+    RSA_OP_PRIVATE_DECRYPT_BATCH,
+    RSA_OP_PRIVATE_ENCRYPT_IOV,
+    RSA_OP_PRIVATE_DECRYPT_IOV,
+    RSA_OP_PUBLIC_ENCRYPT,
+    RSA_OP_PUBLIC_ENCRYPT_ANY_LEN,
+    RSA_OP_PUBLIC_ENCRYPT_IOV,
+    RSA_OP_KEM_ENCAPSULATE,
+    RSA_OP_KEM_DECAPSULATE,
+    RSA_OP_COUNT
+};
+
+#define RSA_METRICS_MAX_SIZES               8       // distinct key sizes tracked
+
+/*
+ * Log-linear buckets in nanoseconds: exact below 32 ns, then 16 sub-buckets
+ * per power of two up to 2^40 ns (about 18 minutes), so any reported value
+ * is within 1/16 of the true one. Longer samples land in the last bucket.
+ */
+#define RSA_METRICS_SUB_BITS                4
+#define RSA_METRICS_LINEAR                  (2u << RSA_METRICS_SUB_BITS)
+#define RSA_METRICS_MAX_EXP                 40
+#define RSA_METRICS_BUCKETS                 (RSA_METRICS_LINEAR + (RSA_METRICS_MAX_EXP - RSA_METRICS_SUB_BITS - 1) * (1u << RSA_METRICS_SUB_BITS))
+
+typedef struct {
+    uint64_t count, sum_ns, max_ns;
+    uint64_t bucket[RSA_METRICS_BUCKETS];
+} rsa_histogram_t;
+
+/*
+ * Each thread records into its own histograms, allocated on its first sample
+ * of an (operation, key size) pair, so the hot path takes no lock and shares
+ * no cache line with other threads. Only the outermost entry point of a call
+ * is recorded: a batch counts once, not once per block. Batches record the
+ * whole call; divide by the batch size for a per-block figure.
+ *
+ * Readers merge all threads on demand. Histograms of threads that have exited
+ * are kept and reused by later threads, so no samples are lost.
+ */
+void rsa_metrics_enable(int on);                                // on by default
+int rsa_metrics_enabled(void);
+
+// Hooks used by rsa.c: start is 0 when the sample is not to be recorded
+uint64_t rsa_metrics_begin(void);
+void rsa_metrics_end(int op, uint32_t bits, uint64_t start);
+
+// Merged view of one operation and key size; -1 if nothing was recorded
+int rsa_metrics_snapshot(int op, uint32_t bits, rsa_histogram_t *hist);
+uint64_t rsa_metrics_percentile(const rsa_histogram_t *hist, double q);    // ns, q in [0, 1]
+const char *rsa_metrics_op_name(int op);
+
+// Zeroes all histograms; samples recorded concurrently may be lost
+void rsa_metrics_reset(void);
+
+/*
+ * Prometheus text exposition format: one summary, rsa_op_latency_seconds,
+ * labelled with op and bits, giving quantiles 0.5, 0.9, 0.99 and 0.999
+ * plus _sum and _count, and a rsa_op_latency_max_seconds gauge.
+ * emit receives one complete line (with its newline) at a time.
+ */
+typedef void (*rsa_metrics_emit_t)(void *arg, const char *line, uint32_t len);
+
+int rsa_metrics_export(rsa_metrics_emit_t emit, void *arg);
+int rsa_metrics_write(const char *path);                        // via a temporary file and rename
+
+#endif  // __RSA_METRICS_H__
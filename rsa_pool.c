@@ -0,0 +1,443 @@
+/*****************************************************************************
+Filename    : rsa_pool.c
+Date        : 2026-10-19
+Description : NUMA-aware worker pool. One job queue per node; jobs go to a
+              node with idle workers and idle workers steal from other
+              nodes, always running on their own node's key replica.
+*****************************************************************************/
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "rsa_pool.h"
+
+typedef struct {
+    uint32_t        id;                         // kernel node number
+    cpu_set_t       cpus;                       // allowed CPUs of this node
+    uint32_t        ncpus;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    rsa_pool_job_t  *head, *tail;
+    uint32_t        idle;
+    rsa_key_ctx_t   **replica;                  // [max_keys], allocated on this node
+} pool_node_t;
+
+typedef struct {
+    rsa_pool_t *pool;
+    uint32_t   node;
+    int        cpu;
+    pthread_t  thread;
+} pool_worker_t;
+
+struct rsa_pool {
+    pool_node_t   *node;
+    uint32_t      nnodes;
+    pool_worker_t *worker;
+    uint32_t      nworkers;
+    uint32_t      max_keys, nkeys;
+    uint32_t      next_node;
+    int           stop;
+};
+
+/*
+ * Topology
+ */
+static int parse_cpulist(const char *s, cpu_set_t *set)
+{
+    char *end;
+    long a, b;
+
+    CPU_ZERO(set);
+    while(*s && *s != '\n') {
+        a = strtol(s, &end, 10);
+        if(end == s)
+            return -1;
+        b = a;
+        s = end;
+        if(*s == '-') {
+            b = strtol(s + 1, &end, 10);
+            s = end;
+        }
+        for(; a <= b && a < CPU_SETSIZE; a++)
+            CPU_SET(a, set);
+        if(*s == ',')
+            s++;
+    }
+    return 0;
+}
+
+static uint32_t detect_nodes(pool_node_t **out)
+{
+    char path[300], line[4096];
+    pool_node_t *node = NULL, *tmp;
+    uint32_t n = 0, id;
+    cpu_set_t allowed, cpus;
+    struct dirent *de;
+    DIR *dir;
+    FILE *f;
+
+    CPU_ZERO(&allowed);
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        CPU_SET(0, &allowed);
+
+    if((dir = opendir("/sys/devices/system/node")) != NULL) {
+        while((de = readdir(dir)) != NULL) {
+            if(sscanf(de->d_name, "node%u", &id) != 1)
+                continue;
+            snprintf(path, sizeof(path), "/sys/devices/system/node/%s/cpulist", de->d_name);
+            if((f = fopen(path, "r")) == NULL)
+                continue;
+            if(fgets(line, sizeof(line), f) && parse_cpulist(line, &cpus) == 0) {
+                // Memory-only nodes and nodes outside our affinity get no workers
+                CPU_AND(&cpus, &cpus, &allowed);
+                if(CPU_COUNT(&cpus) && (tmp = realloc(node, (n + 1) * sizeof(*node))) != NULL) {
+                    node = tmp;
+                    memset(&node[n], 0, sizeof(node[n]));
+                    node[n].id = id;
+                    node[n].cpus = cpus;
+                    node[n].ncpus = (uint32_t)CPU_COUNT(&cpus);
+                    n++;
+                }
+            }
+            fclose(f);
+        }
+        closedir(dir);
+    }
+
+    // No NUMA information: one node with every allowed CPU
+    if(n == 0 && (node = calloc(1, sizeof(*node))) != NULL) {
+        node[0].cpus = allowed;
+        node[0].ncpus = (uint32_t)CPU_COUNT(&allowed);
+        n = 1;
+    }
+
+    *out = node;
+    return n;
+}
+
+// The k-th allowed CPU of a node, wrapping around
+static int node_cpu(pool_node_t *node, uint32_t k)
+{
+    int cpu;
+
+    k %= node->ncpus;
+    for(cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if(CPU_ISSET(cpu, &node->cpus) && k-- == 0)
+            return cpu;
+    }
+    return 0;
+}
+
+/*
+ * Workers
+ */
+static rsa_pool_job_t *node_pop(pool_node_t *node)
+{
+    rsa_pool_job_t *job = node->head;
+
+    if(job) {
+        node->head = job->next;
+        if(node->head == NULL)
+            node->tail = NULL;
+    }
+    return job;
+}
+
+static rsa_pool_job_t *steal(rsa_pool_t *pool, uint32_t self)
+{
+    rsa_pool_job_t *job = NULL;
+    uint32_t i, k;
+
+    for(i=1; i<pool->nnodes && job == NULL; i++) {
+        k = (self + i) % pool->nnodes;
+        pthread_mutex_lock(&pool->node[k].lock);
+        job = node_pop(&pool->node[k]);
+        pthread_mutex_unlock(&pool->node[k].lock);
+    }
+    return job;
+}
+
+static void run_job(rsa_pool_t *pool, pool_node_t *node, rsa_pool_job_t *job)
+{
+    rsa_key_ctx_t *ctx;
+    uint32_t i;
+
+    if(job->key >= __atomic_load_n(&pool->nkeys, __ATOMIC_ACQUIRE)) {
+        for(i=0; i<job->count; i++)
+            job->batch[i].status = ERR_WRONG_DATA;
+        job->status = ERR_WRONG_DATA;
+    } else {
+        ctx = node->replica[job->key];
+        if(job->op == RSA_POOL_OP_DECRYPT)
+            job->status = rsa_private_decrypt_batch_ctx(job->batch, job->count, ctx);
+        else
+            job->status = rsa_private_encrypt_batch_ctx(job->batch, job->count, ctx);
+    }
+
+    if(job->done)
+        job->done(job, job->arg);
+}
+
+static void *worker_main(void *arg)
+{
+    pool_worker_t *w = arg;
+    rsa_pool_t *pool = w->pool;
+    pool_node_t *node = &pool->node[w->node];
+    rsa_pool_job_t *job;
+    cpu_set_t set;
+    int stop;
+
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+
+    for(;;) {
+        pthread_mutex_lock(&node->lock);
+        job = node_pop(node);
+        stop = pool->stop;
+        pthread_mutex_unlock(&node->lock);
+        if(job == NULL && stop)
+            break;
+
+        if(job == NULL && (job = steal(pool, w->node)) == NULL) {
+            pthread_mutex_lock(&node->lock);
+            if(node->head == NULL && !pool->stop) {
+                __atomic_add_fetch(&node->idle, 1, __ATOMIC_RELAXED);
+                pthread_cond_wait(&node->cond, &node->lock);
+                __atomic_sub_fetch(&node->idle, 1, __ATOMIC_RELAXED);
+            }
+            pthread_mutex_unlock(&node->lock);
+            continue;
+        }
+
+        run_job(pool, node, job);
+    }
+
+    return NULL;
+}
+
+/*
+ * Pool
+ */
+static void free_replica(rsa_key_ctx_t *ctx)
+{
+    // Clear potentially sensitive information
+    memset((uint8_t *)ctx, 0, sizeof(*ctx));
+    munmap(ctx, sizeof(*ctx));
+}
+
+rsa_pool_t *rsa_pool_create(uint32_t max_keys, uint32_t threads_per_node)
+{
+    rsa_pool_t *pool;
+    uint32_t i, j, n, total = 0;
+
+    if((pool = calloc(1, sizeof(*pool))) == NULL)
+        return NULL;
+    pool->max_keys = max_keys;
+    if((pool->nnodes = detect_nodes(&pool->node)) == 0) {
+        free(pool);
+        return NULL;
+    }
+
+    for(i=0; i<pool->nnodes; i++) {
+        pthread_mutex_init(&pool->node[i].lock, NULL);
+        pthread_cond_init(&pool->node[i].cond, NULL);
+        pool->node[i].replica = calloc(max_keys ? max_keys : 1, sizeof(rsa_key_ctx_t *));
+        if(pool->node[i].replica == NULL)
+            pool->stop = 1;
+        total += threads_per_node ? threads_per_node : pool->node[i].ncpus;
+    }
+    pool->worker = calloc(total, sizeof(*pool->worker));
+    if(pool->worker == NULL || pool->stop) {
+        rsa_pool_destroy(pool);
+        return NULL;
+    }
+
+    for(i=0; i<pool->nnodes; i++) {
+        n = threads_per_node ? threads_per_node : pool->node[i].ncpus;
+        for(j=0; j<n; j++) {
+            pool_worker_t *w = &pool->worker[pool->nworkers];
+            w->pool = pool;
+            w->node = i;
+            w->cpu = node_cpu(&pool->node[i], j);
+            if(pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+                rsa_pool_destroy(pool);
+                return NULL;
+            }
+            pool->nworkers++;
+        }
+    }
+
+    return pool;
+}
+
+void rsa_pool_destroy(rsa_pool_t *pool)
+{
+    uint32_t i, k;
+
+    for(i=0; i<pool->nnodes; i++) {
+        pthread_mutex_lock(&pool->node[i].lock);
+        pool->stop = 1;
+        pthread_cond_broadcast(&pool->node[i].cond);
+        pthread_mutex_unlock(&pool->node[i].lock);
+    }
+    for(i=0; i<pool->nworkers; i++)
+        pthread_join(pool->worker[i].thread, NULL);
+
+    for(i=0; i<pool->nnodes; i++) {
+        for(k=0; pool->node[i].replica && k<pool->nkeys; k++)
+            free_replica(pool->node[i].replica[k]);
+        free(pool->node[i].replica);
+        pthread_mutex_destroy(&pool->node[i].lock);
+        pthread_cond_destroy(&pool->node[i].cond);
+    }
+    free(pool->worker);
+    free(pool->node);
+    free(pool);
+}
+
+/*
+ * Each replica is a fresh anonymous mapping written while the calling thread
+ * runs on that node, so first-touch places its pages in local memory.
+ * Not thread-safe against other rsa_pool_add_key() calls.
+ */
+int rsa_pool_add_key(rsa_pool_t *pool, rsa_key_ctx_t *ctx, uint32_t *key)
+{
+    rsa_key_ctx_t *r;
+    cpu_set_t saved;
+    uint32_t i, k = pool->nkeys;
+    int status;
+
+    if((status = rsa_key_ctx_check(ctx)) != 0)
+        return status;
+    if(k >= pool->max_keys)
+        return ERR_WRONG_DATA;
+
+    sched_getaffinity(0, sizeof(saved), &saved);
+    for(i=0; i<pool->nnodes; i++) {
+        sched_setaffinity(0, sizeof(pool->node[i].cpus), &pool->node[i].cpus);
+        r = mmap(NULL, sizeof(*r), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(r == MAP_FAILED) {
+            while(i--)
+                free_replica(pool->node[i].replica[k]);
+            sched_setaffinity(0, sizeof(saved), &saved);
+            return ERR_IO;
+        }
+        memcpy(r, ctx, sizeof(*r));
+        pool->node[i].replica[k] = r;
+    }
+    sched_setaffinity(0, sizeof(saved), &saved);
+
+    *key = k;
+    __atomic_store_n(&pool->nkeys, k + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+int rsa_pool_submit(rsa_pool_t *pool, rsa_pool_job_t *job)
+{
+    pool_node_t *node;
+    uint32_t i, pick;
+
+    if(job->node >= 0 && (uint32_t)job->node < pool->nnodes)
+        pick = (uint32_t)job->node;
+    else
+        pick = __atomic_fetch_add(&pool->next_node, 1, __ATOMIC_RELAXED) % pool->nnodes;
+
+    // Prefer a node that has a worker waiting; the idle counts are only a hint
+    if(__atomic_load_n(&pool->node[pick].idle, __ATOMIC_RELAXED) == 0) {
+        for(i=1; i<pool->nnodes; i++) {
+            if(__atomic_load_n(&pool->node[(pick + i) % pool->nnodes].idle, __ATOMIC_RELAXED)) {
+                pick = (pick + i) % pool->nnodes;
+                break;
+            }
+        }
+    }
+
+    node = &pool->node[pick];
+    job->next = NULL;
+    pthread_mutex_lock(&node->lock);
+    if(node->tail) node->tail->next = job;
+    else           node->head = job;
+    node->tail = job;
+    pthread_cond_signal(&node->cond);
+    pthread_mutex_unlock(&node->lock);
+
+    return 0;
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint32_t        remaining;
+} pool_wait_t;
+
+static void run_done(rsa_pool_job_t *job, void *arg)
+{
+    pool_wait_t *wait = arg;
+
+    (void)job;
+    pthread_mutex_lock(&wait->lock);
+    if(--wait->remaining == 0)
+        pthread_cond_signal(&wait->cond);
+    pthread_mutex_unlock(&wait->lock);
+}
+
+int rsa_pool_run(rsa_pool_t *pool, uint32_t key, int op, rsa_batch_t *batch, uint32_t count)
+{
+    rsa_pool_job_t *jobs;
+    pool_wait_t wait;
+    uint32_t i, n, chunk;
+    int status = 0;
+
+    if(count == 0)
+        return 0;
+    n = pool->nworkers < count ? pool->nworkers : count;
+    chunk = (count + n - 1) / n;
+    n = (count + chunk - 1) / chunk;
+    if((jobs = calloc(n, sizeof(*jobs))) == NULL)
+        return ERR_IO;
+
+    pthread_mutex_init(&wait.lock, NULL);
+    pthread_cond_init(&wait.cond, NULL);
+    wait.remaining = n;
+
+    for(i=0; i<n; i++) {
+        jobs[i].key = key;
+        jobs[i].op = op;
+        jobs[i].batch = batch + i * chunk;
+        jobs[i].count = (i == n - 1) ? count - i * chunk : chunk;
+        jobs[i].node = (int)(i % pool->nnodes);
+        jobs[i].done = run_done;
+        jobs[i].arg = &wait;
+        rsa_pool_submit(pool, &jobs[i]);
+    }
+
+    pthread_mutex_lock(&wait.lock);
+    while(wait.remaining)
+        pthread_cond_wait(&wait.cond, &wait.lock);
+    pthread_mutex_unlock(&wait.lock);
+
+    for(i=0; i<n && status == 0; i++)
+        status = jobs[i].status;
+
+    pthread_mutex_destroy(&wait.lock);
+    pthread_cond_destroy(&wait.cond);
+    free(jobs);
+
+    return status;
+}
+
+uint32_t rsa_pool_nodes(rsa_pool_t *pool)
+{
+    return pool->nnodes;
+}
+
+uint32_t rsa_pool_workers(rsa_pool_t *pool)
+{
+    return pool->nworkers;
+}
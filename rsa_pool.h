@@ -0,0 +1,52 @@
+/*****************************************************************************
+Filename    : rsa_pool.h
+Date        : 2026-10-19
+Description : NUMA-aware worker pool for private key operations
+*****************************************************************************/
+#ifndef __RSA_POOL_H__
+#define __RSA_POOL_H__
+
+#include <stdint.h>
+
+#include "rsa.h"
+
+#define RSA_POOL_OP_DECRYPT                 1       // rsa_private_decrypt
+#define RSA_POOL_OP_ENCRYPT                 2       // rsa_private_encrypt (sign)
+
+typedef struct rsa_pool rsa_pool_t;
+
+// A batch for one key. status and every batch[i] are filled in before done()
+// is called on a worker thread.
+typedef struct rsa_pool_job {
+    uint32_t     key;                           // handle from rsa_pool_add_key()
+    int          op;
+    rsa_batch_t  *batch;
+    uint32_t     count;
+    int          node;                          // preferred NUMA node index, -1 for any
+    int          status;
+    void         (*done)(struct rsa_pool_job *job, void *arg);
+    void         *arg;
+    struct rsa_pool_job *next;
+} rsa_pool_job_t;
+
+/*
+ * Workers are grouped by NUMA node (from /sys/devices/system/node, limited to
+ * the CPUs this process may run on) and each is pinned to one CPU. Every key
+ * added is copied into memory first touched on each node, so a worker reads
+ * only its own node's replica. All bignum scratch lives on worker stacks,
+ * which are likewise touched only by their pinned thread.
+ * threads_per_node 0 starts one worker per CPU.
+ */
+rsa_pool_t *rsa_pool_create(uint32_t max_keys, uint32_t threads_per_node);
+void rsa_pool_destroy(rsa_pool_t *pool);
+
+int rsa_pool_add_key(rsa_pool_t *pool, rsa_key_ctx_t *ctx, uint32_t *key);    // *key = handle for jobs
+int rsa_pool_submit(rsa_pool_t *pool, rsa_pool_job_t *job);
+
+// Splits batch over the workers and waits; returns 0 or the first failing status
+int rsa_pool_run(rsa_pool_t *pool, uint32_t key, int op, rsa_batch_t *batch, uint32_t count);
+
+uint32_t rsa_pool_nodes(rsa_pool_t *pool);
+uint32_t rsa_pool_workers(rsa_pool_t *pool);
+
+#endif  // __RSA_POOL_H__
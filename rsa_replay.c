@@ -0,0 +1,463 @@
+/*****************************************************************************
+Filename    : rsa_replay.c
+Date        : 2026-10-19
+Description : Workload replay for the rsa.h API. Reads a trace of (time, op,
+              key id, payload size) records and issues them open-loop at the
+              recorded or a scaled rate on N threads, reporting throughput,
+              queueing delay and tail latency per op and key size. -g writes
+              a synthetic trace instead.
+*****************************************************************************/
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rsa.h"
+#include "rsa_der.h"
+#include "bignum.h"
+#include "keys.h"
+#include "keys_load.h"
+#include "keys_ctx.h"
+
+enum { OP_ENCRYPT, OP_DECRYPT, OP_SIGN, OP_COUNT };
+
+static const char *op_names[OP_COUNT] = { "encrypt", "decrypt", "sign" };
+
+typedef struct {
+    rsa_key_ctx_t *ctx;
+    rsa_pk_t      pk;
+} replay_key_t;
+
+typedef struct {
+    double        at;                       // seconds after the first record
+    uint32_t      op, len;
+    replay_key_t  *key;
+    uint8_t       *cipher;                  // decrypt: ciphertext of plain[0..len)
+    uint32_t      cipher_len;
+    double        queue, service;           // seconds, filled in by the replay
+    int           status;
+} record_t;
+
+static replay_key_t *keys;
+static uint32_t nkeys;
+static record_t *records;
+static uint32_t nrecords;
+static uint8_t *plain;                      // payload source, max_len random bytes
+static uint32_t max_len, max_out;
+static double speed = 1, start;
+static uint32_t next;                       // next record to issue, taken atomically
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void sleep_until(double t)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)t;
+    ts.tv_nsec = (long)((t - ts.tv_sec) * 1e9);
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+/*
+ * Keys from a directory of "<key_id>.der" files, or else the built-in ones:
+ * id 0 is key_m (4096 bits), 1 the 2048-bit and 2 the 3072-bit key. The
+ * public halves are encoded back from the prepared contexts.
+ */
+static int load_keys(const char *dir, uint32_t threads)
+{
+    static rsa_sk_t sk[2];
+    rsa_key_ctx_t *ctx;
+    uint32_t i;
+    int status;
+
+    if(dir != NULL) {
+        if((status = rsa_der_load_dir(dir, threads, &ctx, &nkeys)) != 0)
+            return status;
+        if(nkeys == 0)
+            return ERR_WRONG_DATA;
+    } else {
+        nkeys = 3;
+        if(posix_memalign((void **)&ctx, 64, nkeys * sizeof(*ctx)) != 0)
+            return ERR_IO;
+        ctx[0] = key_ctx;
+        KEY_LOAD_SK(sk[0], key_2048, KEY_2048_BITS);
+        KEY_LOAD_SK(sk[1], key_3072, KEY_3072_BITS);
+        status = rsa_key_ctx_init(&ctx[1], &sk[0], 1);
+        if(status == 0)
+            status = rsa_key_ctx_init(&ctx[2], &sk[1], 2);
+
+        // Clear potentially sensitive information
+        memset((uint8_t *)sk, 0, sizeof(sk));
+
+        if(status != 0)
+            return status;
+    }
+
+    if((keys = calloc(nkeys, sizeof(*keys))) == NULL)
+        return ERR_IO;
+    for(i=0; i<nkeys; i++) {
+        keys[i].ctx = &ctx[i];
+        keys[i].pk.bits = ctx[i].bits;
+        bn_encode(keys[i].pk.modulus, RSA_MAX_MODULUS_LEN, ctx[i].n, ctx[i].ndigits);
+        bn_encode(keys[i].pk.exponent, RSA_MAX_MODULUS_LEN, ctx[i].e, ctx[i].edigits);
+    }
+    return 0;
+}
+
+static int cmp_key_id(const void *id, const void *key)
+{
+    uint32_t x = *(const uint32_t *)id, y = ((const replay_key_t *)key)->ctx->key_id;
+    return (x > y) - (x < y);
+}
+
+static int cmp_record_at(const void *a, const void *b)
+{
+    double x = ((const record_t *)a)->at, y = ((const record_t *)b)->at;
+    return (x > y) - (x < y);
+}
+
+// Decrypt records of the same key and size share one ciphertext
+static int cmp_record_input(const void *a, const void *b)
+{
+    const record_t *x = *(record_t * const *)a, *y = *(record_t * const *)b;
+
+    if(x->key != y->key)
+        return x->key < y->key ? -1 : 1;
+    return (x->len > y->len) - (x->len < y->len);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t encrypted_len(const replay_key_t *key, uint32_t len)
+{
+    uint32_t modulus_len = (key->pk.bits + 7) / 8;
+    return (len + modulus_len - 12) / (modulus_len - 11) * modulus_len;
+}
+
+/*
+ * One record per line: "<seconds> <encrypt|decrypt|sign> <key_id> <bytes>".
+ * Times may be absolute (e.g. epoch seconds from a log) and in any order.
+ * Blank lines and lines starting with '#' are skipped.
+ */
+static int load_trace(const char *path)
+{
+    FILE *f;
+    record_t *grown, *rec;
+    char line[256], name[16];
+    uint32_t cap = 0, line_no = 0, key_id, len, op, i;
+    double at;
+
+    if((f = fopen(path, "r")) == NULL) {
+        perror(path);
+        return ERR_IO;
+    }
+    while(fgets(line, sizeof(line), f) != NULL) {
+        line_no++;
+        if(line[strspn(line, " \t\r\n")] == '\0' || line[0] == '#')
+            continue;
+        if(sscanf(line, "%lf %15s %u %u", &at, name, &key_id, &len) != 4) {
+            fprintf(stderr, "%s:%u: malformed record\n", path, line_no);
+            fclose(f);
+            return ERR_WRONG_DATA;
+        }
+        for(op=0; op<OP_COUNT && strcmp(name, op_names[op]) != 0; op++)
+            ;
+        if(nrecords == cap) {
+            cap = cap ? 2 * cap : 1024;
+            if((grown = realloc(records, cap * sizeof(*grown))) == NULL) {
+                fclose(f);
+                return ERR_IO;
+            }
+            records = grown;
+        }
+        rec = &records[nrecords];
+        memset(rec, 0, sizeof(*rec));
+        rec->at = at;
+        rec->op = op;
+        rec->len = len;
+        rec->key = bsearch(&key_id, keys, nkeys, sizeof(*keys), cmp_key_id);
+        if(op == OP_COUNT || rec->key == NULL || rec->len == 0 || rec->len > (1u << 24)) {
+            fprintf(stderr, "%s:%u: unknown op or key id, or bad payload size\n", path, line_no);
+            fclose(f);
+            return ERR_WRONG_DATA;
+        }
+        nrecords++;
+    }
+    fclose(f);
+    if(nrecords == 0) {
+        fprintf(stderr, "%s: no records\n", path);
+        return ERR_WRONG_DATA;
+    }
+
+    qsort(records, nrecords, sizeof(*records), cmp_record_at);
+    for(i=nrecords; i-->0; )
+        records[i].at -= records[0].at;
+
+    // Buffer sizes: payload source and the largest output of any record
+    for(i=0; i<nrecords; i++) {
+        rec = &records[i];
+        if(rec->len > max_len)
+            max_len = rec->len;
+        if(encrypted_len(rec->key, rec->len) > max_out)
+            max_out = encrypted_len(rec->key, rec->len);
+    }
+    return 0;
+}
+
+// Ciphertexts for the decrypt records, made before the clock starts
+static int prepare_inputs(void)
+{
+    record_t **dec, *prev = NULL;
+    struct iovec in, out;
+    uint32_t n = 0, i;
+    int status = 0;
+
+    if((plain = malloc(max_len)) == NULL || (dec = malloc(nrecords * sizeof(*dec))) == NULL)
+        return ERR_IO;
+    generate_rand(plain, max_len);
+    for(i=0; i<nrecords; i++) {
+        if(records[i].op == OP_DECRYPT)
+            dec[n++] = &records[i];
+    }
+    qsort(dec, n, sizeof(*dec), cmp_record_input);
+
+    for(i=0; i<n && status==0; i++) {
+        if(prev != NULL && cmp_record_input(&prev, &dec[i]) == 0) {
+            dec[i]->cipher = prev->cipher;
+            dec[i]->cipher_len = prev->cipher_len;
+            continue;
+        }
+        prev = dec[i];
+        if((prev->cipher = malloc(encrypted_len(prev->key, prev->len))) == NULL) {
+            status = ERR_IO;
+            break;
+        }
+        in.iov_base = plain;
+        in.iov_len = prev->len;
+        out.iov_base = prev->cipher;
+        out.iov_len = encrypted_len(prev->key, prev->len);
+        status = rsa_public_encrypt_iov(&out, 1, &prev->cipher_len, &in, 1, &prev->key->pk);
+    }
+
+    free(dec);
+    return status;
+}
+
+static int run_record(record_t *rec, uint8_t *out)
+{
+    struct iovec in, dst;
+    uint32_t out_len;
+    int status;
+
+    in.iov_base = rec->op == OP_DECRYPT ? rec->cipher : plain;
+    in.iov_len = rec->op == OP_DECRYPT ? rec->cipher_len : rec->len;
+    dst.iov_base = out;
+    dst.iov_len = max_out;
+
+    if(rec->op == OP_ENCRYPT)
+        return rsa_public_encrypt_iov(&dst, 1, &out_len, &in, 1, &rec->key->pk);
+    if(rec->op == OP_SIGN)
+        return rsa_private_encrypt_iov_ctx(&dst, 1, &out_len, &in, 1, rec->key->ctx);
+
+    status = rsa_private_decrypt_iov_ctx(&dst, 1, &out_len, &in, 1, rec->key->ctx);
+    if(status == 0 && (out_len != rec->len || memcmp(out, plain, rec->len) != 0))
+        status = ERR_WRONG_DATA;
+    return status;
+}
+
+/*
+ * Open loop: a record is due at start + at / speed whether or not earlier
+ * ones have finished, so when every thread is busy the wait shows up as
+ * queueing delay instead of silently lowering the offered rate.
+ */
+static void *replay_worker(void *arg)
+{
+    record_t *rec;
+    uint8_t *out;
+    double due, begin;
+    uint32_t i;
+
+    (void)arg;
+    if((out = malloc(max_out)) == NULL)
+        return NULL;
+    while((i = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED)) < nrecords) {
+        rec = &records[i];
+        if(speed > 0) {
+            due = start + rec->at / speed;
+            sleep_until(due);
+            begin = now();
+        } else {
+            due = begin = now();
+        }
+        rec->status = run_record(rec, out);
+        rec->service = now() - begin;
+        rec->queue = begin - due;
+    }
+    free(out);
+    return NULL;
+}
+
+static double percentile(const double *sorted, uint32_t n, double q)
+{
+    uint32_t i = (uint32_t)(n * q);
+    return sorted[i < n ? i : n - 1];
+}
+
+// One report line for the records of op (OP_COUNT: all) and bits (0: all)
+static void report(uint32_t op, uint32_t bits, double elapsed)
+{
+    double *lat, *queue;
+    char size[12];
+    uint32_t n = 0, errors = 0, i;
+
+    lat = malloc(nrecords * sizeof(*lat));
+    queue = malloc(nrecords * sizeof(*queue));
+    for(i=0; lat != NULL && queue != NULL && i<nrecords; i++) {
+        if((op != OP_COUNT && records[i].op != op) || (bits != 0 && records[i].key->pk.bits != bits))
+            continue;
+        lat[n] = records[i].queue + records[i].service;
+        queue[n++] = records[i].queue;
+        errors += records[i].status != 0;
+    }
+    if(n != 0) {
+        qsort(lat, n, sizeof(*lat), cmp_double);
+        qsort(queue, n, sizeof(*queue), cmp_double);
+        if(bits != 0)
+            snprintf(size, sizeof(size), "%u", bits);
+        printf("%-8s %5s %8u %9.1f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %6u\n",
+               op == OP_COUNT ? "all" : op_names[op], bits != 0 ? size : "", n, n / elapsed,
+               percentile(queue, n, 0.5) * 1e3, percentile(queue, n, 0.99) * 1e3,
+               percentile(lat, n, 0.5) * 1e3, percentile(lat, n, 0.99) * 1e3,
+               percentile(lat, n, 0.999) * 1e3, lat[n - 1] * 1e3, errors);
+    }
+    free(lat);
+    free(queue);
+}
+
+/*
+ * Synthetic trace: Poisson arrivals at rate per second; 50% encrypt, 35%
+ * decrypt, 15% sign; keys skewed towards the first ones; payloads mostly
+ * 32-byte session keys, some short messages and a tail of multi-block
+ * payloads up to 4 KB.
+ */
+static void generate(uint32_t count, double rate, long seed)
+{
+    double at = 0, u;
+    uint32_t op, key, len, i;
+
+    srand48(seed);
+    printf("# seconds op key_id payload_bytes\n");
+    for(i=0; i<count; i++) {
+        at += -log(1 - drand48()) / rate;
+        u = drand48();
+        op = u < 0.5 ? OP_ENCRYPT : u < 0.85 ? OP_DECRYPT : OP_SIGN;
+        u = drand48();
+        key = (uint32_t)(nkeys * u * u);
+        u = drand48();
+        len = u < 0.6 ? 32 : u < 0.9 ? 16 + (uint32_t)(lrand48() % 240) : 256 + (uint32_t)(lrand48() % 3841);
+        printf("%.6f %s %u %u\n", at, op_names[op], keys[key].ctx->key_id, len);
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-k key_dir] [-t threads] [-s speed] trace\n"
+                    "       %s [-k key_dir] -g records [-r rate] [-S seed] > trace\n"
+                    "speed scales the recorded rate; 0 issues records as fast as the threads allow\n",
+            prog, prog);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *dir = NULL;
+    pthread_t *threads;
+    double elapsed, rate = 100;
+    uint32_t sizes[16], nsizes = 0, nthreads = 4, gen = 0, errors = 0, started, op, bits, i, j;
+    long seed = 1;
+    int opt, status;
+
+    while((opt = getopt(argc, argv, "k:t:s:g:r:S:h")) != -1) {
+        switch(opt) {
+        case 'k': dir = optarg;                             break;
+        case 't': nthreads = (uint32_t)atoi(optarg);        break;
+        case 's': speed = atof(optarg);                     break;
+        case 'g': gen = (uint32_t)atoi(optarg);             break;
+        case 'r': rate = atof(optarg);                      break;
+        case 'S': seed = atol(optarg);                      break;
+        default:  usage(argv[0]);                           return 1;
+        }
+    }
+    if(nthreads == 0) nthreads = 1;
+    if((gen == 0 && optind != argc - 1) || rate <= 0 || speed < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if((status = load_keys(dir, nthreads)) != 0) {
+        fprintf(stderr, "rsa_replay: cannot load keys (%x)\n", status);
+        return 1;
+    }
+    if(gen != 0) {
+        generate(gen, rate, seed);
+        return 0;
+    }
+    if(load_trace(argv[optind]) != 0 || prepare_inputs() != 0) {
+        fprintf(stderr, "rsa_replay: cannot prepare the replay\n");
+        return 1;
+    }
+
+    if((threads = calloc(nthreads, sizeof(*threads))) == NULL)
+        return 1;
+    start = now() + 0.01;                   // every thread is waiting before the first record
+    for(started=0; started<nthreads; started++) {
+        if(pthread_create(&threads[started], NULL, replay_worker, NULL) != 0)
+            break;
+    }
+    if(started == 0)
+        return 1;
+    for(i=0; i<started; i++)
+        pthread_join(threads[i], NULL);
+    elapsed = now() - start;
+
+    for(i=0; i<nrecords; i++)
+        errors += records[i].status != 0;
+    printf("%u records on %u threads in %.3f s, trace %.3f s at speed %g: offered %.1f/s, achieved %.1f/s, %u errors\n",
+           nrecords, started, elapsed, records[nrecords - 1].at, speed,
+           speed > 0 && records[nrecords - 1].at > 0 ? nrecords * speed / records[nrecords - 1].at : 0,
+           nrecords / elapsed, errors);
+    printf("%-8s %5s %8s %9s %9s %9s %9s %9s %9s %9s %6s\n", "op", "bits", "count", "ops/s",
+           "queue p50", "p99", "lat p50", "p99", "p999", "max", "errors");
+
+    // Per op and key size, the distinct sizes in ascending order
+    for(i=0; i<nkeys; i++) {
+        bits = keys[i].pk.bits;
+        for(j=0; j<nsizes && sizes[j] < bits; j++)
+            ;
+        if((j < nsizes && sizes[j] == bits) || nsizes == sizeof(sizes) / sizeof(sizes[0]))
+            continue;
+        memmove(&sizes[j + 1], &sizes[j], (nsizes++ - j) * sizeof(sizes[0]));
+        sizes[j] = bits;
+    }
+    for(op=0; op<OP_COUNT; op++) {
+        for(i=0; i<nsizes; i++)
+            report(op, sizes[i], elapsed);
+    }
+    report(OP_COUNT, 0, elapsed);
+
+    free(threads);
+    return errors ? 1 : 0;
+}
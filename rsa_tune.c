@@ -0,0 +1,60 @@
+/*****************************************************************************
+Filename    : rsa_tune.c
+Date        : 2026-10-19
+Description : Benchmarks the bignum engines on this host for the modulus
+              sizes used by RSA private keys and writes the tuning file.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bn_engine.h"
+
+#define RSA_TUNE_DEFAULT_PATH       "rsa_tune.conf"
+
+// Prime sizes in digits: 2048-bit two-prime, 4096-bit four-/three-prime,
+// 3072-bit two-prime and 4096-bit two-prime keys
+static uint32_t default_sizes[] = { 32, 43, 48, 64 };
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-o file] [digits ...]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = RSA_TUNE_DEFAULT_PATH;
+    bn_tune_t tune;
+    uint32_t i, n, digits;
+    int opt;
+
+    while((opt = getopt(argc, argv, "o:h")) != -1) {
+        switch(opt) {
+        case 'o': path = optarg;                        break;
+        default:  usage(argv[0]);                       return 1;
+        }
+    }
+
+    // Keep entries for other sizes from an earlier run on this host
+    bn_tune_load(path);
+
+    n = optind < argc ? (uint32_t)(argc - optind) : sizeof(default_sizes) / sizeof(default_sizes[0]);
+    for(i=0; i<n; i++) {
+        digits = optind < argc ? (uint32_t)atoi(argv[optind + i]) : default_sizes[i];
+        if(bn_tune_run(digits, &tune) != 0) {
+            fprintf(stderr, "rsa_tune: cannot tune %u digits\n", digits);
+            return 1;
+        }
+        printf("%4u digits (%4u bits): engine %-8s width %4u karatsuba cutoff %u\n",
+               digits, digits * BN_DIGIT_BITS, tune.engine->name, tune.width, tune.cutoff);
+    }
+
+    if(bn_tune_save(path) != 0) {
+        fprintf(stderr, "rsa_tune: cannot write %s\n", path);
+        return 1;
+    }
+    printf("written to %s\n", path);
+
+    return 0;
+}
@@ -0,0 +1,634 @@
+/*****************************************************************************
+Filename    : rsad.c
+Date        : 2026-10-19
+Description : RSA offload daemon. Keys are loaded once; decrypt and sign
+              requests arrive over a Unix domain socket, are coalesced into
+              batches for the worker threads and answered asynchronously.
+*****************************************************************************/
+#define _GNU_SOURCE                         // struct ucred
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "rsa.h"
+#include "rsad.h"
+#include "keys_ctx.h"
+#include "keystore.h"
+#include "bn_engine.h"
+#include "rsa_metrics.h"
+
+#define RSAD_MAX_CONNS              256
+#define RSAD_MAX_KEYS               16
+#define RSAD_MAX_BATCH              64
+#define RSAD_METRICS_INTERVAL       10      // seconds between metrics file rewrites
+
+// Backpressure: a connection is not read while it has RSAD_MAX_INFLIGHT_CONN
+// jobs in flight or RSAD_MAX_WBACKLOG unsent reply bytes, nor is any while the
+// daemon has RSAD_MAX_INFLIGHT jobs; one that lets its replies reach
+// RSAD_MAX_WBUF is closed
+#define RSAD_MAX_INFLIGHT_CONN      64
+#define RSAD_MAX_INFLIGHT           1024
+#define RSAD_MAX_WBACKLOG           (64 * 1024)
+#define RSAD_MAX_WBUF               (1024 * 1024)
+
+typedef struct job_s {
+    struct job_s *next;
+    uint32_t   conn, gen;                   // owning connection slot and generation
+    rsad_hdr_t hdr;
+    uint8_t    in[RSA_MAX_MODULUS_LEN];
+    uint8_t    out[RSA_MAX_MODULUS_LEN];
+} job_t;
+
+typedef struct {
+    int      fd;
+    uint32_t gen;
+    uint8_t  rbuf[RSAD_HDR_LEN + RSAD_MAX_PAYLOAD];
+    uint32_t rlen;
+    uint8_t  *wbuf;
+    uint32_t wlen, woff, wcap;
+    uint32_t inflight;                      // jobs queued or running, not yet replied to
+} conn_t;
+
+typedef struct {
+    job_t *head, *tail;
+    uint32_t count;
+} job_list_t;
+
+// keys[i] serves wire key index i; either the builtin key or records of a mapped store
+static rsa_key_ctx_t *keys[RSAD_MAX_KEYS];
+static rsa_keystore_t store;
+static const char *store_path;
+static const char *tune_path;
+static const char *metrics_path;            // Prometheus textfile, e.g. for node_exporter
+
+static conn_t conns[RSAD_MAX_CONNS];
+
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  queue_cond = PTHREAD_COND_INITIALIZER;
+static job_list_t pending, done;
+static int wake_pipe[2];
+
+static uint32_t batch_max = 16;
+static uint32_t batch_window_us = 200;
+static volatile sig_atomic_t stop;
+
+static uint64_t stat_requests, stat_batches;
+static uint32_t inflight;                   // all jobs allocated; main thread only
+
+static void job_list_push(job_list_t *l, job_t *j)
+{
+    j->next = NULL;
+    if(l->tail) l->tail->next = j;
+    else        l->head = j;
+    l->tail = j;
+    l->count++;
+}
+
+static void job_free(job_t *j)
+{
+    // Clear potentially sensitive information
+    memset((uint8_t *)j, 0, sizeof(*j));
+    free(j);
+}
+
+static int load_keys(void)
+{
+    uint32_t i, found = 0;
+    int status;
+
+    if(store_path) {
+        if((status = rsa_keystore_open(&store, store_path)) != 0)
+            return status;
+        for(i=0; i<RSAD_MAX_KEYS; i++) {
+            if((keys[i] = rsa_keystore_find(&store, i)) != NULL)
+                found++;
+        }
+        printf("rsad: %u of %u keys in %s are served\n", found, store.count, store_path);
+        return 0;
+    }
+
+    // Prepared at build time from keys.h
+    keys[0] = &key_ctx;
+
+    return 0;
+}
+
+/*
+ * Reuse the tuning file when it was written on this CPU model, otherwise
+ * benchmark every prime size of the served keys and rewrite it.
+ */
+static void load_tuning(void)
+{
+    bn_tune_t tune;
+    uint32_t sizes[BN_TUNE_MAX_SIZES], count = 0, digits, i, j, k;
+
+    if(bn_tune_load(tune_path) == 0)
+        return;
+
+    for(i=0; i<RSAD_MAX_KEYS; i++) {
+        for(j=0; keys[i] && j<keys[i]->primes; j++) {
+            digits = keys[i]->prime[j].digits;
+            for(k=0; k<count && sizes[k] != digits; k++)
+                ;
+            if(k < count || count == BN_TUNE_MAX_SIZES || bn_tune_run(digits, &tune) != 0)
+                continue;
+            sizes[count++] = digits;
+            printf("rsad: %u digits: engine %s at %u\n", tune.digits, tune.engine->name, tune.width);
+        }
+    }
+    if(bn_tune_save(tune_path) != 0)
+        fprintf(stderr, "rsad: cannot write %s\n", tune_path);
+}
+
+/*
+ * Take the oldest pending job plus up to batch_max-1 more for the same
+ * operation and key. Called with queue_lock held.
+ */
+static uint32_t take_batch(job_t **batch)
+{
+    job_t *j, *prev, *first;
+    uint32_t n = 0;
+
+    first = pending.head;
+    pending.head = first->next;
+    if(pending.head == NULL) pending.tail = NULL;
+    pending.count--;
+    batch[n++] = first;
+
+    prev = NULL;
+    j = pending.head;
+    while(j && n < batch_max) {
+        job_t *next = j->next;
+        if(j->hdr.op == first->hdr.op && j->hdr.key == first->hdr.key) {
+            if(prev) prev->next = next;
+            else     pending.head = next;
+            if(pending.tail == j) pending.tail = prev;
+            pending.count--;
+            batch[n++] = j;
+        } else {
+            prev = j;
+        }
+        j = next;
+    }
+
+    return n;
+}
+
+static void *worker_main(void *arg)
+{
+    job_t *jobs[RSAD_MAX_BATCH];
+    rsa_batch_t batch[RSAD_MAX_BATCH];
+    struct timespec deadline;
+    uint32_t i, n;
+    uint8_t one = 1;
+
+    (void)arg;
+    for(;;) {
+        pthread_mutex_lock(&queue_lock);
+        while(pending.count == 0 && !stop)
+            pthread_cond_wait(&queue_cond, &queue_lock);
+        if(stop) {
+            pthread_mutex_unlock(&queue_lock);
+            break;
+        }
+
+        // Give concurrent clients a short window to fill the batch
+        if(pending.count < batch_max && batch_window_us) {
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += (long)batch_window_us * 1000;
+            deadline.tv_sec += deadline.tv_nsec / 1000000000;
+            deadline.tv_nsec %= 1000000000;
+            while(pending.count && pending.count < batch_max && !stop) {
+                if(pthread_cond_timedwait(&queue_cond, &queue_lock, &deadline) == ETIMEDOUT)
+                    break;
+            }
+            if(pending.count == 0 || stop) {
+                pthread_mutex_unlock(&queue_lock);
+                continue;
+            }
+        }
+
+        n = take_batch(jobs);
+        pthread_mutex_unlock(&queue_lock);
+
+        for(i=0; i<n; i++) {
+            batch[i].in = jobs[i]->in;
+            batch[i].in_len = jobs[i]->hdr.len;
+            batch[i].out = jobs[i]->out;
+            batch[i].out_len = 0;
+            batch[i].status = 0;
+        }
+
+        if(jobs[0]->hdr.op == RSAD_OP_DECRYPT)
+            rsa_private_decrypt_batch_ctx(batch, n, keys[jobs[0]->hdr.key]);
+        else
+            rsa_private_encrypt_batch_ctx(batch, n, keys[jobs[0]->hdr.key]);
+
+        pthread_mutex_lock(&queue_lock);
+        for(i=0; i<n; i++) {
+            jobs[i]->hdr.status = (uint16_t)batch[i].status;
+            jobs[i]->hdr.len = batch[i].status ? 0 : batch[i].out_len;
+            job_list_push(&done, jobs[i]);
+        }
+        stat_batches++;
+        stat_requests += n;
+        pthread_mutex_unlock(&queue_lock);
+
+        if(write(wake_pipe[1], &one, 1) < 0 && errno != EAGAIN)
+            perror("rsad: wake");
+    }
+
+    return NULL;
+}
+
+static void conn_close(uint32_t slot)
+{
+    conn_t *c = &conns[slot];
+
+    close(c->fd);
+    free(c->wbuf);
+    memset((uint8_t *)c->rbuf, 0, sizeof(c->rbuf));
+    c->fd = -1;
+    c->gen++;
+    c->rlen = 0;
+    c->wbuf = NULL;
+    c->wlen = c->woff = c->wcap = 0;
+    c->inflight = 0;
+}
+
+static int conn_busy(const conn_t *c)
+{
+    return c->inflight >= RSAD_MAX_INFLIGHT_CONN || c->wlen - c->woff >= RSAD_MAX_WBACKLOG ||
+           inflight >= RSAD_MAX_INFLIGHT;
+}
+
+static int conn_reply(conn_t *c, rsad_hdr_t *hdr, uint8_t *payload)
+{
+    uint32_t need = RSAD_HDR_LEN + hdr->len;
+
+    if(c->woff && c->woff == c->wlen)
+        c->woff = c->wlen = 0;
+    if(c->wlen - c->woff + need > RSAD_MAX_WBUF)
+        return -1;
+    if(c->wlen + need > c->wcap) {
+        uint32_t cap = c->wcap ? c->wcap : 4096;
+        uint8_t *p;
+        while(cap < c->wlen + need) cap *= 2;
+        if((p = realloc(c->wbuf, cap)) == NULL)
+            return -1;
+        c->wbuf = p;
+        c->wcap = cap;
+    }
+
+    rsad_hdr_encode(c->wbuf + c->wlen, hdr);
+    if(hdr->len)
+        memcpy(c->wbuf + c->wlen + RSAD_HDR_LEN, payload, hdr->len);
+    c->wlen += need;
+
+    return 0;
+}
+
+// Parse complete frames in the read buffer until the connection is busy;
+// returns -1 on a protocol error
+static int conn_parse(uint32_t slot)
+{
+    conn_t *c = &conns[slot];
+    uint32_t off = 0, queued = 0;
+    rsad_hdr_t hdr;
+    job_t *j;
+
+    while(c->rlen - off >= RSAD_HDR_LEN && !conn_busy(c)) {
+        rsad_hdr_decode(&hdr, c->rbuf + off);
+        if(hdr.len > RSAD_MAX_PAYLOAD)
+            return -1;
+        if(c->rlen - off < RSAD_HDR_LEN + hdr.len)
+            break;
+
+        hdr.status = 0;
+        if(hdr.op != RSAD_OP_DECRYPT && hdr.op != RSAD_OP_SIGN)
+            hdr.status = RSAD_ERR_BAD_OP;
+        else if(hdr.key >= RSAD_MAX_KEYS || keys[hdr.key] == NULL)
+            hdr.status = RSAD_ERR_BAD_KEY;
+        else if(hdr.len == 0 || hdr.len > RSA_MAX_MODULUS_LEN)
+            hdr.status = RSAD_ERR_BAD_LEN;
+
+        if(hdr.status) {
+            hdr.len = 0;
+            if(conn_reply(c, &hdr, NULL) != 0)
+                return -1;
+        } else {
+            if((j = malloc(sizeof(*j))) == NULL)
+                return -1;
+            j->conn = slot;
+            j->gen = c->gen;
+            j->hdr = hdr;
+            memcpy(j->in, c->rbuf + off + RSAD_HDR_LEN, hdr.len);
+            pthread_mutex_lock(&queue_lock);
+            job_list_push(&pending, j);
+            pthread_mutex_unlock(&queue_lock);
+            c->inflight++;
+            inflight++;
+            queued++;
+        }
+        off += RSAD_HDR_LEN + hdr.len;
+    }
+
+    if(queued)
+        pthread_cond_broadcast(&queue_cond);
+
+    memmove(c->rbuf, c->rbuf + off, c->rlen - off);
+    c->rlen -= off;
+
+    return 0;
+}
+
+static void deliver_done(void)
+{
+    job_t *j, *next;
+    uint8_t drain[64];
+
+    while(read(wake_pipe[0], drain, sizeof(drain)) > 0)
+        ;
+
+    pthread_mutex_lock(&queue_lock);
+    j = done.head;
+    done.head = done.tail = NULL;
+    done.count = 0;
+    pthread_mutex_unlock(&queue_lock);
+
+    for(; j; j = next) {
+        conn_t *c = &conns[j->conn];
+        next = j->next;
+        inflight--;
+        // The client may have gone away while its request was in flight
+        if(c->fd >= 0 && c->gen == j->gen) {
+            c->inflight--;
+            if(conn_reply(c, &j->hdr, j->out) != 0)
+                conn_close(j->conn);
+        }
+        job_free(j);
+    }
+}
+
+// The default socket directory must be ours and closed to everyone else;
+// a /tmp fallback someone else created first is refused, not reused
+static int private_dir(const char *dir)
+{
+    struct stat st;
+
+    if(mkdir(dir, 0700) < 0 && errno != EEXIST)
+        return -1;
+    if(lstat(dir, &st) < 0)
+        return -1;
+    if(!S_ISDIR(st.st_mode) || st.st_uid != geteuid() || (st.st_mode & 077) != 0) {
+        errno = EACCES;
+        return -1;
+    }
+    return 0;
+}
+
+// The socket is created 0600 so only the daemon's user can connect, and
+// paths that do not fit in sun_path are refused rather than truncated
+static int listen_unix(const char *path)
+{
+    struct sockaddr_un addr;
+    struct stat st;
+    mode_t mask;
+    int fd, r;
+
+    if(strlen(path) >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    // Only a stale socket is replaced, never some other file
+    if(lstat(path, &st) == 0 && !S_ISSOCK(st.st_mode)) {
+        errno = EEXIST;
+        return -1;
+    }
+    if((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        return -1;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path, strlen(path));
+    unlink(path);
+
+    mask = umask(077);
+    r = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(mask);
+    if(r < 0 || listen(fd, 128) < 0) {
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+
+    return fd;
+}
+
+// Peers must run as the daemon's user, whatever the socket's mode
+static int peer_allowed(int fd)
+{
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+
+    if(getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0)
+        return 0;
+    return cred.uid == geteuid();
+}
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-s socket] [-k keystore] [-T tunefile] [-t threads] [-b batch] [-w window_us] [-m metrics_file]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    char dir[RSAD_PATH_MAX], default_path[RSAD_PATH_MAX];
+    const char *path = NULL;
+    struct pollfd pfd[RSAD_MAX_CONNS + 2];
+    uint32_t slots[RSAD_MAX_CONNS + 2];
+    pthread_t *workers;
+    uint32_t i, nfds, threads = 1;
+    time_t metrics_due = 0;
+    int lfd, opt;
+    ssize_t r;
+
+    while((opt = getopt(argc, argv, "s:k:T:t:b:w:m:h")) != -1) {
+        switch(opt) {
+        case 's': path = optarg;                        break;
+        case 'k': store_path = optarg;                  break;
+        case 'T': tune_path = optarg;                   break;
+        case 't': threads = (uint32_t)atoi(optarg);     break;
+        case 'b': batch_max = (uint32_t)atoi(optarg);   break;
+        case 'w': batch_window_us = (uint32_t)atoi(optarg); break;
+        case 'm': metrics_path = optarg;                break;
+        default:  usage(argv[0]);                       return 1;
+        }
+    }
+    if(path == NULL) {
+        if(rsad_default_path(dir, default_path) != 0 || private_dir(dir) != 0) {
+            perror("rsad: socket directory");
+            return 1;
+        }
+        path = default_path;
+    }
+    if(threads == 0) threads = 1;
+    if(batch_max == 0) batch_max = 1;
+    if(batch_max > RSAD_MAX_BATCH) batch_max = RSAD_MAX_BATCH;
+
+    if(load_keys() != 0) {
+        fprintf(stderr, "rsad: cannot load keys\n");
+        return 1;
+    }
+    if(tune_path)
+        load_tuning();
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    if(pipe(wake_pipe) < 0) {
+        perror("rsad: pipe");
+        return 1;
+    }
+    fcntl(wake_pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wake_pipe[1], F_SETFL, O_NONBLOCK);
+
+    if((lfd = listen_unix(path)) < 0) {
+        perror("rsad: listen");
+        return 1;
+    }
+    for(i=0; i<RSAD_MAX_CONNS; i++)
+        conns[i].fd = -1;
+
+    workers = calloc(threads, sizeof(*workers));
+    for(i=0; i<threads; i++)
+        pthread_create(&workers[i], NULL, worker_main, NULL);
+
+    printf("rsad: listening on %s, %u worker(s), batch %u, window %uus\n", path, threads, batch_max, batch_window_us);
+    fflush(stdout);
+
+    while(!stop) {
+        nfds = 0;
+        pfd[nfds].fd = lfd;          pfd[nfds].events = POLLIN; nfds++;
+        pfd[nfds].fd = wake_pipe[0]; pfd[nfds].events = POLLIN; nfds++;
+        for(i=0; i<RSAD_MAX_CONNS; i++) {
+            // Frames left unparsed while the connection was busy
+            if(conns[i].fd >= 0 && conns[i].rlen >= RSAD_HDR_LEN && !conn_busy(&conns[i]) && conn_parse(i) != 0)
+                conn_close(i);
+            if(conns[i].fd < 0) continue;
+            pfd[nfds].fd = conns[i].fd;
+            pfd[nfds].events = (conn_busy(&conns[i]) ? 0 : POLLIN) | (conns[i].woff < conns[i].wlen ? POLLOUT : 0);
+            slots[nfds] = i;
+            nfds++;
+        }
+
+        if(metrics_path && time(NULL) >= metrics_due) {
+            if(rsa_metrics_write(metrics_path) != 0)
+                fprintf(stderr, "rsad: cannot write %s\n", metrics_path);
+            metrics_due = time(NULL) + RSAD_METRICS_INTERVAL;
+        }
+
+        if(poll(pfd, nfds, metrics_path ? 1000 : -1) < 0) {
+            if(errno == EINTR) continue;
+            perror("rsad: poll");
+            break;
+        }
+
+        if(pfd[0].revents & POLLIN) {
+            int cfd;
+            while((cfd = accept(lfd, NULL, NULL)) >= 0) {
+                for(i=0; i<RSAD_MAX_CONNS && conns[i].fd >= 0; i++)
+                    ;
+                if(i == RSAD_MAX_CONNS || !peer_allowed(cfd)) {
+                    close(cfd);
+                    continue;
+                }
+                fcntl(cfd, F_SETFL, O_NONBLOCK);
+                conns[i].fd = cfd;
+            }
+        }
+
+        if(pfd[1].revents & POLLIN)
+            deliver_done();
+
+        for(i=2; i<nfds; i++) {
+            conn_t *c = &conns[slots[i]];
+
+            // Connection may have been closed by deliver_done() above
+            if(c->fd != pfd[i].fd)
+                continue;
+
+            if(pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                // A full buffer is only read here on hangup or error of a busy connection
+                if(c->rlen == sizeof(c->rbuf)) {
+                    conn_close(slots[i]);
+                    continue;
+                }
+                r = read(c->fd, c->rbuf + c->rlen, sizeof(c->rbuf) - c->rlen);
+                if(r == 0 || (r < 0 && errno != EAGAIN && errno != EINTR)) {
+                    conn_close(slots[i]);
+                    continue;
+                }
+                if(r > 0) {
+                    c->rlen += (uint32_t)r;
+                    if(conn_parse(slots[i]) != 0) {
+                        conn_close(slots[i]);
+                        continue;
+                    }
+                }
+            }
+
+            if(c->woff < c->wlen) {
+                r = write(c->fd, c->wbuf + c->woff, c->wlen - c->woff);
+                if(r < 0 && errno != EAGAIN && errno != EINTR) {
+                    conn_close(slots[i]);
+                    continue;
+                }
+                if(r > 0)
+                    c->woff += (uint32_t)r;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&queue_lock);
+    stop = 1;
+    pthread_cond_broadcast(&queue_cond);
+    pthread_mutex_unlock(&queue_lock);
+    for(i=0; i<threads; i++)
+        pthread_join(workers[i], NULL);
+    free(workers);
+
+    for(i=0; i<RSAD_MAX_CONNS; i++) {
+        if(conns[i].fd >= 0)
+            conn_close(i);
+    }
+    close(lfd);
+    unlink(path);
+
+    if(metrics_path && rsa_metrics_write(metrics_path) != 0)
+        fprintf(stderr, "rsad: cannot write %s\n", metrics_path);
+    printf("rsad: %llu requests in %llu batches\n", (unsigned long long)stat_requests, (unsigned long long)stat_batches);
+
+    // Clear potentially sensitive information
+    rsa_keystore_close(&store);
+    memset((uint8_t *)&key_ctx, 0, sizeof(key_ctx));
+
+    return 0;
+}
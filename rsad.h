@@ -0,0 +1,98 @@
+/*****************************************************************************
+Filename    : rsad.h
+Date        : 2026-10-19
+Description : Wire format shared by the RSA offload daemon and its clients
+*****************************************************************************/
+#ifndef __RSAD_H__
+#define __RSAD_H__
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/un.h>
+
+// The default socket lives in a directory only its owner can enter:
+// $XDG_RUNTIME_DIR if set, else /tmp/rsad-<uid>, which rsad creates 0700
+#define RSAD_SOCK_NAME              "rsad.sock"
+#define RSAD_PATH_MAX               sizeof(((struct sockaddr_un *)0)->sun_path)
+
+// Every frame is a fixed 12 byte header followed by len payload bytes.
+// All header fields are big-endian.
+//
+//   request : len[4] id[4] op[1] key[1] reserved[2]
+//   response: len[4] id[4] op[1] key[1] status[2]
+#define RSAD_HDR_LEN                12
+#define RSAD_MAX_PAYLOAD            4096
+
+// Operations
+#define RSAD_OP_DECRYPT             1       // rsa_private_decrypt
+#define RSAD_OP_SIGN                2       // rsa_private_encrypt
+
+// Status codes beyond the library's ERR_* values
+#define RSAD_ERR_BAD_OP             0x2001
+#define RSAD_ERR_BAD_KEY            0x2002
+#define RSAD_ERR_BAD_LEN            0x2003
+
+typedef struct {
+    uint32_t len;
+    uint32_t id;
+    uint8_t  op;
+    uint8_t  key;
+    uint16_t status;                        // reserved (0) in requests
+} rsad_hdr_t;
+
+// Writes the default socket directory to dir and the socket path to path, both
+// RSAD_PATH_MAX bytes; -1 if the path would not fit in sun_path
+static inline int rsad_default_path(char *dir, char *path)
+{
+    const char *run = getenv("XDG_RUNTIME_DIR");
+    int n;
+
+    if(run && run[0] == '/')
+        n = snprintf(dir, RSAD_PATH_MAX, "%s", run);
+    else
+        n = snprintf(dir, RSAD_PATH_MAX, "/tmp/rsad-%u", (unsigned)geteuid());
+    if(n >= 0 && (size_t)n < RSAD_PATH_MAX)
+        n = snprintf(path, RSAD_PATH_MAX, "%s/" RSAD_SOCK_NAME, dir);
+    if(n < 0 || (size_t)n >= RSAD_PATH_MAX) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    return 0;
+}
+
+static inline void rsad_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t rsad_get32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void rsad_hdr_encode(uint8_t *p, const rsad_hdr_t *h)
+{
+    rsad_put32(p, h->len);
+    rsad_put32(p + 4, h->id);
+    p[8] = h->op;
+    p[9] = h->key;
+    p[10] = (uint8_t)(h->status >> 8);
+    p[11] = (uint8_t)h->status;
+}
+
+static inline void rsad_hdr_decode(rsad_hdr_t *h, const uint8_t *p)
+{
+    h->len = rsad_get32(p);
+    h->id = rsad_get32(p + 4);
+    h->op = p[8];
+    h->key = p[9];
+    h->status = (uint16_t)((p[10] << 8) | p[11]);
+}
+
+#endif  // __RSAD_H__
@@ -0,0 +1,246 @@
+/*****************************************************************************
+Filename    : rsad_client.c
+Date        : 2026-10-19
+Description : Load generator for rsad. Each thread opens one connection and
+              keeps a fixed number of requests in flight, checking replies
+              and recording per-request latency.
+*****************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "rsa.h"
+#include "rsad.h"
+#include "keys.h"
+#include "keys_load.h"
+
+#define MSG_LEN                     64
+
+typedef struct {
+    uint32_t  index;
+    uint32_t  requests;
+    double    *latency;                     // seconds, one per request
+    uint32_t  errors;
+} client_t;
+
+static const char *path;
+static uint32_t depth = 8;
+static uint8_t op = RSAD_OP_DECRYPT;
+
+static uint8_t msg[MSG_LEN];
+static uint8_t cipher[RSA_MAX_MODULUS_LEN];
+static uint32_t cipher_len;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int write_full(int fd, uint8_t *p, uint32_t len)
+{
+    ssize_t r;
+    while(len) {
+        if((r = write(fd, p, len)) < 0) {
+            if(errno == EINTR) continue;
+            return -1;
+        }
+        p += r;
+        len -= (uint32_t)r;
+    }
+    return 0;
+}
+
+static int read_full(int fd, uint8_t *p, uint32_t len)
+{
+    ssize_t r;
+    while(len) {
+        if((r = read(fd, p, len)) <= 0) {
+            if(r < 0 && errno == EINTR) continue;
+            return -1;
+        }
+        p += r;
+        len -= (uint32_t)r;
+    }
+    return 0;
+}
+
+static int send_request(int fd, uint32_t id)
+{
+    uint8_t frame[RSAD_HDR_LEN + RSA_MAX_MODULUS_LEN];
+    rsad_hdr_t hdr = {0};
+
+    hdr.id = id;
+    hdr.op = op;
+    hdr.key = 0;
+    if(op == RSAD_OP_DECRYPT) {
+        hdr.len = cipher_len;
+        memcpy(frame + RSAD_HDR_LEN, cipher, cipher_len);
+    } else {
+        hdr.len = MSG_LEN;
+        memcpy(frame + RSAD_HDR_LEN, msg, MSG_LEN);
+    }
+    rsad_hdr_encode(frame, &hdr);
+
+    return write_full(fd, frame, RSAD_HDR_LEN + hdr.len);
+}
+
+static void *client_main(void *arg)
+{
+    client_t *cl = arg;
+    struct sockaddr_un addr;
+    uint8_t hbuf[RSAD_HDR_LEN], payload[RSAD_MAX_PAYLOAD];
+    rsad_hdr_t hdr;
+    double *sent;
+    uint32_t next = 0, received = 0;
+    int fd;
+
+    sent = calloc(cl->requests, sizeof(*sent));
+    if((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        cl->errors = cl->requests;
+        free(sent);
+        return NULL;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path, strlen(path));
+    if(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("rsad_client: connect");
+        cl->errors = cl->requests;
+        goto out;
+    }
+
+    while(received < cl->requests) {
+        while(next < cl->requests && next - received < depth) {
+            sent[next] = now();
+            if(send_request(fd, next) != 0)
+                goto broken;
+            next++;
+        }
+
+        if(read_full(fd, hbuf, RSAD_HDR_LEN) != 0)
+            goto broken;
+        rsad_hdr_decode(&hdr, hbuf);
+        if(hdr.len > sizeof(payload) || read_full(fd, payload, hdr.len) != 0 || hdr.id >= cl->requests)
+            goto broken;
+
+        cl->latency[received++] = now() - sent[hdr.id];
+        if(hdr.status != 0)
+            cl->errors++;
+        else if(op == RSAD_OP_DECRYPT && (hdr.len != MSG_LEN || memcmp(payload, msg, MSG_LEN) != 0))
+            cl->errors++;
+        else if(op == RSAD_OP_SIGN && hdr.len != KEY_M_BITS / 8)
+            cl->errors++;
+    }
+    goto out;
+
+broken:
+    fprintf(stderr, "rsad_client: connection %u lost after %u replies\n", cl->index, received);
+    cl->errors += cl->requests - received;
+    cl->requests = received;
+out:
+    close(fd);
+    free(sent);
+    return NULL;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-s socket] [-c connections] [-n requests_per_conn] [-d depth] [-o decrypt|sign]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    char dir[RSAD_PATH_MAX], default_path[RSAD_PATH_MAX];
+    rsa_pk_t pk = {0};
+    client_t *clients;
+    pthread_t *threads;
+    double start, elapsed, *all, sum = 0;
+    uint32_t i, j, k, conns = 4, requests = 100, total = 0, errors = 0;
+    int opt;
+
+    while((opt = getopt(argc, argv, "s:c:n:d:o:h")) != -1) {
+        switch(opt) {
+        case 's': path = optarg;                        break;
+        case 'c': conns = (uint32_t)atoi(optarg);       break;
+        case 'n': requests = (uint32_t)atoi(optarg);    break;
+        case 'd': depth = (uint32_t)atoi(optarg);       break;
+        case 'o': op = strcmp(optarg, "sign") == 0 ? RSAD_OP_SIGN : RSAD_OP_DECRYPT; break;
+        default:  usage(argv[0]);                       return 1;
+        }
+    }
+    if(path == NULL) {
+        if(rsad_default_path(dir, default_path) != 0) {
+            perror("rsad_client: socket path");
+            return 1;
+        }
+        path = default_path;
+    }
+    if(strlen(path) >= RSAD_PATH_MAX) {
+        fprintf(stderr, "rsad_client: socket path longer than %zu bytes\n", RSAD_PATH_MAX - 1);
+        return 1;
+    }
+    if(conns == 0) conns = 1;
+    if(depth == 0) depth = 1;
+
+    KEY_LOAD_PK(pk, key, KEY_M_BITS);
+    generate_rand(msg, MSG_LEN);
+    if(rsa_public_encrypt(cipher, &cipher_len, msg, MSG_LEN, &pk) != 0) {
+        fprintf(stderr, "rsad_client: cannot build test ciphertext\n");
+        return 1;
+    }
+
+    clients = calloc(conns, sizeof(*clients));
+    threads = calloc(conns, sizeof(*threads));
+    for(i=0; i<conns; i++) {
+        clients[i].index = i;
+        clients[i].requests = requests;
+        clients[i].latency = calloc(requests, sizeof(double));
+    }
+
+    start = now();
+    for(i=0; i<conns; i++)
+        pthread_create(&threads[i], NULL, client_main, &clients[i]);
+    for(i=0; i<conns; i++)
+        pthread_join(threads[i], NULL);
+    elapsed = now() - start;
+
+    for(i=0; i<conns; i++) {
+        total += clients[i].requests;
+        errors += clients[i].errors;
+    }
+    all = calloc(total ? total : 1, sizeof(double));
+    for(i=0, k=0; i<conns; i++) {
+        for(j=0; j<clients[i].requests; j++) {
+            all[k++] = clients[i].latency[j];
+            sum += clients[i].latency[j];
+        }
+        free(clients[i].latency);
+    }
+    qsort(all, total, sizeof(double), cmp_double);
+
+    printf("%u requests, %u errors, %.3f s, %.1f req/s\n", total, errors, elapsed, total / elapsed);
+    if(total) {
+        printf("latency ms: avg %.3f p50 %.3f p99 %.3f max %.3f\n", sum / total * 1e3,
+               all[total / 2] * 1e3, all[(uint32_t)(total * 0.99)] * 1e3, all[total - 1] * 1e3);
+    }
+
+    free(all);
+    free(clients);
+    free(threads);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************
+Filename    : sha256.c
+Date        : 2026-10-19
+Description : SHA-256 (FIPS 180-4)
+*****************************************************************************/
+#include <string.h>
+
+#include "sha256.h"
+
+static const uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR(x, n)  (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_block(uint32_t *state, const uint8_t *p)
+{
+    uint32_t w[64], s[8], t1, t2;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 | (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3];
+    }
+    for (i = 16; i < 64; i++) {
+        w[i] = w[i - 16] + (ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3)) +
+               w[i - 7] + (ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+    }
+    memcpy(s, state, sizeof(s));
+    for (i = 0; i < 64; i++) {
+        t1 = s[7] + (ROTR(s[4], 6) ^ ROTR(s[4], 11) ^ ROTR(s[4], 25)) + ((s[4] & s[5]) ^ (~s[4] & s[6])) + K[i] + w[i];
+        t2 = (ROTR(s[0], 2) ^ ROTR(s[0], 13) ^ ROTR(s[0], 22)) + ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+        memmove(&s[1], &s[0], 7 * sizeof(s[0]));
+        s[4] += t1;
+        s[0] = t1 + t2;
+    }
+    for (i = 0; i < 8; i++) {
+        state[i] += s[i];
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)w, 0, sizeof(w));
+    memset((uint8_t*)s, 0, sizeof(s));
+}
+
+void sha256_init(sha256_t *ctx)
+{
+    static const uint32_t iv[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    memcpy(ctx->state, iv, sizeof(iv));
+    ctx->count = 0;
+}
+
+void sha256_update(sha256_t *ctx, const uint8_t *in, uint32_t in_len)
+{
+    uint32_t used = ctx->count % SHA256_BLOCK_LEN, n;
+
+    ctx->count += in_len;
+    if (used) {
+        n = SHA256_BLOCK_LEN - used < in_len ? SHA256_BLOCK_LEN - used : in_len;
+        memcpy(ctx->buf + used, in, n);
+        in += n;
+        in_len -= n;
+        if (used + n < SHA256_BLOCK_LEN) {
+            return;
+        }
+        sha256_block(ctx->state, ctx->buf);
+    }
+    for (; in_len >= SHA256_BLOCK_LEN; in += SHA256_BLOCK_LEN, in_len -= SHA256_BLOCK_LEN) {
+        sha256_block(ctx->state, in);
+    }
+    memcpy(ctx->buf, in, in_len);
+}
+
+void sha256_final(sha256_t *ctx, uint8_t digest[SHA256_DIGEST_LEN])
+{
+    uint32_t used = ctx->count % SHA256_BLOCK_LEN, i;
+    uint64_t bits = ctx->count * 8;
+
+    ctx->buf[used++] = 0x80;
+    if (used > SHA256_BLOCK_LEN - 8) {
+        memset(ctx->buf + used, 0, SHA256_BLOCK_LEN - used);
+        sha256_block(ctx->state, ctx->buf);
+        used = 0;
+    }
+    memset(ctx->buf + used, 0, SHA256_BLOCK_LEN - 8 - used);
+    for (i = 0; i < 8; i++) {
+        ctx->buf[SHA256_BLOCK_LEN - 1 - i] = (uint8_t)(bits >> (8 * i));
+    }
+    sha256_block(ctx->state, ctx->buf);
+
+    for (i = 0; i < 8; i++) {
+        digest[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+        digest[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+        digest[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+        digest[4 * i + 3] = (uint8_t)ctx->state[i];
+    }
+
+    // Clear potentially sensitive information
+    memset((uint8_t*)ctx, 0, sizeof(*ctx));
+}
+
+void sha256(uint8_t digest[SHA256_DIGEST_LEN], const uint8_t *in, uint32_t in_len)
+{
+    sha256_t ctx;
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, in, in_len);
+    sha256_final(&ctx, digest);
+}
@@ -0,0 +1,25 @@
+/*****************************************************************************
+Filename    : sha256.h
+Date        : 2026-10-19
+Description : SHA-256 (FIPS 180-4), used for key derivation
+*****************************************************************************/
+#ifndef __SHA256_H__
+#define __SHA256_H__
+
+#include <stdint.h>
+
+#define SHA256_BLOCK_LEN                    64
+#define SHA256_DIGEST_LEN                   32
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t count;                             // bytes hashed so far
+    uint8_t  buf[SHA256_BLOCK_LEN];
+} sha256_t;
+
+void sha256_init(sha256_t *ctx);
+void sha256_update(sha256_t *ctx, const uint8_t *in, uint32_t in_len);
+void sha256_final(sha256_t *ctx, uint8_t digest[SHA256_DIGEST_LEN]);
+void sha256(uint8_t digest[SHA256_DIGEST_LEN], const uint8_t *in, uint32_t in_len);
+
+#endif  // __SHA256_H__